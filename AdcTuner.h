@@ -0,0 +1,219 @@
+// The values AdcTuner sweeps over.
+const uint8_t kAdcAveraging[] = { 1, 2, 4, 8, 16, 32 };
+const uint8_t kAdcResolutions[] = { 8, 10, 12 };
+const ADC_CONVERSION_SPEED kAdcConversionSpeeds[] = {
+  ADC_CONVERSION_SPEED::VERY_LOW_SPEED, ADC_CONVERSION_SPEED::LOW_SPEED,
+  ADC_CONVERSION_SPEED::MED_SPEED, ADC_CONVERSION_SPEED::HIGH_SPEED,
+  ADC_CONVERSION_SPEED::VERY_HIGH_SPEED,
+};
+const ADC_SAMPLING_SPEED kAdcSamplingSpeeds[] = {
+  ADC_SAMPLING_SPEED::VERY_LOW_SPEED, ADC_SAMPLING_SPEED::LOW_SPEED,
+  ADC_SAMPLING_SPEED::MED_SPEED, ADC_SAMPLING_SPEED::HIGH_SPEED,
+  ADC_SAMPLING_SPEED::VERY_HIGH_SPEED,
+};
+
+// One point in the ADC configuration space. The speeds are indices into
+// kAdcConversionSpeeds/kAdcSamplingSpeeds.
+struct AdcConfig {
+  uint8_t averaging;
+  uint8_t resolution;
+  uint8_t conversion_speed;
+  uint8_t sampling_speed;
+};
+
+// Applied in setup(): 16x hardware averaging at the pipeline's resolution and
+// the library's default speeds.
+const AdcConfig kDefaultAdcConfig = { 16, kPipelineBits, 3, 3 };
+
+// Measures what each ADC configuration costs per conversion and how much idle
+// noise is left with it, and applies the fastest one that meets a noise
+// budget.
+//
+// The sweep blocks loop() for several seconds and measures idle noise, so it
+// should be run with nobody standing on the pad.
+class AdcTuner {
+ public:
+  AdcTuner() : resolution_(kPipelineBits) {}
+
+  // Brings a sample converted at the current resolution to kPipelineBits.
+  // Samples converted at a lower resolution are shifted up, so the pipeline
+  // doesn't care what the ADC is set to.
+  // |extra_bits| is for values that were scaled up on top of that, e.g. by a
+  // CicDecimator; those are rounded rather than truncated.
+  inline int16_t Normalize(int32_t sample, uint8_t extra_bits = 0) const {
+    int8_t shift = resolution_ + extra_bits - kPipelineBits;
+    if (shift <= 0) return sample << -shift;
+    if (extra_bits == 0) return sample >> shift;
+    return (sample + (1 << (shift - 1))) >> shift;
+  }
+
+  uint8_t Resolution() const { return resolution_; }
+
+  void Apply(ADC* adc, const AdcConfig& config) {
+    ADC_Module* modules[] = { adc->adc0, adc->adc1 };
+    for (ADC_Module* module : modules) {
+      module->setAveraging(config.averaging);
+      module->setResolution(config.resolution);
+      module->setConversionSpeed(kAdcConversionSpeeds[config.conversion_speed]);
+      module->setSamplingSpeed(kAdcSamplingSpeeds[config.sampling_speed]);
+    }
+    resolution_ = config.resolution;
+  }
+
+  // Sweeps every configuration over |pins|, converting each on the ADC in
+  // |modules| the sensor path uses for it, and prints, in order:
+  //   "c <avg> <bits> <conv> <samp> <std> <p2p> ... us <adc0 us> <adc1 us>"
+  //     per configuration, with the standard deviation and peak-to-peak
+  //     noise of every channel in kPipelineBits LSBs and each ADC's time per
+  //     conversion (0 for one no pin is converted on),
+  //   "c* <avg> <bits> <conv> <samp> <us> <std>" for each configuration on
+  //     the speed/noise Pareto frontier, <us> being the slower ADC's and
+  //     <std> the noisiest channel's,
+  //   "c= ..." for the configuration that was applied, or "c= none" if no
+  //     configuration kept every channel's standard deviation within
+  //     |noise_budget|, in which case the current configuration stays.
+  void Sweep(ADC* adc, const uint8_t* pins, ADC_Module* const* modules,
+             size_t num_pins, float noise_budget) {
+    size_t count = 0;
+    for (uint8_t avg = 0; avg < kNumAveraging; avg++) {
+      for (uint8_t bits = 0; bits < kNumResolutions; bits++) {
+        for (uint8_t conv = 0; conv < kNumConversionSpeeds; conv++) {
+          for (uint8_t samp = 0; samp < kNumSamplingSpeeds; samp++) {
+            Result& result = results_[count++];
+            result.config = { kAdcAveraging[avg], kAdcResolutions[bits], conv, samp };
+            Measure(adc, pins, modules, num_pins, &result);
+          }
+        }
+      }
+    }
+
+    // A configuration is on the frontier if no other one is at least as fast
+    // and at least as quiet, and strictly better in one of the two.
+    for (size_t i = 0; i < count; i++) {
+      bool dominated = false;
+      for (size_t j = 0; j < count && !dominated; j++) {
+        dominated = results_[j].micros <= results_[i].micros &&
+                    results_[j].noise <= results_[i].noise &&
+                    (results_[j].micros < results_[i].micros ||
+                     results_[j].noise < results_[i].noise);
+      }
+      if (!dominated) Print("c*", results_[i]);
+    }
+
+    const Result* best = nullptr;
+    for (size_t i = 0; i < count; i++) {
+      if (results_[i].noise <= noise_budget &&
+          (best == nullptr || results_[i].micros < best->micros)) {
+        best = &results_[i];
+      }
+    }
+    if (best == nullptr) {
+      Apply(adc, current_);
+      Serial.print("c= none\n");
+      return;
+    }
+    current_ = best->config;
+    Apply(adc, current_);
+    Print("c=", *best);
+  }
+
+ private:
+  struct Result {
+    AdcConfig config;
+    // Time per conversion on the slower of the two ADCs.
+    float micros;
+    // Worst standard deviation across all channels.
+    float noise;
+  };
+
+  static const size_t kNumAveraging = sizeof(kAdcAveraging);
+  static const size_t kNumResolutions = sizeof(kAdcResolutions);
+  static const size_t kNumConversionSpeeds =
+      sizeof(kAdcConversionSpeeds) / sizeof(kAdcConversionSpeeds[0]);
+  static const size_t kNumSamplingSpeeds =
+      sizeof(kAdcSamplingSpeeds) / sizeof(kAdcSamplingSpeeds[0]);
+  static const size_t kNumConfigs = kNumAveraging * kNumResolutions *
+                                    kNumConversionSpeeds * kNumSamplingSpeeds;
+  // Conversions per channel and configuration.
+  static const size_t kSweepSamples = 64;
+
+  void Measure(ADC* adc, const uint8_t* pins, ADC_Module* const* modules,
+               size_t num_pins, Result* result) {
+    Apply(adc, result->config);
+    // Per ADC, adc0 first.
+    uint32_t cycles[2] = { 0, 0 };
+    uint32_t conversions[2] = { 0, 0 };
+    result->noise = 0;
+    Print("c", *result, false);
+    for (size_t p = 0; p < num_pins; p++) {
+      ADC_Module* module = modules[p];
+      size_t m = module == adc->adc1 ? 1 : 0;
+      // Let the sample and hold settle on the new configuration.
+      for (size_t i = 0; i < 4; i++) module->analogRead(pins[p]);
+
+      // Noise is measured on the raw values and scaled afterwards, so that
+      // low resolutions aren't rounded to whole kPipelineBits LSBs.
+      float sum = 0, sum_squares = 0;
+      int32_t lo = INT32_MAX, hi = INT32_MIN;
+      for (size_t i = 0; i < kSweepSamples; i++) {
+        uint32_t start = ARM_DWT_CYCCNT;
+        int32_t value = module->analogRead(pins[p]);
+        cycles[m] += ARM_DWT_CYCCNT - start;
+        sum += value;
+        sum_squares += (float)value * value;
+        lo = min(lo, value);
+        hi = max(hi, value);
+      }
+      float scale = (float)(1 << kPipelineBits) / (1 << resolution_);
+      float mean = sum / kSweepSamples;
+      float variance = sum_squares / kSweepSamples - mean * mean;
+      float deviation = variance > 0 ? sqrtf(variance) * scale : 0;
+      result->noise = max(result->noise, deviation);
+      Serial.print(" ");
+      Serial.print(deviation, 2);
+      Serial.print(" ");
+      Serial.print((hi - lo) * scale, 2);
+      conversions[m] += kSweepSamples;
+    }
+    result->micros = 0;
+    Serial.print(" us");
+    for (size_t m = 0; m < 2; m++) {
+      float micros = conversions[m] == 0
+                         ? 0
+                         : (float)cycles[m] / (F_CPU_ACTUAL / 1000000) /
+                               conversions[m];
+      result->micros = max(result->micros, micros);
+      Serial.print(" ");
+      Serial.print(micros, 2);
+    }
+    Serial.print("\n");
+  }
+
+  void Print(const char* tag, const Result& result, bool summary = true) {
+    Serial.print(tag);
+    Serial.print(" ");
+    Serial.print(result.config.averaging);
+    Serial.print(" ");
+    Serial.print(result.config.resolution);
+    Serial.print(" ");
+    Serial.print(result.config.conversion_speed);
+    Serial.print(" ");
+    Serial.print(result.config.sampling_speed);
+    if (summary) {
+      Serial.print(" ");
+      Serial.print(result.micros, 2);
+      Serial.print(" ");
+      Serial.print(result.noise, 2);
+      Serial.print("\n");
+    }
+  }
+
+  uint8_t resolution_;
+  AdcConfig current_ = kDefaultAdcConfig;
+  // Only the sweep uses these, so they are kept out of the object, which is
+  // in DTCM, see MemoryPlacement.h.
+  static Result results_[kNumConfigs];
+};
+
+AdcTuner::Result AdcTuner::results_[AdcTuner::kNumConfigs] DMAMEM;
+AdcTuner adcTuner HOT_DATA;
@@ -0,0 +1,55 @@
+#include <SD.h>
+
+// Directory on the SD card holding the animation library. Every .lpa asset
+// in it (built with tools/mkasset.py) can be played by name.
+const char* const kLibraryDir = "/anims";
+
+// Animations on the Teensy 4.1's built-in SD card. Nothing here is read on the
+// render path: playback goes through AnimationStream, which prefetches frames.
+class AnimationLibrary {
+ public:
+  AnimationLibrary() : ready_(false) {}
+
+  void Init() {
+    ready_ = SD.begin(BUILTIN_SDCARD);
+  }
+
+  bool IsReady() const { return ready_; }
+
+  // Prints the library as "l <name> <name> ...", listing only .lpa assets,
+  // the only files "p <name>" can play.
+  void PrintNames() {
+    Serial.print("l");
+    if (ready_) {
+      File dir = SD.open(kLibraryDir);
+      while (dir) {
+        File entry = dir.openNextFile();
+        if (!entry) break;
+        if (!entry.isDirectory() && IsAsset(entry.name())) {
+          Serial.print(" ");
+          Serial.print(entry.name());
+        }
+        entry.close();
+      }
+      dir.close();
+    }
+    Serial.print("\n");
+  }
+
+  File Open(const char* name) {
+    if (!ready_ || strchr(name, '/') != nullptr) return File();
+    char path[64];
+    snprintf(path, sizeof(path), "%s/%s", kLibraryDir, name);
+    return SD.open(path, FILE_READ);
+  }
+
+ private:
+  // FAT keeps short names in upper case, so the extension is matched either
+  // way.
+  static bool IsAsset(const char* name) {
+    size_t len = strlen(name);
+    return len > 4 && strcasecmp(name + len - 4, ".lpa") == 0;
+  }
+
+  bool ready_;
+};
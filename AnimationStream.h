@@ -0,0 +1,187 @@
+// Number of frame slots the stream prefetches into. One slot holds the frame
+// on screen, the rest are filled ahead of time.
+const size_t kStreamSlots = 3;
+// Bytes read from the file per Pump() call. One SD sector keeps the time
+// spent per loop() iteration small and predictable.
+const size_t kStreamChunkSize = 512;
+
+// Streams an .lpa asset (see PanelAsset.h) of any length from a file, frame by
+// frame, into a small ring of frame slots.
+//
+// Pump() does a bounded amount of reading and run expansion and is meant to be
+// called from loop() whenever there is spare time. The render path only ever
+// looks at slots that are already complete, so it never waits on the file.
+//
+// FileT only needs read(buffer, len), seek(position) and close(), so the same
+// code runs against an SD File on the device or a FILE*-backed file on a host.
+template <typename FileT>
+class AnimationStream {
+ public:
+  AnimationStream() : open_(false) {}
+
+  // Takes ownership of |file|. |slots| must have room for kStreamSlots frames
+  // of kMatrixWidth * kMatrixHeight pixels.
+  bool Open(FileT file, rgb24* slots, uint32_t layout) {
+    Close();
+    file_ = file;
+    slots_ = slots;
+    if (!file_.seek(0) ||
+        !ReadFully(&header_, sizeof(header_)) ||
+        !PanelAsset::HeaderMatches(header_, layout)) {
+      file_.close();
+      return false;
+    }
+    data_start_ = sizeof(PanelAsset::Header) +
+                  header_.frames * sizeof(PanelAsset::IndexEntry);
+    next_frame_ = 0;
+    head_ = 0;
+    ready_ = 0;
+    shown_ = kNoSlot;
+    remaining_ = 0;
+    underruns_ = 0;
+    open_ = true;
+    return true;
+  }
+
+  void Close() {
+    if (open_) {
+      file_.close();
+      open_ = false;
+    }
+  }
+
+  bool IsOpen() const { return open_; }
+
+  // Fills the next free slot a little further. Returns false if the file
+  // could not be read, in which case the stream closes itself.
+  bool Pump() {
+    if (!open_ || ready_ + (shown_ != kNoSlot) >= kStreamSlots) return true;
+
+    if (remaining_ == 0 && !BeginFrame()) {
+      Close();
+      return false;
+    }
+    size_t len = min(remaining_, kStreamChunkSize);
+    if (!ReadFully(chunk_, len) || !expander_.Expand(chunk_, len)) {
+      Close();
+      return false;
+    }
+    remaining_ -= len;
+    if (remaining_ == 0) {
+      if (!expander_.Complete()) {
+        Close();
+        return false;
+      }
+      ready_++;
+    }
+    return true;
+  }
+
+  // The frame to show next, or the one already on screen if the next one is
+  // not complete yet. Returns nullptr before the first frame is ready.
+  const rgb24* Front() const {
+    if (ready_ > 0) return Slot(head_);
+    if (shown_ != kNoSlot) return Slot(shown_);
+    return nullptr;
+  }
+
+  uint16_t FrontDelay() const {
+    if (ready_ > 0) return delays_[head_];
+    if (shown_ != kNoSlot) return delays_[shown_];
+    return 0;
+  }
+
+  // Marks Front() as shown and releases the previously shown slot.
+  void Pop() {
+    if (ready_ == 0) {
+      underruns_++;
+      return;
+    }
+    shown_ = head_;
+    head_ = (head_ + 1) % kStreamSlots;
+    ready_--;
+  }
+
+  // Number of times the render path wanted a frame that was not ready.
+  uint32_t Underruns() const { return underruns_; }
+
+ private:
+  static const size_t kNoSlot = SIZE_MAX;
+
+  rgb24* Slot(size_t slot) const {
+    return slots_ + slot * kMatrixWidth * kMatrixHeight;
+  }
+
+  bool BeginFrame() {
+    PanelAsset::IndexEntry entry;
+    size_t pos = sizeof(PanelAsset::Header) +
+                 next_frame_ * sizeof(PanelAsset::IndexEntry);
+    if (!file_.seek(pos) || !ReadFully(&entry, sizeof(entry)) ||
+        entry.length == 0 || !file_.seek(data_start_ + entry.offset)) {
+      return false;
+    }
+    filling_ = (head_ + ready_) % kStreamSlots;
+    delays_[filling_] = entry.delay_ms;
+    expander_.Begin(Slot(filling_), kMatrixWidth * kMatrixHeight);
+    remaining_ = entry.length;
+    // Long animations loop back to the first frame.
+    next_frame_ = (next_frame_ + 1) % header_.frames;
+    return true;
+  }
+
+  bool ReadFully(void* dest, size_t len) {
+    uint8_t* out = (uint8_t*)dest;
+    while (len > 0) {
+      int result = file_.read(out, len);
+      if (result <= 0) return false;
+      out += result;
+      len -= result;
+    }
+    return true;
+  }
+
+  FileT file_;
+  bool open_;
+  rgb24* slots_;
+  PanelAsset::Header header_;
+  size_t data_start_;
+
+  // Frame index in the file that BeginFrame() will load next.
+  size_t next_frame_;
+  // Ring of complete frames waiting to be shown, starting at head_.
+  size_t head_;
+  size_t ready_;
+  // Slot currently on screen, kept until the next frame replaces it.
+  size_t shown_;
+  uint16_t delays_[kStreamSlots];
+  uint32_t underruns_;
+
+  // Progress of the frame being filled.
+  size_t filling_;
+  size_t remaining_;
+  PanelAsset::RunExpander expander_;
+  uint8_t chunk_[kStreamChunkSize];
+};
+
+#if !defined(ARDUINO)
+#include <stdio.h>
+
+// FILE*-backed stand-in for an SD File, for running AnimationStream on a host.
+class StdioFile {
+ public:
+  StdioFile(FILE* file = nullptr) : file_(file) {}
+  int read(void* buffer, size_t len) {
+    return file_ ? (int)fread(buffer, 1, len, file_) : -1;
+  }
+  bool seek(uint64_t position) {
+    return file_ && fseek(file_, (long)position, SEEK_SET) == 0;
+  }
+  void close() {
+    if (file_) fclose(file_);
+    file_ = nullptr;
+  }
+
+ private:
+  FILE* file_;
+};
+#endif
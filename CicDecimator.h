@@ -0,0 +1,63 @@
+constexpr uint8_t Log2(uint32_t value) {
+  return value <= 1 ? 0 : 1 + Log2(value >> 1);
+}
+
+// Cascaded integrator-comb decimator of order kOrder that reduces the sample
+// rate by kRatio. Takes the place of the ADC's hardware averaging: the ADC
+// runs at a high fixed rate with little or no averaging and this turns that
+// stream into a lower rate one with more resolution and a sinc^kOrder
+// response, using only additions.
+//
+// Integrators and combs wrap around in unsigned 32-bit arithmetic, which is
+// exact as long as the output fits, i.e. as long as the input bits plus
+// kGainBits stay below 32.
+template <uint8_t kOrder, uint16_t kRatio>
+class CicDecimator {
+ public:
+  static_assert(kOrder > 0, "A CIC needs at least one stage");
+  static_assert((kRatio & (kRatio - 1)) == 0 && kRatio > 1,
+                "kRatio must be a power of two so the gain is a shift");
+
+  // The DC gain is kRatio^kOrder, i.e. the output carries kGainBits more bits
+  // than the input.
+  static constexpr uint8_t kGainBits = kOrder * Log2(kRatio);
+  static_assert(kGainBits + 16 < 32, "Output would not fit in 32 bits");
+
+  // Group delay in input samples. The filter is linear phase, so this is the
+  // same for every frequency and never changes.
+  static constexpr float kDelaySamples = kOrder * (kRatio - 1) / 2.0f;
+
+  CicDecimator() : phase_(0), output_(0), integrators_{}, combs_{} {}
+
+  // Feeds one input sample. Returns true every kRatio samples, when a new
+  // Output() is available.
+  bool Push(int32_t sample) {
+    uint32_t value = (uint32_t)sample;
+    for (uint8_t i = 0; i < kOrder; i++) {
+      integrators_[i] += value;
+      value = integrators_[i];
+    }
+    if (++phase_ < kRatio) {
+      return false;
+    }
+    phase_ = 0;
+    for (uint8_t i = 0; i < kOrder; i++) {
+      uint32_t previous = combs_[i];
+      combs_[i] = value;
+      value -= previous;
+    }
+    output_ = (int32_t)value;
+    return true;
+  }
+
+  // The latest decimated value, scaled by 2^kGainBits.
+  int32_t Output() const {
+    return output_;
+  }
+
+ private:
+  uint16_t phase_;
+  int32_t output_;
+  uint32_t integrators_[kOrder];
+  uint32_t combs_[kOrder];
+};
@@ -0,0 +1,88 @@
+// Brightness of the idle layer that shows under panels that aren't pressed,
+// 0-255. It breathes between half of this and all of it. 0 leaves idle panels
+// black.
+const uint8_t kIdleLevel = 24;
+const uint32_t kIdleBreathMs = 4000;
+// How long a released panel takes to fade from its animation to the idle
+// layer.
+const uint32_t kReleaseFadeMs = 250;
+// Upper bound for compositing the whole matrix, see "b" in SerialProcessor.h.
+const uint32_t kCompositeBudgetMicros = 1000;
+
+// Weight of the animation layer on a panel released |elapsed_ms| ago, 0-255.
+inline uint8_t ReleaseAlpha(uint32_t elapsed_ms) {
+  return elapsed_ms >= kReleaseFadeMs
+             ? 0
+             : 255 - elapsed_ms * 255 / kReleaseFadeMs;
+}
+
+// Composites each panel out of an idle layer and the animation layer, the
+// latter weighted by the panel's alpha: 255 while pressed, decaying after a
+// release. Like PanelShader, a frame is set up by Begin() and then produced
+// row by row with ComposeRow(), directly in the back buffer.
+//
+// Rows that are all one layer are plain fills or copies; only rows that mix
+// the two are blended, three words (four pixels) at a time.
+class Compositor {
+ public:
+  // |frame| is the animation frame on screen, or nullptr if there is none
+  // yet, in which case only the idle layer is drawn.
+  void Begin(const uint8_t* alphas, const rgb24* frame, uint32_t now_ms) {
+    frame_ = frame;
+    uint32_t phase = (now_ms % kIdleBreathMs) * 256 / kIdleBreathMs;
+    uint8_t breath = phase < 128 ? phase * 2 : (255 - phase) * 2;
+    uint8_t idle = kIdleLevel / 2 + ((kIdleLevel / 2) * breath >> 8);
+    for (size_t i = 0; i < kNumPanels; i++) {
+      alphas_[i] = frame == nullptr ? 0 : alphas[i];
+      idle_[i] = QuadOf(ScaleColor(kPanelColors[i % kPanelsPerPad], idle));
+    }
+  }
+
+  // The animation layer's weight on |panel| in this frame: rows of panels at
+  // 0 or 255 are plain fills or copies.
+  uint8_t Alpha(size_t panel) const {
+    return alphas_[panel];
+  }
+
+  // |dest| is the whole display, kChainWidth wide; the frame is one pad's
+  // width, see PanelX() and FrameX().
+  void ComposeRow(size_t panel, uint8_t y, rgb24* dest) const {
+    rgb24* out = &dest[kChainWidth * y + PanelX(panel)];
+    const rgb24* in = &frame_[kMatrixWidth * y + FrameX(panel)];
+    uint8_t alpha = alphas_[panel];
+    if (alpha == 0) {
+      FillQuads(out, idle_[panel], kPanelWidth);
+    } else if (alpha == 255) {
+      memcpy(out, in, kPanelWidth * sizeof(rgb24));
+    } else {
+      BlendRow(out, in, idle_[panel], WeightOf(alpha));
+    }
+  }
+
+  // Blends |src| over |idle| into |dest|, for |kPanelWidth| pixels.
+  static void BlendRow(rgb24* dest, const rgb24* src, const PixelQuad& idle,
+                       uint32_t weight) {
+    uint8_t* out = (uint8_t*)dest;
+    const uint8_t* in = (const uint8_t*)src;
+    for (uint16_t x = 0; x < kPanelWidth; x += 4, out += 12, in += 12) {
+      StoreWord(out, Blend8(idle.words[0], LoadWord(in), weight));
+      StoreWord(out + 4, Blend8(idle.words[1], LoadWord(in + 4), weight));
+      StoreWord(out + 8, Blend8(idle.words[2], LoadWord(in + 8), weight));
+    }
+  }
+
+  // The same blend one channel at a time, only kept to compare against.
+  static void BlendRowScalar(rgb24* dest, const rgb24* src, rgb24 idle,
+                             uint32_t weight) {
+    for (uint16_t x = 0; x < kPanelWidth; x++) {
+      dest[x].red = (idle.red * (256 - weight) + src[x].red * weight) >> 8;
+      dest[x].green = (idle.green * (256 - weight) + src[x].green * weight) >> 8;
+      dest[x].blue = (idle.blue * (256 - weight) + src[x].blue * weight) >> 8;
+    }
+  }
+
+ private:
+  const rgb24* frame_ = nullptr;
+  uint8_t alphas_[kNumPanels];
+  PixelQuad idle_[kNumPanels];
+};
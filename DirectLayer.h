@@ -0,0 +1,77 @@
+// A SmartMatrix layer that draws straight from the animation frame, used
+// instead of the background layer when LED_DIRECT_LAYER is defined in
+// LedPanel.h.
+//
+// The refresh asks every layer for one hardware row at a time, from its
+// interrupt. This layer answers with that row of the animation frame for
+// panels whose bit is set in the pressed mask, and black for the others.
+// Nothing is composited or copied ahead of time, and a press shows up on
+// the next row the refresh asks for. The background layer's two 256x64
+// buffers are never allocated.
+//
+// What it can't do is anything that needs a frame drawn first: release
+// fades, the idle layer and the procedural modes all need the background
+// layer.
+static_assert(kNumPanels <= 32, "The pressed mask has a bit per panel");
+
+class DirectLayer : public SM_Layer {
+ public:
+  // Called by matrix.begin(). Color correction is a table per depth, so it
+  // costs a single lookup per channel; brightness is still the matrix's.
+  void begin() {
+    for (uint16_t v = 0; v < 256; v++) {
+      // Roughly the gamma the background layer's color correction applies.
+      float level = powf(v / 255.0f, 2.2f);
+      correct16_[v] = (uint16_t)(level * 65535.0f + 0.5f);
+      correct8_[v] = (uint8_t)(level * 255.0f + 0.5f);
+    }
+  }
+
+  // Shows |frame| on the panels in |pressed|, bit i for panel i, and black
+  // everywhere else. |frame| must stay valid until the next Show(); nullptr
+  // blanks every panel.
+  void Show(const rgb24* frame, uint32_t pressed) {
+    noInterrupts();
+    frame_ = frame;
+    pressed_ = frame == nullptr ? 0 : pressed;
+    interrupts();
+  }
+
+  void frameRefreshCallback() {}
+
+  void fillRefreshRow(uint16_t hardwareY, rgb48 refreshRow[],
+                      int brightnessShifts = 0) {
+    FillRow(hardwareY, refreshRow, correct16_);
+  }
+
+  void fillRefreshRow(uint16_t hardwareY, rgb24 refreshRow[],
+                      int brightnessShifts = 0) {
+    FillRow(hardwareY, refreshRow, correct8_);
+  }
+
+ private:
+  // Runs in the refresh interrupt, once per hardware row.
+  template <typename RGB, typename Level>
+  void FillRow(uint16_t y, RGB* row, const Level* correct) {
+    const rgb24* frame = frame_;
+    uint32_t pressed = pressed_;
+    for (size_t i = 0; i < kNumPanels; i++) {
+      RGB* out = &row[PanelX(i)];
+      if (!(pressed & (1u << i))) {
+        memset(out, 0, kPanelWidth * sizeof(RGB));
+        continue;
+      }
+      const rgb24* in = &frame[kMatrixWidth * y + FrameX(i)];
+      for (uint16_t x = 0; x < kPanelWidth; x++) {
+        out[x].red = correct[in[x].red];
+        out[x].green = correct[in[x].green];
+        out[x].blue = correct[in[x].blue];
+      }
+    }
+  }
+
+  const rgb24* volatile frame_ = nullptr;
+  volatile uint32_t pressed_ = 0;
+  uint16_t correct16_[256];
+  uint8_t correct8_[256];
+};
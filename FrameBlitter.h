@@ -0,0 +1,171 @@
+#if defined(__IMXRT1062__)
+  #include <DMAChannel.h>
+#endif
+
+// Panel rows are whole cache lines as long as the buffers are aligned to
+// them, so a panel can be written by DMA while the CPU draws its neighbours.
+static_assert(kPanelWidth * sizeof(rgb24) % kCacheLine == 0 &&
+                  kMatrixWidth * sizeof(rgb24) % kCacheLine == 0,
+              "Panel rows must be whole cache lines");
+
+// Moves whole panels into the back buffer with eDMA instead of the CPU.
+//
+// A frame's blits are queued with AddCopy()/AddFill(), each one a single TCD
+// whose minor loop is one panel row and whose minor loop offset steps source
+// and destination on to the next matrix row. Start() chains them with
+// scatter-gather and sets the chain running; the CPU is then free until
+// Done() says the last one has finished.
+//
+// Cache discipline: sources are flushed before the chain starts, so the DMA
+// reads what the CPU wrote, and destinations are invalidated both before
+// (so no dirty line is written back over the DMA's data later) and after
+// (so no line the CPU speculatively loaded in the meantime is read instead).
+class FrameBlitter {
+ public:
+  // Whether panels in |buffer| can be blitted at all. Without DMA, or if the
+  // buffer isn't cache line aligned, everything stays on the CPU.
+  static bool CanBlitInto(const rgb24* buffer) {
+#if defined(__IMXRT1062__)
+    return ((uintptr_t)buffer & (kCacheLine - 1)) == 0;
+#else
+    return false;
+#endif
+  }
+
+  void Init() {
+#if defined(__IMXRT1062__)
+    dma_.begin();
+    // Memory to memory: the request is always on and the chain runs
+    // back to back until the last TCD turns it off.
+    dma_.triggerContinuously();
+#endif
+  }
+
+  void Begin() {
+    count_ = 0;
+  }
+
+  // A TCD has one minor loop offset for both sides, so rows of a frame and
+  // of the back buffer have to be the same length. With more than one pad
+  // the display is wider than a frame and copies stay on the CPU.
+  static const bool kCopiesFrames = kChainWidth == kMatrixWidth;
+
+  // Copies the |kMatrixHeight| rows of a panel, |src| and |dest| being the
+  // panel's first pixel in a frame and in the back buffer. Only with
+  // kCopiesFrames.
+  void AddCopy(const rgb24* src, rgb24* dest) {
+    Add(src, dest, kMatrixHeight, kMatrixHeight);
+  }
+
+  // Fills a panel with a copy of its first row, which the CPU has already
+  // drawn: every row is copied from the one above it, in order.
+  void AddFill(rgb24* dest) {
+    Add(dest, dest + kChainWidth, kMatrixHeight - 1, 1);
+  }
+
+  bool Empty() const {
+    return count_ == 0;
+  }
+
+  void Start() {
+    if (count_ == 0) return;
+#if defined(__IMXRT1062__)
+    for (size_t i = 0; i < count_; i++) {
+      Blit& blit = blits_[i];
+      FlushRows(blit.src, blit.source_rows);
+      FlushDeleteRows(blit.dest, blit.rows);
+      if (i + 1 < count_) {
+        settings_[i].replaceSettingsOnCompletion(settings_[i + 1]);
+      } else {
+        settings_[i].disableOnCompletion();
+      }
+    }
+    dma_ = settings_[0];
+    running_ = true;
+    dma_.enable();
+#endif
+  }
+
+  // Whether the chain has finished. Must be polled until it returns true
+  // before the back buffer is shown.
+  bool Done() {
+#if defined(__IMXRT1062__)
+    if (!running_) return true;
+    // The last TCD clears the channel's request when it completes.
+    if (DMA_ERQ & (1 << dma_.channel)) return false;
+    for (size_t i = 0; i < count_; i++) {
+      DeleteRows(blits_[i].dest, blits_[i].rows);
+    }
+    running_ = false;
+#endif
+    return true;
+  }
+
+  void Wait() {
+    while (!Done()) {}
+  }
+
+ private:
+  struct Blit {
+    const rgb24* src;
+    rgb24* dest;
+    uint16_t rows;
+    // Source rows the CPU may have written that have to reach memory first:
+    // the whole panel for a copy, the first row for a fill.
+    uint16_t source_rows;
+  };
+
+  void Add(const rgb24* src, rgb24* dest, uint16_t rows, uint16_t source_rows) {
+    if (count_ == kNumPanels) return;
+    blits_[count_] = { src, dest, rows, source_rows };
+#if defined(__IMXRT1062__)
+    const uint32_t row_bytes = kPanelWidth * sizeof(rgb24);
+    const int32_t skip = (kChainWidth - kPanelWidth) * sizeof(rgb24);
+    DMABaseClass::TCD_t* tcd = settings_[count_].TCD;
+    tcd->SADDR = src;
+    tcd->SOFF = kCacheLine;
+    // 32-byte bursts on both sides.
+    tcd->ATTR = DMA_TCD_ATTR_SSIZE(5) | DMA_TCD_ATTR_DSIZE(5);
+    tcd->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE | DMA_TCD_NBYTES_DMLOE |
+                           DMA_TCD_NBYTES_MLOFFYES_MLOFF(skip) |
+                           DMA_TCD_NBYTES_MLOFFYES_NBYTES(row_bytes);
+    tcd->SLAST = 0;
+    tcd->DADDR = dest;
+    tcd->DOFF = kCacheLine;
+    tcd->CITER_ELINKNO = rows;
+    tcd->BITER_ELINKNO = rows;
+    tcd->DLASTSGA = 0;
+    tcd->CSR = 0;
+#endif
+    count_++;
+  }
+
+#if defined(__IMXRT1062__)
+  static void FlushRows(const rgb24* first, uint16_t rows) {
+    for (uint16_t y = 0; y < rows; y++) {
+      arm_dcache_flush((void*)(first + kChainWidth * y),
+                       kPanelWidth * sizeof(rgb24));
+    }
+  }
+
+  static void FlushDeleteRows(rgb24* first, uint16_t rows) {
+    for (uint16_t y = 0; y < rows; y++) {
+      arm_dcache_flush_delete(first + kChainWidth * y,
+                              kPanelWidth * sizeof(rgb24));
+    }
+  }
+
+  static void DeleteRows(rgb24* first, uint16_t rows) {
+    for (uint16_t y = 0; y < rows; y++) {
+      arm_dcache_delete(first + kChainWidth * y, kPanelWidth * sizeof(rgb24));
+    }
+  }
+
+  DMAChannel dma_;
+  DMASetting settings_[kNumPanels];
+  bool running_ = false;
+#endif
+
+  Blit blits_[kNumPanels];
+  size_t count_ = 0;
+};
@@ -0,0 +1,211 @@
+#include <LittleFS.h>
+
+// Amount of program flash reserved for the decoded frame cache. A full static
+// tier is kFrameStoreBytes (~288KB) plus the index, so this leaves room for
+// LittleFS metadata and wear leveling.
+const uint32_t kFrameCacheSize = 1024 * 1024;
+// Largest entry that is written. Animations that fill the OCRAM heap or PSRAM
+// tiers can be far larger than the cache and aren't kept.
+const uint32_t kFrameCacheMaxEntry = kFrameCacheSize * 3 / 4;
+// Bytes written to flash per Step(). Programming them takes a few
+// milliseconds, a little more when a step starts a sector that has to be
+// erased first, and code running from flash stalls for all of it, the
+// sensor loop included. So Step() is only called once no panel has been
+// pressed for kFrameCacheQuietMs, see LedPanel::Prefetch().
+const size_t kFrameCacheChunk = 1024;
+const unsigned long kFrameCacheQuietMs = 1000;
+
+// Persists the decoded, panel-mapped frames in program flash so that boot and
+// re-uploads of the same GIF can skip decoding entirely.
+//
+// The cache holds a single entry keyed by a hash of the source file contents
+// and of the panel layout, so changing kPanelPositions and friends invalidates
+// it automatically.
+//
+// Store() only starts writing an entry, Step() writes it a chunk at a time
+// from loop(). The store must not change until the entry is done, so
+// whatever is about to overwrite it calls Cancel() first.
+class FrameCache {
+ public:
+  FrameCache() : ready_(false), writing_(false) {}
+
+  void Init() {
+    ready_ = fs_.begin(kFrameCacheSize);
+    if (!ready_) {
+      Serial.println("Frame cache unavailable");
+    }
+  }
+
+  // 32-bit FNV-1a, cheap enough to run over a whole GIF on every upload.
+  static uint32_t Hash(const uint8_t* data, size_t len,
+                       uint32_t hash = 2166136261UL) {
+    for (size_t i = 0; i < len; i++) {
+      hash = (hash ^ data[i]) * 16777619UL;
+    }
+    return hash;
+  }
+
+  // Restores the cached entry if it was stored for |key|. Passing 0 accepts
+  // whatever entry is cached, which is how the last uploaded animation is
+  // brought back after a power cycle.
+  bool Load(uint32_t key, FrameStore* store) {
+    // The store is about to be overwritten, and an entry still being written
+    // isn't whole yet anyway.
+    Cancel();
+    if (!ready_) return false;
+    File file = fs_.open(kPath, FILE_READ);
+    if (!file) return false;
+
+    Header header;
+    bool ok = file.read(&header, sizeof(header)) == sizeof(header) &&
+              header.magic == kMagic &&
+              header.layout == LayoutHash() &&
+              (key == 0 || header.key == key) &&
+              header.frames > 0 && header.frames <= maxFrames;
+    for (size_t t = 0; ok && t < kNumFrameTiers; t++) {
+      // A tier that is missing or smaller than when the entry was stored.
+      ok = header.used[t] <= store->size((FrameTier)t);
+    }
+    // The store is kept the way it is in RAM, so it comes back with a bulk
+    // read per tier and no per-pixel work.
+    ok = ok && ReadFully(file, (uint8_t*)store->entries(),
+                         header.frames * sizeof(FrameStore::Entry));
+    for (size_t t = 0; ok && t < kNumFrameTiers; t++) {
+      ok = ReadFully(file, store->data((FrameTier)t), header.used[t]);
+    }
+    file.close();
+    return ok && store->Adopt(header.frames, header.used);
+  }
+
+  // Starts writing |store| as the entry for |key|. A store too large to
+  // cache leaves the old entry in place. Otherwise the old entry is gone
+  // from here on, and the new one only loads once Step() has written all of
+  // it.
+  void Store(uint32_t key, const FrameStore& store) {
+    Cancel();
+    if (!ready_ || store.frames() == 0) return;
+    size_t index_bytes = store.frames() * sizeof(FrameStore::Entry);
+    if (sizeof(Header) + index_bytes + store.bytes() > kFrameCacheMaxEntry) {
+      Serial.println("Animation too large to cache");
+      return;
+    }
+    // FILE_WRITE appends, so drop the old entry first.
+    fs_.remove(kPath);
+    file_ = fs_.open(kPath, FILE_WRITE);
+    if (!file_) return;
+
+    header_ = { kMagic, key, LayoutHash(), (uint32_t)store.frames() };
+    for (size_t t = 0; t < kNumFrameTiers; t++) {
+      header_.used[t] = store.used((FrameTier)t);
+    }
+    // The magic goes in last, so that an entry cut short by a reset never
+    // loads.
+    Header blank = header_;
+    blank.magic = 0;
+    store_ = &store;
+    part_ = 0;
+    written_ = 0;
+    writing_ = true;
+    if (file_.write(&blank, sizeof(blank)) != sizeof(blank)) Fail();
+  }
+
+  // Writes the next kFrameCacheChunk bytes of the entry Store() started:
+  // the frame index, then each tier's bytes. Does nothing if none is being
+  // written.
+  void Step() {
+    if (!writing_) return;
+    size_t len;
+    const uint8_t* data = Part(part_, &len);
+    while (written_ == len && part_ < kNumFrameTiers) {
+      part_++;
+      written_ = 0;
+      data = Part(part_, &len);
+    }
+    if (written_ == len) {
+      bool ok = file_.seek(0) &&
+                file_.write(&header_, sizeof(header_)) == sizeof(header_);
+      file_.close();
+      writing_ = false;
+      if (!ok) Fail();
+      return;
+    }
+    size_t chunk = min(len - written_, kFrameCacheChunk);
+    if (file_.write(data + written_, chunk) != chunk) {
+      Fail();
+      return;
+    }
+    written_ += chunk;
+  }
+
+  bool Writing() const { return writing_; }
+
+  // Drops the entry being written, if any.
+  void Cancel() {
+    if (!writing_) return;
+    file_.close();
+    fs_.remove(kPath);
+    writing_ = false;
+  }
+
+  // Identifies the panel layout. tools/mkasset.py computes the same value so
+  // that prebuilt assets can be checked against it.
+  static uint32_t LayoutHash() {
+    uint32_t hash = Hash((const uint8_t*)kPanelPositions,
+                         sizeof(kPanelPositions));
+    hash = Hash((const uint8_t*)kPanelFlipped, sizeof(kPanelFlipped), hash);
+    hash = Hash((const uint8_t*)kPanelRotation, sizeof(kPanelRotation), hash);
+    const uint16_t size[] = { kMatrixWidth, kMatrixHeight };
+    return Hash((const uint8_t*)size, sizeof(size), hash);
+  }
+
+ private:
+  struct Header {
+    uint32_t magic;
+    uint32_t key;
+    uint32_t layout;
+    uint32_t frames;
+    // Bytes of the keyframe and deltas in each tier.
+    uint32_t used[kNumFrameTiers];
+  };
+
+  // Part 0 of an entry after its header is the frame index, part t + 1 is
+  // tier t.
+  const uint8_t* Part(size_t part, size_t* len) const {
+    if (part == 0) {
+      *len = header_.frames * sizeof(FrameStore::Entry);
+      return (const uint8_t*)store_->entries();
+    }
+    *len = header_.used[part - 1];
+    return store_->data((FrameTier)(part - 1));
+  }
+
+  void Fail() {
+    Cancel();
+    // Never leave a truncated entry behind for the next boot.
+    Serial.println("Frame cache write failed");
+  }
+
+  static bool ReadFully(File& file, uint8_t* dest, size_t len) {
+    while (len > 0) {
+      int result = file.read(dest, len);
+      if (result <= 0) return false;
+      dest += result;
+      len -= result;
+    }
+    return true;
+  }
+
+  static const uint32_t kMagic = 0x3346504c;  // "LPF3"
+  static constexpr const char* kPath = "/frames.bin";
+
+  LittleFS_Program fs_;
+  bool ready_;
+
+  // The entry being written, see Step().
+  bool writing_;
+  File file_;
+  Header header_;
+  const FrameStore* store_;
+  size_t part_;
+  size_t written_;
+};
@@ -0,0 +1,563 @@
+// Pixels in one animation frame.
+const size_t kFramePixels = kMatrixWidth * kMatrixHeight;
+// The part of the store that is always there: the RAM that 8 whole frames
+// used to take, less the two working frames.
+const size_t kFrameStoreBytes = 6 * kFrameBytes;
+// OCRAM left to the heap once the store has taken the rest, for the SD card,
+// files and the like.
+const size_t kHeapReserveBytes = 32 * 1024;
+// PSRAM not taken, for extmem_malloc()'s own bookkeeping.
+const size_t kExtReserveBytes = 64 * 1024;
+// Fast memory that deltas in PSRAM are copied into before they play. Room
+// for the largest delta, a frame that changed everywhere, and then some.
+const size_t kStageBytes = kFrameBytes + 16 * 1024;
+// Most deltas Prefetch() keeps ahead of playback.
+const size_t kStagedFrames = 8;
+// Most bytes Prefetch() copies per call, so that the loop never waits on
+// PSRAM for long.
+const size_t kPrefetchBytes = 4096;
+// Most bytes Prepare() applies between looks at the clock. Small enough to
+// read from PSRAM well within a render slice.
+const size_t kApplyBytes = 2048;
+
+static_assert(kFramePixels <= 0xffff, "Delta spans count pixels in 16 bits");
+
+// The memory frames are kept in, fastest first.
+enum FrameTier : uint8_t {
+  // OCRAM, part of the store itself.
+  kStaticTier,
+  // Whatever OCRAM the heap has left at boot, see Init().
+  kHeapTier,
+  // PSRAM on EXTMEM, when one is fitted.
+  kExtTier,
+  kNumFrameTiers
+};
+
+// Holds the animation as its first frame plus, for every frame, a delta from
+// the frame before it, the first frame's delta being from the last one.
+//
+// A delta is a list of the spans of pixels that changed: pixels to skip and
+// pixels to replace, both uint16_t, followed by the replacements. Step
+// animations change a fraction of the pixels from one frame to the next, so
+// a delta is a fraction of a frame, and far more frames fit than the 8 whole
+// ones that used to.
+//
+// Deltas go into the fastest tier with room for them. The keyframe is always
+// in the static tier. Prefetch() copies the deltas of the frames about to
+// play out of PSRAM into a stage in OCRAM, so that Next() doesn't wait on
+// PSRAM unless Prefetch() fell behind.
+//
+// A frame whose delta would be no smaller than the frame itself is kept
+// whole instead.
+//
+// Playback keeps two working frames and brings the one that isn't on screen
+// up to the next frame by applying the deltas in between, so moving on only
+// touches the pixels that changed. The frame on screen is never written to,
+// the refresh or the blitter may still be reading it. Prepare() does that a
+// slice at a time, so that Next() needn't.
+class FrameStore {
+ public:
+  // Where frame k's delta is: |offset| bytes into data(|tier|). kWholeFrame
+  // means the keyframe is copied instead, for a loop back to the start whose
+  // delta didn't fit. kRawFrame means the kFrameBytes there are the frame
+  // itself.
+  struct Entry {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t delay_ms;
+    uint32_t tier;
+  };
+  static const uint32_t kWholeFrame = 0xffffffff;
+  static const uint32_t kRawFrame = 0xfffffffe;
+
+  FrameStore() {
+    tiers_[kStaticTier] = { data_, kFrameStoreBytes, 0 };
+  }
+
+  // Takes the OCRAM the heap has left and the PSRAM, if fitted, as tiers.
+  // Call once at boot, before anything is stored.
+  void Init() {
+#if defined(__IMXRT1062__)
+    // The stage comes first, it is no use without PSRAM.
+    if (external_psram_size > 0) {
+      size_t size = external_psram_size * 1048576 - kExtReserveBytes;
+      uint8_t* ext = (uint8_t*)extmem_malloc(size);
+      uint8_t* stage = (uint8_t*)malloc(kStageBytes + kCacheLine);
+      if (ext != nullptr && stage != nullptr) {
+        SetStage(Align(stage, nullptr));
+        ext = Align(ext, &size);
+        SetTier(kExtTier, ext, size);
+      }
+    }
+    size_t left = kOcramEnd - (uintptr_t)sbrk(0);
+    if (left > kHeapReserveBytes + kFrameBytes) {
+      size_t size = left - kHeapReserveBytes;
+      uint8_t* heap = (uint8_t*)malloc(size);
+      if (heap != nullptr) SetTier(kHeapTier, Align(heap, &size), size);
+    }
+#endif
+  }
+
+  // Gives the store |size| bytes at |base| as |tier|, which mustn't be
+  // kStaticTier. Drops the stored frames.
+  void SetTier(FrameTier tier, uint8_t* base, size_t size) {
+    tiers_[tier] = { base, size, 0 };
+    Begin();
+  }
+
+  // Where Prefetch() copies deltas to, kStageBytes of fast memory. Without
+  // one, deltas in PSRAM are read from there as they play.
+  void SetStage(uint8_t* stage) { stage_ = stage; }
+
+  // Drops the stored frames, so that new ones can be added. With |spare|, a
+  // frame at the end of the static tier is kept out of the way until End(),
+  // see Spare().
+  void Begin(bool spare = false) {
+    frames_ = 0;
+    for (Tier& tier : tiers_) tier.used = 0;
+    spare_ = spare;
+    Rewind();
+  }
+
+  // Where the next frame to add is drawn. It keeps what was drawn into it, so
+  // a frame can be drawn over the one before.
+  rgb24* Canvas() { return work_[1]; }
+
+  // A frame of scratch space until End(), nullptr unless Begin(true).
+  rgb24* Spare() {
+    if (!spare_) return nullptr;
+    return (rgb24*)&data_[kFrameStoreBytes - kFrameBytes];
+  }
+
+  // Stores what is on Canvas() as the next frame. Returns false, and stores
+  // nothing, once the store is full.
+  bool Add(uint32_t delay_ms) {
+    if (frames_ >= maxFrames) return false;
+    Entry* entry = &entries_[frames_];
+    entry->delay_ms = delay_ms;
+    if (frames_ == 0) {
+      memcpy(data_, Canvas(), kFrameBytes);
+      tiers_[kStaticTier].used = kFrameBytes;
+      // Filled in by End().
+      entry->offset = entry->length = 0;
+      entry->tier = kStaticTier;
+      memcpy(work_[0], Canvas(), kFrameBytes);
+    } else {
+      // work_[0] holds the last frame added.
+      if (!Encode(work_[0], Canvas(), entry)) return false;
+      Apply(*entry, Source(*entry), work_[0]);
+    }
+    frames_++;
+    return true;
+  }
+
+  // Adds the delta back to the first frame and starts playback from there.
+  // Returns false if no frame was added.
+  bool End() {
+    spare_ = false;
+    if (frames_ == 0) return false;
+    if (!Encode(work_[0], Keyframe(), &entries_[0])) {
+      entries_[0] = { 0, kWholeFrame, entries_[0].delay_ms, kStaticTier };
+    }
+    Rewind();
+    return true;
+  }
+
+  // Hands the static tier out as |count| whole frames, e.g. for the slots of
+  // an AnimationStream. Drops the stored frames.
+  rgb24* Scratch(size_t count) {
+    if (count * kFrameBytes > kFrameStoreBytes) return nullptr;
+    Begin();
+    return (rgb24*)data_;
+  }
+
+  size_t frames() const { return frames_; }
+  // Bytes of the keyframe and deltas in |tier|, and how many it can hold.
+  size_t used(FrameTier tier) const { return tiers_[tier].used; }
+  size_t size(FrameTier tier) const { return tiers_[tier].size; }
+  // All of them.
+  size_t bytes() const {
+    size_t bytes = 0;
+    for (const Tier& tier : tiers_) bytes += tier.used;
+    return bytes;
+  }
+
+  // The first frame, valid while frames() > 0.
+  const rgb24* Keyframe() const { return (const rgb24*)data_; }
+
+  // Returns the frame to show now and how long to show it for, and moves on
+  // to the following frame. The frame stays valid until the call after next,
+  // or the Prepare() before it. Applies whatever deltas Prepare() hasn't.
+  const rgb24* Next(size_t* delay) {
+    if (frames_ == 0) return nullptr;
+    Prepare(UINT32_MAX);
+    uint8_t buffer = 1 - shown_;
+    shown_ = buffer;
+    *delay = entries_[next_ % frames_].delay_ms;
+    next_++;
+    Release();
+    return work_[buffer];
+  }
+
+  // Applies the deltas that bring the working frame that isn't on screen up
+  // to the one Next() returns, kApplyBytes at a time, until they are all in
+  // or |budget_cycles| have passed. Returns whether they are all in. This
+  // writes over the frame Next() returned the time before last.
+  bool Prepare(uint32_t budget_cycles) {
+    if (frames_ == 0) return true;
+    uint8_t buffer = 1 - shown_;
+    uint32_t start = ARM_DWT_CYCCNT;
+    while (true) {
+      if (!applying_.active) {
+        if (applied_[buffer] == next_) return true;
+        uint32_t seq = applied_[buffer] + 1;
+        const Entry& entry = entries_[seq % frames_];
+        BeginApply(entry, Staged(seq, entry), work_[buffer]);
+      }
+      if (ContinueApply(kApplyBytes)) applied_[buffer]++;
+      if (ARM_DWT_CYCCNT - start >= budget_cycles) {
+        return !applying_.active && applied_[buffer] == next_;
+      }
+    }
+  }
+
+  // Copies up to kPrefetchBytes of the deltas in PSRAM that play next into
+  // the stage. Called from loop().
+  void Prefetch() {
+    if (stage_ == nullptr || frames_ < 2) return;
+    size_t budget = kPrefetchBytes;
+    while (budget > 0) {
+      // The newest delta is finished first.
+      if (staged_count_ > 0) {
+        StagedDelta& last = StagedAt(staged_first_ + staged_count_ - 1);
+        if (last.copied < last.length) {
+          const Entry& entry = entries_[last.seq % frames_];
+          size_t n = min(budget, (size_t)(last.length - last.copied));
+          memcpy(&stage_[last.offset + last.copied],
+                 Source(entry) + last.copied, n);
+          last.copied += n;
+          budget -= n;
+          continue;
+        }
+      }
+      if (staged_count_ == kStagedFrames) return;
+      uint32_t seq = staged_first_ + staged_count_;
+      const Entry& entry = entries_[seq % frames_];
+      StagedDelta& next = StagedAt(seq);
+      next.seq = seq;
+      next.copied = 0;
+      // Everything else is in OCRAM already.
+      next.length = entry.tier == kExtTier ? Bytes(entry) : 0;
+      if (next.length > 0 && !Reserve(next.length, &next.offset)) return;
+      staged_count_++;
+    }
+  }
+
+  // Deltas Next() had to read from PSRAM since the last Rewind(), because
+  // Prefetch() hadn't staged them yet.
+  uint32_t misses() const { return misses_; }
+
+  // Goes back to the first frame.
+  void Rewind() {
+    if (frames_ > 0) {
+      memcpy(work_[0], Keyframe(), kFrameBytes);
+      memcpy(work_[1], Keyframe(), kFrameBytes);
+    }
+    applied_[0] = applied_[1] = 0;
+    applying_.active = false;
+    shown_ = 1;
+    next_ = 0;
+    // Frame 0 is the keyframe, the first delta applied is frame 1's.
+    staged_first_ = 1;
+    staged_count_ = 0;
+    misses_ = 0;
+  }
+
+  // For FrameCache: the index and each tier's keyframe and deltas as they
+  // are kept. Once they are filled in from elsewhere, Adopt() checks them and
+  // starts playback.
+  Entry* entries() { return entries_; }
+  uint8_t* data(FrameTier tier) { return tiers_[tier].base; }
+  const Entry* entries() const { return entries_; }
+  const uint8_t* data(FrameTier tier) const { return tiers_[tier].base; }
+
+  // |used| holds the bytes of every tier.
+  bool Adopt(size_t frames, const uint32_t* used) {
+    Begin();
+    if (frames == 0 || frames > maxFrames || used[kStaticTier] < kFrameBytes) {
+      return false;
+    }
+    for (size_t t = 0; t < kNumFrameTiers; t++) {
+      if (used[t] > tiers_[t].size) return false;
+    }
+    for (size_t i = 0; i < frames; i++) {
+      if (i == 0 && entries_[0].length == kWholeFrame) continue;
+      if (!Valid(entries_[i], used)) return false;
+    }
+    frames_ = frames;
+    for (size_t t = 0; t < kNumFrameTiers; t++) tiers_[t].used = used[t];
+    Rewind();
+    return true;
+  }
+
+ private:
+  struct Tier {
+    uint8_t* base;
+    size_t size;
+    size_t used;
+  };
+
+  // The delta Prepare() is part way through.
+  struct Applying {
+    bool active;
+    const uint8_t* in;
+    const uint8_t* end;
+    rgb24* out;
+    // Pixels left of the span being copied.
+    size_t left;
+  };
+
+  // A delta on the stage, or on its way there.
+  struct StagedDelta {
+    uint32_t seq;
+    uint32_t offset;
+    // 0 for one that isn't in PSRAM and is read from where it is.
+    uint32_t length;
+    uint32_t copied;
+  };
+
+  // Rounds |base| up to a cache line, so that frames in it can be blitted,
+  // and takes what that skips off |size|.
+  static uint8_t* Align(uint8_t* base, size_t* size) {
+    size_t skip = -(uintptr_t)base & (kCacheLine - 1);
+    if (size != nullptr) *size -= skip;
+    return base + skip;
+  }
+
+  static bool Same(const rgb24& a, const rgb24& b) {
+    return a.red == b.red && a.green == b.green && a.blue == b.blue;
+  }
+
+  // Appends the delta from |from| to |to| to the fastest tier it fits in.
+  // Returns false if it fits in none.
+  bool Encode(const rgb24* from, const rgb24* to, Entry* entry) {
+    for (size_t t = 0; t < kNumFrameTiers; t++) {
+      if (EncodeInto((FrameTier)t, from, to, entry)) return true;
+    }
+    return false;
+  }
+
+  bool EncodeInto(FrameTier t, const rgb24* from, const rgb24* to,
+                  Entry* entry) {
+    Tier& tier = tiers_[t];
+    size_t limit = tier.size;
+    if (t == kStaticTier && spare_) limit -= kFrameBytes;
+    size_t out = tier.used;
+    size_t i = 0, last = 0;
+    while (true) {
+      while (i < kFramePixels && Same(from[i], to[i])) i++;
+      if (i == kFramePixels) break;
+      // One unchanged pixel costs less than starting another span.
+      size_t start = i, end = i + 1;
+      for (i = end; i < kFramePixels && i < end + 2; i++) {
+        if (!Same(from[i], to[i])) end = i + 1;
+      }
+      i = end;
+      uint16_t span[2] = { (uint16_t)(start - last),
+                           (uint16_t)(end - start) };
+      size_t length = sizeof(span) + (end - start) * sizeof(rgb24);
+      // A delta that doesn't fit is larger than the frame too, if that
+      // fits.
+      if (out + length - tier.used >= kFrameBytes || out + length > limit) {
+        return EncodeRaw(t, to, limit, entry);
+      }
+      memcpy(&tier.base[out], span, sizeof(span));
+      memcpy(&tier.base[out + sizeof(span)], &to[start],
+             (end - start) * sizeof(rgb24));
+      out += length;
+      last = end;
+    }
+    entry->offset = tier.used;
+    entry->length = out - tier.used;
+    entry->tier = t;
+    tier.used = out;
+    return true;
+  }
+
+  // Stores |to| as it is.
+  bool EncodeRaw(FrameTier t, const rgb24* to, size_t limit, Entry* entry) {
+    Tier& tier = tiers_[t];
+    if (tier.used + kFrameBytes > limit) return false;
+    memcpy(&tier.base[tier.used], to, kFrameBytes);
+    entry->offset = tier.used;
+    entry->length = kRawFrame;
+    entry->tier = t;
+    tier.used += kFrameBytes;
+    return true;
+  }
+
+  const uint8_t* Source(const Entry& entry) const {
+    return &tiers_[entry.tier].base[entry.offset];
+  }
+
+  // Bytes |entry| takes in its tier.
+  static uint32_t Bytes(const Entry& entry) {
+    return entry.length == kRawFrame ? kFrameBytes : entry.length;
+  }
+
+  void Apply(const Entry& entry, const uint8_t* in, rgb24* frame) {
+    BeginApply(entry, in, frame);
+    ContinueApply(SIZE_MAX);
+  }
+
+  // Starts applying |entry|, read from |in|, to |frame|.
+  void BeginApply(const Entry& entry, const uint8_t* in, rgb24* frame) {
+    applying_.active = true;
+    applying_.out = frame;
+    applying_.left = 0;
+    if (entry.length == kWholeFrame || entry.length == kRawFrame) {
+      // One span with no header, the whole frame.
+      applying_.in = entry.length == kWholeFrame ? (const uint8_t*)Keyframe()
+                                                 : in;
+      applying_.end = applying_.in + kFrameBytes;
+      applying_.left = kFramePixels;
+    } else {
+      applying_.in = in;
+      applying_.end = in + entry.length;
+    }
+  }
+
+  // Copies up to |max_bytes| more of the delta BeginApply() started, at
+  // least a pixel. Returns true once all of it is in.
+  bool ContinueApply(size_t max_bytes) {
+    Applying& a = applying_;
+    while (true) {
+      if (a.left == 0) {
+        if (a.in >= a.end) {
+          a.active = false;
+          return true;
+        }
+        uint16_t span[2];
+        memcpy(span, a.in, sizeof(span));
+        a.in += sizeof(span);
+        a.out += span[0];
+        a.left = span[1];
+        continue;
+      }
+      if (max_bytes < sizeof(rgb24)) return false;
+      size_t n = min(a.left, max_bytes / sizeof(rgb24));
+      memcpy(a.out, a.in, n * sizeof(rgb24));
+      a.out += n;
+      a.in += n * sizeof(rgb24);
+      a.left -= n;
+      max_bytes -= n * sizeof(rgb24);
+    }
+  }
+
+  // Whether a delta stays within the |used| bytes of its tier, clear of the
+  // keyframe, and its spans within a frame.
+  bool Valid(const Entry& entry, const uint32_t* used) const {
+    if (entry.tier >= kNumFrameTiers ||
+        (entry.tier == kStaticTier && entry.offset < kFrameBytes) ||
+        entry.offset > used[entry.tier] ||
+        Bytes(entry) > used[entry.tier] - entry.offset) {
+      return false;
+    }
+    if (entry.length == kRawFrame) return true;
+    const uint8_t* data = tiers_[entry.tier].base;
+    size_t at = entry.offset, end = entry.offset + entry.length;
+    size_t pixel = 0;
+    while (at < end) {
+      uint16_t span[2];
+      if (end - at < sizeof(span)) return false;
+      memcpy(span, &data[at], sizeof(span));
+      at += sizeof(span) + span[1] * sizeof(rgb24);
+      pixel += span[0] + span[1];
+      if (at > end || pixel > kFramePixels) return false;
+    }
+    return true;
+  }
+
+  StagedDelta& StagedAt(uint32_t seq) {
+    return staged_[seq % kStagedFrames];
+  }
+
+  // Where the delta applied as |seq| is read from: the stage if Prefetch()
+  // has copied all of it there, otherwise where it is kept.
+  const uint8_t* Staged(uint32_t seq, const Entry& entry) {
+    if (entry.tier != kExtTier || entry.length == kWholeFrame) {
+      return Source(entry);
+    }
+    if (seq - staged_first_ < staged_count_) {
+      const StagedDelta& staged = StagedAt(seq);
+      if (staged.copied == staged.length) return &stage_[staged.offset];
+    }
+    misses_++;
+    return Source(entry);
+  }
+
+  // Drops the staged deltas both working frames have applied.
+  void Release() {
+    uint32_t done = min(applied_[0], applied_[1]);
+    while (staged_count_ > 0 && staged_first_ <= done) {
+      staged_first_++;
+      staged_count_--;
+    }
+    // Nothing staged yet, catch up with playback.
+    if (staged_count_ == 0 && staged_first_ <= done) staged_first_ = done + 1;
+  }
+
+  // Finds |length| free bytes on the stage. Deltas are put there in the order
+  // they play and dropped in the same order, so the free space is what lies
+  // between the newest and the oldest.
+  bool Reserve(uint32_t length, uint32_t* offset) {
+    const StagedDelta* oldest = nullptr;
+    const StagedDelta* newest = nullptr;
+    for (uint32_t i = 0; i < staged_count_; i++) {
+      const StagedDelta& staged = StagedAt(staged_first_ + i);
+      if (staged.length == 0) continue;
+      if (oldest == nullptr) oldest = &staged;
+      newest = &staged;
+    }
+    if (oldest == nullptr) {
+      *offset = 0;
+      return length <= kStageBytes;
+    }
+    uint32_t tail = newest->offset + newest->length;
+    if (newest->offset >= oldest->offset) {
+      if (tail + length <= kStageBytes) {
+        *offset = tail;
+        return true;
+      }
+      *offset = 0;
+      return length <= oldest->offset;
+    }
+    *offset = tail;
+    return tail + length <= oldest->offset;
+  }
+
+  // First, so that both stay aligned for the blitter.
+  alignas(kCacheLine) rgb24 work_[2][kFramePixels];
+  // The static tier: the keyframe, then deltas.
+  alignas(kCacheLine) uint8_t data_[kFrameStoreBytes];
+  Entry entries_[maxFrames];
+  Tier tiers_[kNumFrameTiers] = {};
+  size_t frames_ = 0;
+  // Whether the end of the static tier is lent out as Spare().
+  bool spare_ = false;
+
+  // Playback counts the deltas applied since Rewind(), frame k's being
+  // applied as every count that is k modulo frames(): how far each working
+  // frame has got, which one is on screen and the count Next() shows.
+  uint32_t applied_[2] = {};
+  Applying applying_ = {};
+  uint8_t shown_ = 1;
+  uint32_t next_ = 0;
+
+  uint8_t* stage_ = nullptr;
+  // The deltas on the stage, in the order they play from |staged_first_|.
+  StagedDelta staged_[kStagedFrames];
+  uint32_t staged_first_ = 1;
+  uint32_t staged_count_ = 0;
+  uint32_t misses_ = 0;
+};
@@ -0,0 +1,72 @@
+// Feeds PanelGif::Decoder an upload straight out of the serial receive ring,
+// while it arrives.
+//
+// Reads are served from the bytes in the ring without taking them out of it,
+// and Mark() takes out what the decoder is done with. When the decoder needs
+// bytes that haven't arrived yet it goes back to its last Mark() and tries
+// again from a later loop(), so at most PanelGif::kMaxUnmarked bytes of the
+// file are ever held, and they are only copied into the decoder's own
+// buffers.
+class GifReader {
+ public:
+  void Begin(SerialRing* ring, size_t size) {
+    ring_ = ring;
+    size_ = size;
+    marked_ = position_ = 0;
+    waiting_ = false;
+    hash_ = FrameCache::Hash(nullptr, 0);
+  }
+
+  int ReadBlock(void* buffer, int count) {
+    uint8_t* out = (uint8_t*)buffer;
+    size_t want = min((size_t)count, size_ - position_);
+    size_t done = 0;
+    while (done < want) {
+      size_t length;
+      const uint8_t* data = ring_->Peek(position_ - marked_, want - done,
+                                        &length);
+      if (length == 0) break;
+      memcpy(out + done, data, length);
+      done += length;
+      position_ += length;
+    }
+    waiting_ = done < (size_t)count && position_ < size_;
+    return done;
+  }
+
+  void Mark() {
+    size_t count = position_ - marked_;
+    while (count > 0) {
+      size_t length;
+      const uint8_t* data = ring_->Peek(count, &length);
+      hash_ = FrameCache::Hash(data, length, hash_);
+      ring_->Consume(length);
+      count -= length;
+    }
+    marked_ = position_;
+  }
+
+  void Rewind() { position_ = marked_; }
+
+  // Whether the last short read stopped at bytes that haven't arrived yet.
+  bool Waiting() const { return waiting_; }
+
+  // The bytes of the file that weren't taken out of the ring yet, whether
+  // they arrived or not.
+  size_t Left() const { return size_ - marked_; }
+
+  // FrameCache::Hash() of the bytes taken out so far.
+  uint32_t Hash() const { return hash_; }
+
+ private:
+  static_assert(kSerialRingSize >= PanelGif::kMaxUnmarked,
+                "The decoder has to be able to read that far ahead");
+
+  SerialRing* ring_ = nullptr;
+  size_t size_ = 0;
+  // File offsets of the last Mark() and of the next read.
+  size_t marked_ = 0;
+  size_t position_ = 0;
+  bool waiting_ = false;
+  uint32_t hash_ = 0;
+};
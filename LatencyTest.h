@@ -0,0 +1,181 @@
+// Runs of the synthetic step response that "y" keeps, at most.
+const uint16_t kMaxLatencyRuns = 200;
+// Samples of no pressure before every step: enough for any filter to settle
+// and for the button to be released.
+const uint16_t kLatencySettleSamples = 500;
+// A step that hasn't pressed the button after this many samples is counted
+// as a timeout, e.g. because the sensor's threshold is above full scale.
+const uint16_t kLatencyTimeoutSamples = 5000;
+
+// Measures the firmware's own input latency with synthetic steps.
+//
+// While a test runs, one sensor's ADC results are replaced: first zero for
+// kLatencySettleSamples samples, then full scale until the button presses and
+// the next HID report has gone out. Every run records the samples and the
+// time from the first full-scale sample to ButtonPress(), and the time on to
+// Joystick.send_now(). The runs are repeated and printed as a distribution.
+//
+// Everything in between, the filters, thresholds and the loop's report
+// pacing, is the real code with its current configuration, so the numbers
+// move with every firmware or configuration change. What comes before the
+// ADC (the FSR) and after the report (USB polling, the game) is not
+// included.
+class LatencyTest {
+ public:
+  // Starts |runs| steps on the sensor on |pin|, which feeds |button|.
+  void Start(uint8_t pin, uint8_t button, uint16_t runs) {
+    noInterrupts();
+    runs_ = min(runs, kMaxLatencyRuns);
+    run_ = 0;
+    timeouts_ = 0;
+    button_ = button;
+    pressed_ = false;
+    high_ = (1 << adcTuner.Resolution()) - 1;
+    BeginRun();
+    pin_ = pin;
+    interrupts();
+  }
+
+  bool Running() const { return pin_ != kNoPin; }
+
+  // Takes every ADC result of the sensor on |pin| and returns what the
+  // sensor path should see instead. Called from the sampling interrupt with
+  // CIC decimation.
+  inline int32_t Sample(uint8_t pin, int32_t raw) {
+    if (pin != pin_) return raw;
+    if (phase_ == kSettle) {
+      if (++samples_ < kLatencySettleSamples || pressed_) return 0;
+      phase_ = kStep;
+      samples_ = 0;
+      step_cycles_ = ARM_DWT_CYCCNT;
+    }
+    if (!press_seen_ && ++samples_ > kLatencyTimeoutSamples) {
+      timeouts_++;
+      NextRun();
+      return 0;
+    }
+    return high_;
+  }
+
+  // Called from ButtonPress() and ButtonRelease().
+  inline void OnButton(uint8_t button, bool pressed) {
+    if (button != button_ || pin_ == kNoPin) return;
+    pressed_ = pressed;
+    if (!pressed || phase_ != kStep || press_seen_) return;
+    press_seen_ = true;
+    press_samples_[run_] = samples_;
+    press_cycles_[run_] = ARM_DWT_CYCCNT - step_cycles_;
+  }
+
+  // Called from loop() right after a HID report was sent. Sample() may time
+  // the run out and start the next one from the sampling interrupt, so the
+  // move to the next run is done with interrupts off.
+  inline void OnReport() {
+    if (pin_ == kNoPin || !press_seen_) return;
+    noInterrupts();
+    if (pin_ != kNoPin && press_seen_) {
+      report_cycles_[run_] = ARM_DWT_CYCCNT - step_cycles_;
+      run_++;
+      NextRun();
+    }
+    interrupts();
+  }
+
+  // Called from loop(). Prints the distribution once the last run is done.
+  void Loop() {
+    if (!done_) return;
+    done_ = false;
+    Print();
+  }
+
+  // Prints "y <runs> <timeouts>" followed by min, median, 90th and 99th
+  // percentiles and max of the samples to the press, and of the
+  // microseconds to the press and to the report:
+  //   "y samples <min> <p50> <p90> <p99> <max>"
+  //   "y press_us ..."
+  //   "y report_us ..."
+  void Print() {
+    uint16_t runs = run_;
+    Serial.print("y ");
+    Serial.print(runs);
+    Serial.print(" ");
+    Serial.print(timeouts_);
+    Serial.print("\n");
+    if (runs == 0) return;
+    Sort(press_samples_, runs);
+    Sort(press_cycles_, runs);
+    Sort(report_cycles_, runs);
+    PrintSpread("samples", press_samples_, runs, 1);
+    PrintSpread("press_us", press_cycles_, runs, F_CPU_ACTUAL / 1000000);
+    PrintSpread("report_us", report_cycles_, runs, F_CPU_ACTUAL / 1000000);
+  }
+
+ private:
+  static const uint8_t kNoPin = 0xff;
+  enum Phase : uint8_t { kSettle, kStep };
+
+  void BeginRun() {
+    phase_ = kSettle;
+    samples_ = 0;
+    press_seen_ = false;
+  }
+
+  void NextRun() {
+    if (run_ + timeouts_ >= runs_ || run_ >= kMaxLatencyRuns) {
+      pin_ = kNoPin;
+      done_ = true;
+      return;
+    }
+    BeginRun();
+  }
+
+  template <typename T>
+  static void Sort(volatile T* values, uint16_t count) {
+    for (uint16_t i = 1; i < count; i++) {
+      T value = values[i];
+      uint16_t j = i;
+      for (; j > 0 && values[j - 1] > value; j--) values[j] = values[j - 1];
+      values[j] = value;
+    }
+  }
+
+  template <typename T>
+  static void PrintSpread(const char* name, volatile T* sorted,
+                          uint16_t count, uint32_t divisor) {
+    const uint8_t kPercentiles[] = { 0, 50, 90, 99, 100 };
+    Serial.print("y ");
+    Serial.print(name);
+    for (uint8_t percentile : kPercentiles) {
+      uint16_t i = (uint32_t)(count - 1) * percentile / 100;
+      Serial.print(" ");
+      if (divisor == 1) {
+        Serial.print(sorted[i]);
+      } else {
+        Serial.print((float)sorted[i] / divisor, 2);
+      }
+    }
+    Serial.print("\n");
+  }
+
+  // The sensor under test, kNoPin when no test runs. Sample() checks only
+  // this, so an idle test costs one compare per sample.
+  volatile uint8_t pin_ = kNoPin;
+  uint8_t button_ = 0;
+  int32_t high_ = 0;
+  uint16_t runs_ = 0;
+  volatile uint16_t run_ = 0;
+  volatile uint16_t timeouts_ = 0;
+  volatile bool done_ = false;
+
+  volatile Phase phase_ = kSettle;
+  volatile uint16_t samples_ = 0;
+  volatile uint32_t step_cycles_ = 0;
+  volatile bool pressed_ = false;
+  volatile bool press_seen_ = false;
+
+  volatile uint16_t press_samples_[kMaxLatencyRuns];
+  volatile uint32_t press_cycles_[kMaxLatencyRuns];
+  volatile uint32_t report_cycles_[kMaxLatencyRuns];
+};
+
+LatencyTest latencyTest HOT_DATA;
@@ -1,28 +1,12 @@
 #include <MatrixHardware_Teensy4_ShieldV5.h>
 #include <SmartMatrix.h>
-#include <GifDecoder.h>
-#include "ldur.h"
-
-const uint16_t kPanelWidth = 64;
-const uint16_t kNumPanels = 4;
-//L, D, U, R
-const uint16_t kPanelPositions[] = {128, 64, 192, 0};
-const bool kPanelFlipped[] = {false, true, false, true};
-const int8_t kPanelRotation[] = {
-  0, 1, -1, 0,
-  1, 0, 0, 1,
-  1, 0, 0, 1,
-  0, 1, -1, 0
-};
+
+#include "PanelLayout.h"
 
 const int defaultBrightness = 255;
-const rgb24 COLOR_BLACK = {
-    0, 0, 0 };
 
 #define COLOR_DEPTH 24                  // Choose the color depth used for storing pixels in the layers: 24 or 48 (24 is good for most sketches - If the sketch uses type `rgb24` directly, COLOR_DEPTH must be 24)
 
-const uint16_t kMatrixWidth = kPanelWidth * kNumPanels;       // Set to the width of your display, must be a multiple of 8
-const uint16_t kMatrixHeight = 64;      // Set to the height of your display
 const uint8_t kRefreshDepth = 36;       // Tradeoff of color quality vs refresh rate, max brightness, and RAM usage.  36 is typically good, drop down to 24 if you need to.  On Teensy, multiples of 3, up to 48: 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48.  On ESP32: 24, 36, 48
 const uint8_t kDmaBufferRows = 4;       // known working: 2-4, use 2 to save RAM, more to keep from dropping frames and automatically lowering refresh rate.  (This isn't used on ESP32, leave as default)
 const uint8_t kPanelType = SM_PANELTYPE_HUB75_64ROW_MOD32SCAN;  // Choose the configuration that matches your panels.  See more details in MatrixCommonHUB75.h and the docs: https://github.com/pixelmatix/SmartMatrix/wiki
@@ -30,48 +14,55 @@ const uint32_t kMatrixOptions = (SM_HUB75_OPTIONS_NONE);        // see docs for
 const uint8_t kBackgroundLayerOptions = (SM_BACKGROUND_OPTIONS_NONE);
 const uint8_t kScrollingLayerOptions = (SM_SCROLLING_OPTIONS_NONE);
 
-SMARTMATRIX_ALLOCATE_BUFFERS(matrix, kMatrixWidth, kMatrixHeight, kRefreshDepth, kDmaBufferRows, kPanelType, kMatrixOptions);
-SMARTMATRIX_ALLOCATE_BACKGROUND_LAYER(backgroundLayer, kMatrixWidth, kMatrixHeight, COLOR_DEPTH, kBackgroundLayerOptions);
+// Uncomment to draw the animation straight from the frame store in the refresh
+// interrupt instead of compositing it into the background layer, see
+// DirectLayer.h. Saves the background layer's RAM and shows presses on the
+// next refresh row, but only pressed panels are lit: no fades, no idle layer
+// and no procedural modes.
+// #define LED_DIRECT_LAYER
+
+SMARTMATRIX_ALLOCATE_BUFFERS(matrix, kChainWidth, kMatrixHeight, kRefreshDepth, kDmaBufferRows, kPanelType, kMatrixOptions);
+#if defined(LED_DIRECT_LAYER)
+  #include "DirectLayer.h"
+  DirectLayer directLayer;
+#else
+  SMARTMATRIX_ALLOCATE_BACKGROUND_LAYER(backgroundLayer, kChainWidth, kMatrixHeight, COLOR_DEPTH, kBackgroundLayerOptions);
+#endif
+
+#include "RefreshMeter.h"
+RefreshMeter refreshMeter;
 
 
 SensorState::State currentStates[kNumPanels];
 
-const size_t maxFrames = 8;
-size_t current_frame = 0;
-size_t frames = maxFrames;
-int8_t tile = 1;
-rgb24 framesBuffer[kMatrixWidth * kMatrixHeight * maxFrames] DMAMEM;
-size_t frame_times[maxFrames];
-
-void screenClearCallback(void) {
-  //backgroundLayer.fillScreen({0,0,0});
-}
-void updateScreenCallback(void) {
-  //backgroundLayer.swapBuffers();
-}
-
-void drawPixelCallback(int16_t x, int16_t y, uint8_t red, uint8_t green, uint8_t blue) {
-  if (tile <= 2) {
-    int16_t index = x / kPanelWidth;
-    int16_t xpos = kPanelPositions[index] + (kPanelFlipped[index]? kPanelWidth - x % kPanelWidth : x % kPanelWidth);
-    int16_t ypos = (kPanelFlipped[index]? kMatrixHeight - y : y);
-    framesBuffer[kMatrixWidth * kMatrixHeight * current_frame + kMatrixWidth * ypos + xpos] = (rgb24){red, green, blue};
-    if (tile == 2) {
-      int16_t xpos1 = kPanelPositions[index + 2] + (kPanelFlipped[index + 2]? x % kPanelWidth : kPanelWidth - x % kPanelWidth);
-      int16_t ypos1 = (kPanelFlipped[index + 2]? y : kMatrixHeight - y);
-      framesBuffer[kMatrixWidth * kMatrixHeight * current_frame + kMatrixWidth * ypos1 + xpos1] = (rgb24){red, green, blue};
-    }
-  }
-  else if (tile == 4) {
-    for (int i = 0; i < 4; i++) {
-      int16_t xpos = x * kPanelRotation[4*i] + y * kPanelRotation[4*i + 1];
-      xpos = kPanelPositions[i] + (xpos + kPanelWidth) % kPanelWidth;
-      int16_t ypos = x * kPanelRotation[4*i + 2] + y * kPanelRotation[4*i + 3];
-      ypos = (ypos + kMatrixHeight) % kMatrixHeight;
-      framesBuffer[kMatrixWidth * kMatrixHeight * current_frame + kMatrixWidth * ypos + xpos] = (rgb24){red, green, blue};
-    }
-  }
-}
+#include "FrameStore.h"
+// Aligned to cache lines so that frames can be blitted, see FrameBlitter.h.
+FrameStore frameStore FRAME_DATA;
+
+#include "FrameCache.h"
+FrameCache frameCache;
+
+#include "PanelGif.h"
+// GIF uploads are decoded straight out of SerialProcessor's receive ring.
+#include "SerialRing.h"
+#include "GifReader.h"
+GifReader gifReader;
+
+#include "PanelAsset.h"
+// Built-in animation, linked from ldur_lpa.S (generated by tools/mkasset.py).
+extern "C" const uint8_t ldur_lpa[];
+extern "C" const uint32_t ldur_lpa_len;
+
+#include "AnimationStream.h"
+static_assert(kStreamSlots * kFrameBytes <= kFrameStoreBytes,
+              "Streamed frames borrow the frame store");
+#include "AnimationLibrary.h"
+AnimationLibrary animationLibrary;
+
+#include "PanelShader.h"
+#include "Compositor.h"
+#include "FrameBlitter.h"
+#include "RenderJob.h"
 
 class LedPanel {
   public:
@@ -80,75 +71,650 @@ class LedPanel {
     
 
     void Init() {
-      decoder.setScreenClearCallback(screenClearCallback);
-      decoder.setUpdateScreenCallback(updateScreenCallback);
-      decoder.setDrawPixelCallback(drawPixelCallback);
-
-      matrix.addLayer(&backgroundLayer);
+      #if defined(LED_DIRECT_LAYER)
+        matrix.addLayer(&directLayer);
+      #else
+        matrix.addLayer(&backgroundLayer);
+      #endif
       matrix.setBrightness(defaultBrightness);
-      matrix.setRefreshRate(60);
+      matrix.setRefreshRate(kRefreshRate);
 
       matrix.begin();
+      refreshMeter.Init();
 
-      SetGif((uint8_t*)ldur_gif, ldur_gif_len);
+      animationLibrary.Init();
+      // Before anything is loaded into it.
+      frameStore.Init();
+      frameCache.Init();
+      RestoreFrames();
+      shader.Init();
+      blitter.Init();
+      // Nothing was released just now.
+      for (size_t i = 0; i < kNumPanels; i++) {
+        releaseTimes[i] = millis() - kReleaseFadeMs;
+      }
     }
 
+    // Draws at most one slice of the current frame, see kRenderSliceMicros,
+    // and starts the next frame once the previous one is on screen.
     void Update() {
-      bool any_on = false, any_changed = false;
-      for (size_t i = 0; i < kNumPanels; i++) {
-        if (currentStates[i] != _states[i].GetCurrentState()) any_changed = true;
-        currentStates[i] = _states[i].GetCurrentState();
-        if (currentStates[i] == SensorState::ON) any_on = true;
-      }
-      
-      if (any_on) {
-        unsigned long now = millis();
-        if (now >= nextUpdateTime || any_changed) {
-          rgb24* dest = backgroundLayer.backBuffer();
-          backgroundLayer.fillScreen(COLOR_BLACK);
+      unsigned long now = millis();
+      TrackStates(now);
+      // The frames are being overwritten.
+      if (loading) return;
+      #if defined(LED_DIRECT_LAYER)
+        UpdateDirect(now);
+        return;
+      #endif
+      if (!render.Active() && !SwapPending()) {
+        if (mode == kRenderFrames) {
+          StartComposite(now);
+        } else {
+          StartProcedural(now);
+        }
+      }
+      if (render.Active()) {
+        RenderSlice();
+      } else if (mode == kRenderFrames && !stream.IsOpen()) {
+        // Nothing to draw until the next frame is due, so its deltas go in
+        // now and NextFrame() finds them done.
+        frameStore.Prepare(RenderJob::SliceCycles());
+      }
+    }
+
+    // Composites |frames| worst-case frames, with every panel halfway through
+    // its fade so that every pixel is blended, and prints
+    // "b <average us> <worst us> <scalar average us> <budget us>". The scalar
+    // figure is the same blend done one channel at a time. Nothing is shown,
+    // the next Update() overwrites the back buffer.
+    void BenchmarkComposite(size_t frames) {
+      #if defined(LED_DIRECT_LAYER)
+        Serial.println("Nothing is composited with LED_DIRECT_LAYER");
+        return;
+      #endif
+      uint8_t alphas[kNumPanels];
+      memset(alphas, 128, sizeof(alphas));
+      // The back buffer may only be drawn into once the last frame is out.
+      while (SwapPending()) {}
+      blitter.Wait();
+      rgb24* dest = BackBuffer();
+      uint64_t total = 0, scalar = 0;
+      uint32_t worst = 0;
+      for (size_t f = 0; f < frames; f++) {
+        uint32_t start = ARM_DWT_CYCCNT;
+        compositor.Begin(alphas, frameStore.Keyframe(), millis());
+        for (size_t i = 0; i < kNumPanels; i++) {
+          for (uint8_t y = 0; y < kMatrixHeight; y++) {
+            compositor.ComposeRow(i, y, dest);
+          }
+        }
+        uint32_t cycles = ARM_DWT_CYCCNT - start;
+        total += cycles;
+        worst = max(worst, cycles);
+      }
+      // Whatever frame was in progress has been overwritten.
+      CancelRender();
+      for (size_t f = 0; f < frames; f++) {
+        uint32_t start = ARM_DWT_CYCCNT;
+        for (size_t i = 0; i < kNumPanels; i++) {
+          for (uint8_t y = 0; y < kMatrixHeight; y++) {
+            Compositor::BlendRowScalar(
+                &dest[kChainWidth * y + PanelX(i)],
+                &frameStore.Keyframe()[kMatrixWidth * y + FrameX(i)],
+                kPanelColors[i % kPanelsPerPad], WeightOf(128));
+          }
+        }
+        scalar += ARM_DWT_CYCCNT - start;
+      }
+      uint32_t cycles_per_us = F_CPU_ACTUAL / 1000000;
+      Serial.print("b ");
+      Serial.print((float)total / frames / cycles_per_us, 1);
+      Serial.print(" ");
+      Serial.print((float)worst / cycles_per_us, 1);
+      Serial.print(" ");
+      Serial.print((float)scalar / frames / cycles_per_us, 1);
+      Serial.print(" ");
+      Serial.print(kCompositeBudgetMicros);
+      Serial.print("\n");
+    }
+
+    // Does a bounded amount of SD streaming work, or of copying frames out
+    // of PSRAM and writing them to the frame cache. Called from loop() so
+    // that upcoming frames are ready before Update() needs them.
+    void Prefetch() {
+      if (!stream.IsOpen()) {
+        if (!loading) {
+          frameStore.Prefetch();
+          if (Quiet(millis())) frameCache.Step();
+        }
+        return;
+      }
+      if (!stream.Pump()) {
+        Serial.println("Animation stream failed, stopping");
+        RestoreFrames();
+      }
+    }
+
+    // Times moving a whole frame out of each tier of the frame store into
+    // the back buffer, by the CPU and by DMA, averaged over |frames| frames.
+    // Prints "e <tier> <size> <used> <cpu us> <dma us>" for each tier that is
+    // there, sizes in bytes. The frame is flushed from the D-cache before
+    // each copy, so the times are for a frame the cache doesn't hold, as one
+    // about to play. The DMA time is 0 where the blitter can't be used.
+    // Nothing is shown, the next Update() overwrites the back buffer.
+    void BenchmarkTiers(size_t frames) {
+      #if defined(LED_DIRECT_LAYER)
+        Serial.println("Nothing is blitted with LED_DIRECT_LAYER");
+        return;
+      #endif
+      while (SwapPending()) {}
+      blitter.Wait();
+      CancelRender();
+      rgb24* dest = BackBuffer();
+      bool dma = FrameBlitter::kCopiesFrames && FrameBlitter::CanBlitInto(dest);
+      uint32_t cycles_per_us = F_CPU_ACTUAL / 1000000;
+      for (size_t t = 0; t < kNumFrameTiers; t++) {
+        FrameTier tier = (FrameTier)t;
+        if (frameStore.size(tier) < kFrameBytes) continue;
+        // Whatever is at the start of the tier, it is only read.
+        const rgb24* src = (const rgb24*)frameStore.data(tier);
+        uint64_t cpu = 0, dma_cycles = 0;
+        for (size_t f = 0; f < frames; f++) {
+          arm_dcache_flush_delete((void*)src, kFrameBytes);
+          uint32_t start = ARM_DWT_CYCCNT;
           for (size_t i = 0; i < kNumPanels; i++) {
-            size_t pos_dst = kPanelPositions[i], pos_src = current_frame * kMatrixWidth * kMatrixHeight + pos_dst;
-            for (; pos_dst < kMatrixWidth * kMatrixHeight; pos_dst += kMatrixWidth, pos_src += kMatrixWidth) {
-              if (currentStates[i] == SensorState::ON) {
-                memcpy(&dest[pos_dst], &framesBuffer[pos_src], kPanelWidth * sizeof(rgb24));
-              }
+            for (uint8_t y = 0; y < kMatrixHeight; y++) {
+              memcpy(&dest[kChainWidth * y + PanelX(i)],
+                     &src[kMatrixWidth * y + FrameX(i)],
+                     kPanelWidth * sizeof(rgb24));
             }
           }
-          backgroundLayer.swapBuffers();
-          nextUpdateTime = now + frame_times[current_frame];
-          current_frame = (current_frame + 1) % frames;
+          cpu += ARM_DWT_CYCCNT - start;
+          if (!dma) continue;
+          arm_dcache_flush_delete((void*)src, kFrameBytes);
+          start = ARM_DWT_CYCCNT;
+          blitter.Begin();
+          for (size_t i = 0; i < kNumPanels; i++) {
+            blitter.AddCopy(&src[FrameX(i)], &dest[PanelX(i)]);
+          }
+          blitter.Start();
+          blitter.Wait();
+          dma_cycles += ARM_DWT_CYCCNT - start;
         }
-      } else if (nextUpdateTime > 0) {
-        Clear();
+        Serial.print("e ");
+        Serial.print(t);
+        Serial.print(" ");
+        Serial.print(frameStore.size(tier));
+        Serial.print(" ");
+        Serial.print(frameStore.used(tier));
+        Serial.print(" ");
+        Serial.print((float)cpu / frames / cycles_per_us, 1);
+        Serial.print(" ");
+        Serial.print((float)dma_cycles / frames / cycles_per_us, 1);
+        Serial.print("\n");
       }
     }
 
-    void SetGif(uint8_t* _buffer, size_t len) {
-      uint16_t w, h;
-      decoder.startDecoding(_buffer, len);
-      decoder.getSize(&w, &h);
-      tile = kMatrixWidth / w;
-      if ((tile != 1 && tile != 2 && tile != 4) || h != kMatrixHeight) {
-        Serial.println("GIF incorrect size, skipping");
-        return;
+    // Plays an animation from the SD card library. Its frames are streamed
+    // through kStreamSlots frames borrowed from the frame store, so the
+    // decoded animation is reloaded from the cache once streaming stops.
+    bool PlayFromLibrary(const char* name) {
+      File file = animationLibrary.Open(name);
+      if (!file) return false;
+      frameCache.Cancel();
+      if (!stream.Open(file, frameStore.Scratch(kStreamSlots),
+                       FrameCache::LayoutHash())) {
+        Serial.println("Animation does not match this panel layout");
+        RestoreFrames();
+        return false;
+      }
+      Clear();
+      return true;
+    }
+
+    void StopLibrary() {
+      if (stream.IsOpen()) RestoreFrames();
+    }
+
+    // Starts decoding a GIF of |len| bytes as it arrives in |ring|, see
+    // GifReader.h. The animation keeps playing until its header is read.
+    void BeginGif(SerialRing* ring, size_t len) {
+      CancelGif();
+      gifReader.Begin(ring, len);
+      gifDecoding = true;
+    }
+
+    // Decodes at most one frame of what has arrived, so that loop() keeps
+    // sampling all through an upload. Returns false once it is done with the
+    // file, which may be before all of it has been read.
+    bool ContinueGif() {
+      if (!gifDecoding) return false;
+      if (!loading && !StartGif()) return gifDecoding;
+      size_t delay;
+      bool full = false;
+      if (gifDecoder.DecodeFrame(&gifSink, &delay)) {
+        full = !frameStore.Add(delay);
+        if (!full) return true;
+      } else if (gifDecoder.Waiting()) {
+        return true;
       }
-      for(int i = 0; i < maxFrames && decoder.getCycleNumber() == 0; i++) {
-        current_frame = i;
-        decoder.decodeFrame(false);
-        frame_times[i] = decoder.getFrameDelay_ms();
+      gifDecoding = false;
+      loading = false;
+      // Frames were overwritten with what did arrive.
+      if (gifDecoder.Failed() || !frameStore.End()) {
+        Serial.println("GIF corrupt, skipping");
+        RestoreFrames();
+        return false;
       }
-      frames = (decoder.getCycleNumber() == 0)? maxFrames : decoder.getFrameCount();
+      if (full) {
+        Serial.print("GIF longer than the frame store, keeping ");
+        Serial.print(frameStore.frames());
+        Serial.println(" frames");
+      }
+      // Keyed by the part of the file the frames came from.
+      frameCache.Store(gifReader.Hash(), frameStore);
       Clear();
+      return false;
+    }
+
+    // For an upload that was cut short.
+    void CancelGif() {
+      if (!gifDecoding) return;
+      gifDecoding = false;
+      if (!loading) return;
+      loading = false;
+      RestoreFrames();
+    }
+
+    // Loads a prebuilt .lpa asset. Frames that don't fit the frame store are
+    // dropped, the same as for GIFs.
+    bool SetAsset(const uint8_t* _buffer, size_t len, bool cache = true) {
+      BeginAsset(cache);
+      return AddAsset(_buffer, len) && EndAsset();
+    }
+
+    // The same, for an asset that arrives a piece at a time, e.g. an upload
+    // straight out of the serial receive ring. Its frames are expanded as
+    // they arrive, over the old ones, so nothing is drawn until EndAsset().
+    // Uploaded assets are cached so they survive a reboot like GIFs do.
+    void BeginAsset(bool cache = true) {
+      stream.Close();
+      frameCache.Cancel();
+      loader.Begin(&frameStore, FrameCache::LayoutHash());
+      loaderHash = FrameCache::Hash(nullptr, 0);
+      loaderCache = cache;
+      loading = true;
+      Clear();
+    }
+
+    // Returns false once the asset turned out to be unusable, in which case
+    // the previous animation is back.
+    bool AddAsset(const uint8_t* data, size_t len) {
+      if (!loading) return false;
+      loaderHash = FrameCache::Hash(data, len, loaderHash);
+      if (loader.Add(data, len)) return true;
+      FailAsset();
+      return false;
+    }
+
+    bool EndAsset() {
+      if (!loading) return false;
+      if (loader.status() != PanelAsset::Loader::kDone) {
+        FailAsset();
+        return false;
+      }
+      loading = false;
+      frameStore.End();
+      if (loaderCache) frameCache.Store(loaderHash, frameStore);
+      Clear();
+      return true;
+    }
+
+    // For an upload that was cut short.
+    void CancelAsset() {
+      if (!loading) return;
+      loading = false;
+      RestoreFrames();
     }
 
     void Clear() {
-      backgroundLayer.fillScreen(COLOR_BLACK);
-      backgroundLayer.swapBuffers(false);
+      #if defined(LED_DIRECT_LAYER)
+        directLayer.Show(nullptr, 0);
+      #else
+        blitter.Wait();
+        backgroundLayer.fillScreen(COLOR_BLACK);
+        Present();
+      #endif
       nextUpdateTime = 0;
+      shaderLit = false;
+      shownFrame = nullptr;
+      render.Cancel();
+      nextDrawTime = 0;
+    }
+
+    // Switches between the animation and the procedural modes. Resets the
+    // render time statistics.
+    void SetRenderMode(RenderMode new_mode) {
+      mode = new_mode;
+      render.ResetStats();
+      Clear();
+    }
+
+    // "r <mode> <last us> <worst us> <frames over budget> <worst slice us>
+    // <frames past deadline>". Frame times are the sum of a frame's slices.
+    // The budget is kCompositeBudgetMicros for the animation,
+    // kShaderBudgetMicros otherwise.
+    void PrintRenderStats() {
+      Serial.print("r ");
+      Serial.print(mode);
+      Serial.print(" ");
+      Serial.print(render.micros());
+      Serial.print(" ");
+      Serial.print(render.worst_micros());
+      Serial.print(" ");
+      Serial.print(render.overruns());
+      Serial.print(" ");
+      Serial.print(render.slice_worst_micros());
+      Serial.print(" ");
+      Serial.print(render.deadline_misses());
+      Serial.print("\n");
     }
   private:
-    GifDecoder<kMatrixWidth, kMatrixHeight, 12> decoder;
+    // Keeps track of presses and releases on every call, so that fades start
+    // when the panel was released rather than when the next frame starts.
+    void TrackStates(unsigned long now) {
+      for (size_t i = 0; i < kNumPanels; i++) {
+        SensorState::State state = _states[i].GetCurrentState();
+        if (currentStates[i] != state) {
+          statesChanged = true;
+          if (state == SensorState::OFF) releaseTimes[i] = now;
+        }
+        currentStates[i] = state;
+      }
+    }
+
+    // Whether no panel is pressed or was released in the last
+    // kFrameCacheQuietMs, so that a flash write is unlikely to hold up a
+    // press.
+    bool Quiet(unsigned long now) const {
+      for (size_t i = 0; i < kNumPanels; i++) {
+        if (currentStates[i] == SensorState::ON ||
+            now - releaseTimes[i] < kFrameCacheQuietMs) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    #if defined(LED_DIRECT_LAYER)
+    // Moves the animation on while any panel is pressed and hands the frame
+    // and the pressed panels to the direct layer, which draws them itself.
+    void UpdateDirect(unsigned long now) {
+      uint32_t pressed = 0;
+      for (size_t i = 0; i < kNumPanels; i++) {
+        if (currentStates[i] == SensorState::ON) pressed |= 1u << i;
+      }
+      bool due = pressed != 0 && (now >= nextUpdateTime || statesChanged);
+      // The frame's deltas go in a slice per Update(), see
+      // FrameStore::Prepare().
+      if (due && !stream.IsOpen() &&
+          !frameStore.Prepare(RenderJob::SliceCycles())) {
+        directLayer.Show(shownFrame, pressed);
+        return;
+      }
+      if (due) {
+        size_t delay;
+        const rgb24* frame = NextFrame(&delay);
+        if (frame != nullptr) {
+          shownFrame = frame;
+          nextUpdateTime = now + delay;
+        }
+      }
+      statesChanged = false;
+      directLayer.Show(shownFrame, pressed);
+    }
+    #endif
+
+    // Sets up a frame of the animation composited over the idle layer, if
+    // anything changed since the last one.
+    void StartComposite(unsigned long now) {
+      bool any_visible = false;
+      uint8_t alphas[kNumPanels];
+      for (size_t i = 0; i < kNumPanels; i++) {
+        alphas[i] = currentStates[i] == SensorState::ON
+                        ? 255
+                        : ReleaseAlpha(now - releaseTimes[i]);
+        if (alphas[i] > 0) any_visible = true;
+      }
+
+      // The animation only runs while some panel shows it, fading ones
+      // included.
+      bool advanced = false;
+      if (any_visible && (now >= nextUpdateTime || statesChanged)) {
+        // The frame's deltas go in a slice per Update() until they are all
+        // in, see FrameStore::Prepare(). Update() usually did that ahead.
+        if (!stream.IsOpen() &&
+            !frameStore.Prepare(RenderJob::SliceCycles())) {
+          return;
+        }
+        size_t delay;
+        const rgb24* frame = NextFrame(&delay);
+        // A stream that has not buffered its first frame yet.
+        if (frame != nullptr) {
+          shownFrame = frame;
+          nextUpdateTime = now + delay;
+          advanced = true;
+        }
+      }
+
+      // Fades and the idle layer need redrawing at the shader frame rate too.
+      bool due = now >= nextDrawTime &&
+                 (kIdleLevel > 0 ||
+                  memcmp(alphas, drawnAlphas, sizeof(alphas)) != 0);
+      if (!advanced && !statesChanged && !due) return;
+      statesChanged = false;
+
+      compositor.Begin(alphas, shownFrame, now);
+      memcpy(drawnAlphas, alphas, sizeof(alphas));
+      nextDrawTime = now + kShaderFrameMs;
+      StartRender(now);
+
+      // Panels that are all one layer go to the DMA, so only blended panels
+      // cost CPU time. A fill needs its first row drawn to copy from.
+      if (!FrameBlitter::CanBlitInto(renderTarget) ||
+          (shownFrame != nullptr && !FrameBlitter::CanBlitInto(shownFrame))) {
+        return;
+      }
+      for (size_t i = 0; i < kNumPanels; i++) {
+        rgb24* dest = &renderTarget[PanelX(i)];
+        if (compositor.Alpha(i) == 255 && FrameBlitter::kCopiesFrames) {
+          blitter.AddCopy(&shownFrame[FrameX(i)], dest);
+          render.Skip(i);
+        } else if (compositor.Alpha(i) == 0) {
+          compositor.ComposeRow(i, 0, renderTarget);
+          blitter.AddFill(dest);
+          render.Skip(i);
+        }
+      }
+      blitter.Start();
+    }
+
+    // Sets up a frame that draws every panel from its pressure.
+    void StartProcedural(unsigned long now) {
+      if (now < nextUpdateTime) return;
+      nextUpdateTime = now + kShaderFrameMs;
+
+      uint8_t levels[kNumPanels];
+      bool any_pressure = false;
+      for (size_t i = 0; i < kNumPanels; i++) {
+        levels[i] = _states[i].GetPressure();
+        if (levels[i] > 0) any_pressure = true;
+      }
+      // Nothing to draw over an already black screen.
+      if (!any_pressure && !shaderLit) return;
+      shaderLit = any_pressure;
+
+      shader.Begin(mode, levels, now);
+      StartRender(now);
+    }
+
+    void StartRender(unsigned long now) {
+      render.Start(now);
+      renderTarget = BackBuffer();
+      blitter.Begin();
+    }
+
+    // Drops a frame that was only partly drawn and makes sure a new one is
+    // started.
+    void CancelRender() {
+      blitter.Wait();
+      render.Cancel();
+      statesChanged = true;
+      shaderLit = true;
+      nextUpdateTime = nextDrawTime = 0;
+    }
+
+    // Draws panel rows of the current frame until the slice is used up, and
+    // shows the frame once every row is done.
+    void RenderSlice() {
+      bool drawn = render.Slice([this](size_t i, uint8_t y) {
+        if (mode == kRenderFrames) {
+          compositor.ComposeRow(i, y, renderTarget);
+        } else {
+          shader.ShadeRow(i, y, &renderTarget[kChainWidth * y + PanelX(i)]);
+        }
+      });
+      // The DMA may still be busy with the panels it was given.
+      if (!drawn || !blitter.Done()) return;
+      render.Finish(millis(), mode == kRenderFrames ? kCompositeBudgetMicros
+                                                    : kShaderBudgetMicros);
+      Present();
+    }
+
+    // Queues the back buffer to be shown. Every pixel is redrawn each frame,
+    // so the old front buffer needn't be copied back, and swapBuffers(false)
+    // returns without waiting for the refresh.
+    void Present() {
+      #if !defined(LED_DIRECT_LAYER)
+        swappedBuffer = backgroundLayer.backBuffer();
+        backgroundLayer.swapBuffers(false);
+      #endif
+    }
+
+    // Whether the last Present() is still waiting for the refresh to pick it
+    // up. Until it has, the back buffer is the frame about to be shown and
+    // must not be drawn into.
+    bool SwapPending() {
+      return BackBuffer() == swappedBuffer;
+    }
+
+    // The buffer frames are drawn into. The direct layer has none, nothing is
+    // drawn ahead of the refresh.
+    rgb24* BackBuffer() {
+      #if defined(LED_DIRECT_LAYER)
+        return nullptr;
+      #else
+        return backgroundLayer.backBuffer();
+      #endif
+    }
+
+    // Returns the frame to show now and how long to show it for, and moves on
+    // to the following frame.
+    const rgb24* NextFrame(size_t* delay) {
+      if (stream.IsOpen()) {
+        const rgb24* frame = stream.Front();
+        *delay = stream.FrontDelay();
+        stream.Pop();
+        return frame;
+      }
+      return frameStore.Next(delay);
+    }
+
+    // Reads the GIF's header and, if it is one the panels can show, starts
+    // decoding its frames over the old ones. Returns false until then, with
+    // gifDecoding cleared if it isn't.
+    bool StartGif() {
+      if (!gifDecoder.Begin(&gifReader)) {
+        if (gifDecoder.Waiting()) return false;
+        Serial.println("GIF incorrect size, skipping");
+        gifDecoding = false;
+        return false;
+      }
+      if (!PanelGif::PanelSink::Fits(gifDecoder.width(),
+                                     gifDecoder.height())) {
+        Serial.println("GIF incorrect size, skipping");
+        gifDecoding = false;
+        return false;
+      }
+      // Frames are drawn onto the store's canvas and stored as deltas. The
+      // spare frame is what disposal method 3 goes back to.
+      stream.Close();
+      frameCache.Cancel();
+      frameStore.Begin(true);
+      gifSink.Begin(frameStore.Canvas(), frameStore.Spare(),
+                    gifDecoder.width());
+      loading = true;
+      Clear();
+      return true;
+    }
+
+    void FailAsset() {
+      loading = false;
+      if (loader.status() == PanelAsset::Loader::kWrongLayout) {
+        Serial.println("Asset does not match this panel layout, skipping");
+      } else {
+        Serial.println("Asset frame corrupt, skipping");
+      }
+      // Part of the frames may have been overwritten. Restoring the built-in
+      // asset can't fail the same way twice.
+      if (loaderCache) RestoreFrames();
+    }
+
+    // Brings back whatever animation was showing before the power cycle and
+    // only falls back to expanding the built-in asset when nothing is cached.
+    void RestoreFrames() {
+      stream.Close();
+      if (frameCache.Load(0, &frameStore)) {
+        Clear();
+      } else {
+        SetAsset(ldur_lpa, ldur_lpa_len, false);
+      }
+    }
+
+    AnimationStream<File> stream;
+    // The asset being loaded, see BeginAsset().
+    PanelAsset::Loader loader;
+    uint32_t loaderHash = 0;
+    bool loaderCache = false;
+    bool loading = false;
+    // The GIF being decoded, see BeginGif(). |loading| is set once its
+    // header has been read.
+    bool gifDecoding = false;
+    PanelGif::Decoder<GifReader> gifDecoder;
+    PanelGif::PanelSink gifSink;
     const SensorState* _states;
     
     unsigned long nextUpdateTime;
+
+    // The animation frame on screen. Stays valid until the next NextFrame().
+    const rgb24* shownFrame = nullptr;
+    unsigned long releaseTimes[kNumPanels] = {};
+    // The animation layer's weight per panel as of the last composite.
+    uint8_t drawnAlphas[kNumPanels] = {};
+    unsigned long nextDrawTime = 0;
+    Compositor compositor;
+
+    RenderMode mode = kRenderFrames;
+    PanelShader shader;
+    // Whether the last procedural frame lit anything.
+    bool shaderLit = false;
+    // Whether a panel was pressed or released since the last frame started.
+    bool statesChanged = false;
+
+    // The frame being drawn, see RenderSlice().
+    RenderJob render;
+    rgb24* renderTarget = nullptr;
+    FrameBlitter blitter;
+    // The buffer passed to the refresh by the last Present().
+    rgb24* swappedBuffer = nullptr;
 };
@@ -0,0 +1,94 @@
+// Where the firmware's data lives on the Teensy 4.x.
+//
+// DTCM (RAM1) is tightly coupled to the core and never goes through the
+// D-cache. Everything the sensor path touches for every sample lives there:
+// the sensors with their filter windows, the states, the ADC objects, and
+// whatever an interrupt shares with loop(). Those accesses then cost the same
+// whatever the LED code has just pulled through the cache. Mark them with
+// HOT_DATA.
+//
+// OCRAM (RAM2, DMAMEM) is cached write-back and holds frame storage, marked
+// with FRAME_DATA. The CPU and the DMA both work on it, so whoever hands a
+// buffer from one to the other keeps it coherent: arm_dcache_flush() after
+// the CPU wrote what the DMA will read, and arm_dcache_delete() after the DMA
+// wrote what the CPU will read. See FrameBlitter.h.
+//
+// The heap is in OCRAM too, so nothing on the sensor path is allocated with
+// new. The frame store takes most of what the heap has left at boot, and the
+// PSRAM on EXTMEM if one is fitted, see FrameStore.h. "m" in
+// SerialProcessor.h prints how full each region is, and tools/memreport.py
+// does the same for a built .elf.
+
+// Frame rows that the DMA writes must not share a cache line with anything
+// the CPU writes at the same time.
+const size_t kCacheLine = 32;
+
+#if defined(__IMXRT1062__)
+  // .data* is linked into DTCM. The named section is what lets
+  // tools/memreport.py find every hot object and check it stayed there.
+  #define HOT_DATA __attribute__((section(".data.hot")))
+  #define FRAME_DATA DMAMEM __attribute__((aligned(kCacheLine)))
+#else
+  #define HOT_DATA
+  #define FRAME_DATA DMAMEM
+#endif
+
+#if defined(__IMXRT1062__)
+// Defined by the Teensy 4 linker script.
+extern unsigned long _ebss, _estack, _heap_start;
+extern "C" char* sbrk(int incr);
+// Set by the Teensy 4.1 startup code, in MB, 0 without PSRAM.
+extern "C" uint8_t external_psram_size;
+
+const uintptr_t kDtcmStart = 0x20000000;
+const uintptr_t kOcramStart = 0x20200000;
+const uintptr_t kOcramEnd = 0x20280000;
+#endif
+
+// An object that has to stay in DTCM, checked by PrintMemoryRegions().
+struct HotObject {
+  const char* name;
+  const void* start;
+  size_t size;
+};
+
+inline bool IsInDtcm(const HotObject& object) {
+#if defined(__IMXRT1062__)
+  uintptr_t start = (uintptr_t)object.start;
+  return start >= kDtcmStart &&
+         start + object.size <= (uintptr_t)&_estack;
+#else
+  return true;
+#endif
+}
+
+// Prints "m <dtcm_used> <dtcm_size> <ocram_static> <heap_used> <ocram_size>",
+// in bytes, followed by a line naming each of |hot| that isn't in DTCM.
+// DTCM's size is what the FlexRAM banks give it; the stack grows down from
+// its end into whatever the static data leaves.
+inline void PrintMemoryRegions(const HotObject* hot, size_t count) {
+#if defined(__IMXRT1062__)
+  uintptr_t dtcm_used = (uintptr_t)&_ebss - kDtcmStart;
+  uintptr_t dtcm_size = (uintptr_t)&_estack - kDtcmStart;
+  uintptr_t ocram_static = (uintptr_t)&_heap_start - kOcramStart;
+  uintptr_t heap_used = (uintptr_t)sbrk(0) - (uintptr_t)&_heap_start;
+  Serial.print("m ");
+  Serial.print(dtcm_used);
+  Serial.print(" ");
+  Serial.print(dtcm_size);
+  Serial.print(" ");
+  Serial.print(ocram_static);
+  Serial.print(" ");
+  Serial.print(heap_used);
+  Serial.print(" ");
+  Serial.println(kOcramEnd - kOcramStart);
+#else
+  Serial.println("m");
+#endif
+  for (size_t i = 0; i < count; i++) {
+    if (!IsInDtcm(hot[i])) {
+      Serial.print("Not in DTCM: ");
+      Serial.println(hot[i].name);
+    }
+  }
+}
@@ -2,6 +2,12 @@
 // Values provided to this class should fall in [−32,768, 32,767] otherwise it
 // may overflow. We use a 32-bit integer for the intermediate sums which we
 // then restrict back down to 16-bits.
+//
+// The weighted sum is at most kWindowSize * (kWindowSize + 1) / 2 times the
+// largest input, which has to fit the 32-bit accumulator.
+static_assert((int64_t)kWindowSize * (kWindowSize + 1) / 2 * INT16_MAX <=
+                  INT32_MAX,
+              "kWindowSize is too large for the 32-bit weighted sum");
 class WeightedMovingAverage {
  public:
   WeightedMovingAverage(size_t size) :
@@ -27,7 +33,7 @@ class WeightedMovingAverage {
     // are integers and we need to return an int anyways. Off by one isn't
     // substantial here.
     // Sum of weights = sum of all integers from [1, size_]
-    int16_t sum_weights = ((size_ * (size_ + 1)) / 2);
+    int32_t sum_weights = ((size_ * (size_ + 1)) / 2);
     return next_weighted_sum/sum_weights;
   }
 
@@ -54,6 +60,12 @@ class WeightedMovingAverage {
 //   3. Calculate WMA of the values from step 2 with a period of sqrt(2).
 //
 // HMA = WMA( 2 * WMA(input, n/2) - WMA(input, n), sqrt(n) )
+//
+// For sensor values in [0, 2^kPipelineBits) the intermediate
+// 2 * WMA(n/2) - WMA(n) spans three times that range, which still has to fit
+// 16 bits for the saturation below never to change a result.
+static_assert(kPipelineBits <= 13,
+              "2 * wma1 - wma2 would not fit 16 bits at this resolution");
 class HullMovingAverage {
  public:
   HullMovingAverage(size_t size) :
@@ -62,7 +74,11 @@ class HullMovingAverage {
   int16_t GetAverage(int16_t value) {
     int16_t wma1_value = wma1_.GetAverage(value);
     int16_t wma2_value = wma2_.GetAverage(value);
-    int16_t hull_value = hull_.GetAverage(2 * wma1_value - wma2_value);
+    // 2 * wma1 - wma2 overshoots the input range on steps, so compute it in
+    // 32 bits and saturate rather than let it wrap around.
+    int32_t hull_input = 2 * (int32_t)wma1_value - wma2_value;
+    hull_input = constrain(hull_input, (int32_t)INT16_MIN, (int32_t)INT16_MAX);
+    int16_t hull_value = hull_.GetAverage(hull_input);
 
     return hull_value;
   }
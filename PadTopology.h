@@ -0,0 +1,129 @@
+// Compile-time description of how the pad is wired: which pin every FSR is on
+// and which panel state it feeds. Everything derived from it (a sensor's slot
+// in its state, whether it is the last sensor of that state) is resolved by
+// the compiler, so the per-sample path never searches for anything.
+
+// One FSR as declared in the sketch.
+struct SensorWiring {
+  uint8_t pin;
+  // Index into kStates.
+  uint8_t state;
+};
+
+// How a sensor is sampled. Two sensors of the same panel are converted
+// together, one on each ADC, so a pair costs a single conversion time and both
+// values are taken at the same instant.
+enum SensorPairing : uint8_t {
+  kUnpaired,
+  // Sampled together with the next sensor, on adc0.
+  kPairFirst,
+  // Sampled by the previous sensor's conversion, on adc1.
+  kPairSecond,
+};
+
+// Everything a Sensor needs to know about its place in the topology.
+struct SensorTopology {
+  uint8_t pin;
+  uint8_t state;
+  // Index of this sensor among the sensors sharing its state.
+  uint8_t slot;
+  // Whether this is the last sensor of its state, i.e. the point at which all
+  // of the state's sensors have been evaluated and it can be resolved.
+  bool last_in_state;
+  SensorPairing pairing;
+};
+
+// These are written as single return statements so that they stay constexpr
+// under C++11 as well.
+template <size_t N>
+constexpr uint8_t SlotInState(const SensorWiring (&wiring)[N], size_t i,
+                              size_t j = 0) {
+  return j >= i ? 0
+                : (wiring[j].state == wiring[i].state) +
+                      SlotInState(wiring, i, j + 1);
+}
+
+template <size_t N>
+constexpr size_t SensorsInState(const SensorWiring (&wiring)[N], size_t state,
+                                size_t j = 0) {
+  return j >= N ? 0
+                : (wiring[j].state == state) +
+                      SensorsInState(wiring, state, j + 1);
+}
+
+// Sensors at even slots pair up with the sensor in the following slot.
+template <size_t N>
+constexpr SensorPairing PairingFor(const SensorWiring (&wiring)[N],
+                                   size_t i) {
+  return SlotInState(wiring, i) % 2 == 1 ? kPairSecond
+         : (size_t)SlotInState(wiring, i) + 1 <
+                 SensorsInState(wiring, wiring[i].state) ? kPairFirst
+         : kUnpaired;
+}
+
+template <size_t N>
+constexpr SensorTopology TopologyOf(const SensorWiring (&wiring)[N],
+                                    size_t i) {
+  return SensorTopology{
+      wiring[i].pin, wiring[i].state, SlotInState(wiring, i),
+      (size_t)SlotInState(wiring, i) + 1 ==
+          SensorsInState(wiring, wiring[i].state),
+      PairingFor(wiring, i)};
+}
+
+// Sensors that share a state have to be listed next to each other so that a
+// state is resolved exactly once per pass, right after its last sensor.
+template <size_t N>
+constexpr bool StatesAreContiguous(const SensorWiring (&wiring)[N],
+                                   size_t i = 1) {
+  return i >= N ? true
+                : (wiring[i].state == wiring[i - 1].state ||
+                   SlotInState(wiring, i) == 0) &&
+                      StatesAreContiguous(wiring, i + 1);
+}
+
+template <size_t N>
+constexpr bool SlotsFit(const SensorWiring (&wiring)[N], size_t i = 0) {
+  return i >= N ? true
+                : SlotInState(wiring, i) < kMaxSharedSensors &&
+                      SlotsFit(wiring, i + 1);
+}
+
+// Joystick buttons of one pad's panels, in kStates order, and how far apart
+// the pads' blocks of buttons are. The second pad's panels are 30 to 27.
+constexpr uint8_t kPanelButtons[] = { 14, 13, 12, 11 };
+const uint8_t kButtonsPerPad = 16;
+// The Teensy joystick has 32 buttons.
+const uint8_t kMaxButton = 32;
+static_assert(sizeof(kPanelButtons) == kPanelsPerPad,
+              "Every panel of a pad needs a button");
+
+constexpr uint8_t ButtonForState(size_t state) {
+  return kPanelButtons[state % kPanelsPerPad] +
+         state / kPanelsPerPad * kButtonsPerPad;
+}
+
+// A loop index known at compile time. Converts to size_t, and
+// decltype(i)::value can be used where a constant expression is required.
+template <size_t I>
+struct Index {
+  static constexpr size_t value = I;
+  constexpr operator size_t() const { return I; }
+};
+
+// Calls f(Index<I>), ..., f(Index<End - 1>) without a loop, so that every
+// index is a constant and the per-sensor topology folds away.
+template <size_t I, size_t End>
+struct Unrolled {
+  template <typename F>
+  static inline void Run(const F& f) {
+    f(Index<I>());
+    Unrolled<I + 1, End>::Run(f);
+  }
+};
+
+template <size_t End>
+struct Unrolled<End, End> {
+  template <typename F>
+  static inline void Run(const F&) {}
+};
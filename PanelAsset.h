@@ -0,0 +1,242 @@
+// Prebuilt animation assets (.lpa) produced by tools/mkasset.py.
+//
+// Frames in an asset are already mapped to the panel layout, so loading one
+// only expands runs into frames and never touches the GIF decoder.
+//
+// Layout (little-endian):
+//   Header           magic "LPA1", width, height, frame count, flags, layout
+//   IndexEntry[n]    offset/length of each frame's runs, delay in ms
+//   runs             control byte c < 0x80: c + 1 literal pixels follow,
+//                    c >= 0x80: the next pixel repeats c - 0x7f times
+namespace PanelAsset {
+
+struct Header {
+  char magic[4];
+  uint16_t width;
+  uint16_t height;
+  uint16_t frames;
+  uint16_t flags;
+  uint32_t layout;
+};
+
+struct IndexEntry {
+  uint32_t offset;
+  uint32_t length;
+  uint16_t delay_ms;
+  uint16_t reserved;
+};
+
+inline bool HeaderMatches(const Header& header, uint32_t layout) {
+  return memcmp(header.magic, "LPA1", 4) == 0 &&
+         header.width == kMatrixWidth && header.height == kMatrixHeight &&
+         header.layout == layout && header.frames > 0;
+}
+
+// Expands one frame's runs. Runs may straddle two chunks of a file or of an
+// upload, so the expansion picks up wherever the last call stopped.
+class RunExpander {
+ public:
+  void Begin(rgb24* dest, size_t pixels) {
+    dest_ = (uint8_t*)dest;
+    capacity_ = pixels * sizeof(rgb24);
+    written_ = 0;
+    state_ = kControl;
+  }
+
+  // Returns false if the runs overflow the frame.
+  bool Expand(const uint8_t* src, size_t len) {
+    const uint8_t* end = src + len;
+    while (src < end) {
+      switch (state_) {
+        case kControl: {
+          uint8_t control = *src++;
+          if (control < 0x80) {
+            left_ = (control + 1) * sizeof(rgb24);
+            state_ = kLiteral;
+          } else {
+            left_ = control - 0x7f;
+            color_len_ = 0;
+            state_ = kColor;
+          }
+          break;
+        }
+        case kLiteral: {
+          size_t count = min(left_, (size_t)(end - src));
+          if (written_ + count > capacity_) return false;
+          memcpy(dest_ + written_, src, count);
+          written_ += count;
+          src += count;
+          left_ -= count;
+          if (left_ == 0) state_ = kControl;
+          break;
+        }
+        case kColor:
+          color_[color_len_++] = *src++;
+          if (color_len_ == sizeof(rgb24)) {
+            if (written_ + left_ * sizeof(rgb24) > capacity_) return false;
+            for (size_t i = 0; i < left_; i++) {
+              memcpy(dest_ + written_, color_, sizeof(rgb24));
+              written_ += sizeof(rgb24);
+            }
+            state_ = kControl;
+          }
+          break;
+      }
+    }
+    return true;
+  }
+
+  // Whether the runs so far cover the frame exactly.
+  bool Complete() const {
+    return written_ == capacity_ && state_ == kControl;
+  }
+
+ private:
+  enum State : uint8_t { kControl, kLiteral, kColor };
+
+  uint8_t* dest_;
+  size_t capacity_;
+  size_t written_;
+  State state_;
+  size_t left_;
+  uint8_t color_[sizeof(rgb24)];
+  uint8_t color_len_;
+};
+
+// Loads an asset that arrives in pieces, e.g. an upload straight out of the
+// serial receive ring, into a FrameStore. Nothing but the current index entry
+// is buffered, each frame is expanded onto the store's canvas and added from
+// there. Frames must follow each other in the file, which is how
+// tools/mkasset.py writes them.
+class Loader {
+ public:
+  enum Status : uint8_t { kLoading, kDone, kWrongLayout, kCorrupt };
+
+  // Frames that don't fit into |store| are dropped. |store| gets its Begin(),
+  // its End() is up to the caller once status() is kDone.
+  void Begin(FrameStore* store, uint32_t layout) {
+    store_ = store;
+    store_->Begin();
+    layout_ = layout;
+    status_ = kLoading;
+    stage_ = kHeader;
+    have_ = 0;
+  }
+
+  // Returns false once the asset turned out to be unusable, see status().
+  bool Add(const uint8_t* data, size_t len) {
+    while (len > 0 && status_ == kLoading) {
+      size_t used = 0;
+      switch (stage_) {
+        case kHeader:
+          used = Collect(&header_, sizeof(header_), data, len);
+          if (have_ < sizeof(header_)) break;
+          if (!HeaderMatches(header_, layout_)) {
+            status_ = kWrongLayout;
+            break;
+          }
+          stored_ = min((size_t)header_.frames, maxFrames);
+          entries_ = 0;
+          offset_ = 0;
+          have_ = 0;
+          stage_ = kIndex;
+          break;
+        case kIndex: {
+          used = Collect(&entry_, sizeof(entry_), data, len);
+          if (have_ < sizeof(entry_)) break;
+          have_ = 0;
+          if (entry_.offset != offset_ || entry_.length == 0) {
+            status_ = kCorrupt;
+            break;
+          }
+          offset_ += entry_.length;
+          if (entries_ < stored_) {
+            lengths_[entries_] = entry_.length;
+            delays_[entries_] = entry_.delay_ms;
+          }
+          if (++entries_ == header_.frames) {
+            frame_ = 0;
+            BeginFrame();
+          }
+          break;
+        }
+        case kRuns: {
+          used = min(len, (size_t)remaining_);
+          if (!expander_.Expand(data, used)) {
+            status_ = kCorrupt;
+            break;
+          }
+          remaining_ -= used;
+          if (remaining_ > 0) break;
+          if (!expander_.Complete()) {
+            status_ = kCorrupt;
+            break;
+          }
+          // The store is full, the rest is dropped.
+          if (!store_->Add(delays_[frame_])) stored_ = frame_;
+          frame_++;
+          BeginFrame();
+          break;
+        }
+        case kTail:
+          // Frames that don't fit.
+          used = len;
+          break;
+      }
+      data += used;
+      len -= used;
+    }
+    return status_ == kLoading || status_ == kDone;
+  }
+
+  // Whether every frame that is kept has been loaded. Frames that were
+  // dropped don't need to have arrived.
+  Status status() const {
+    return status_ == kLoading && stage_ == kTail ? kDone : status_;
+  }
+
+  size_t frames() const { return store_->frames(); }
+
+ private:
+  enum Stage : uint8_t { kHeader, kIndex, kRuns, kTail };
+
+  size_t Collect(void* dest, size_t size, const uint8_t* data, size_t len) {
+    size_t used = min(len, size - have_);
+    memcpy((uint8_t*)dest + have_, data, used);
+    have_ += used;
+    return used;
+  }
+
+  void BeginFrame() {
+    if (frame_ >= stored_) {
+      stage_ = kTail;
+      return;
+    }
+    expander_.Begin(store_->Canvas(), kFramePixels);
+    remaining_ = lengths_[frame_];
+    stage_ = kRuns;
+  }
+
+  FrameStore* store_;
+  uint32_t layout_;
+  Status status_;
+  Stage stage_;
+
+  Header header_;
+  IndexEntry entry_;
+  // Bytes of the header or of entry_ collected so far.
+  size_t have_;
+  // Frames that are kept.
+  size_t stored_;
+  // Index entries read so far.
+  size_t entries_;
+  uint32_t offset_;
+  uint32_t lengths_[maxFrames];
+  uint16_t delays_[maxFrames];
+
+  size_t frame_;
+  uint32_t remaining_;
+  RunExpander expander_;
+};
+
+}  // namespace PanelAsset
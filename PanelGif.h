@@ -0,0 +1,539 @@
+// Decodes GIFs straight into panel-mapped frames, see LedPanel::BeginGif().
+//
+// GifDecoder handed out every frame a pixel at a time through
+// drawPixelCallback(), which worked out again for every pixel which panel it
+// was on and where. This decoder hands out whole rows of palette indices
+// instead, and PanelSink maps and stores them a span at a time: the panel, the
+// direction and the start in the frame are worked out once per span, and the
+// pixels are looked up in the palette and stored in a tight loop. Frames come
+// out the same as tools/mkasset.py makes them.
+//
+// The file is read front to back, so it can be decoded as it arrives, see
+// GifReader.h. Palettes, interlacing, transparency and the disposal methods
+// are handled, other extensions are skipped.
+namespace PanelGif {
+
+// Entries of the LZW code table, the most 12-bit codes can address.
+const uint16_t kMaxCodes = 4096;
+// The largest frame that is decoded: a whole pad. Frames that are larger
+// couldn't be shown anyway, and are rejected.
+const uint16_t kMaxPixels = kMatrixWidth * kMatrixHeight;
+
+static_assert(sizeof(rgb24) == 3, "GIF palettes are read straight into rgb24");
+
+// Maps rows of a GIF's canvas onto the panels, into a frame of
+// kMatrixWidth * kMatrixHeight pixels. A canvas a pad wide (tile 1) is spread
+// over the panels, one half as wide (tile 2) is shown twice, the copy
+// mirrored, and one a panel wide (tile 4) is rotated onto every panel by
+// kPanelRotation.
+class PanelSink {
+ public:
+  // Whether a |width| x |height| canvas fits the panels.
+  static bool Fits(uint16_t width, uint16_t height) {
+    uint16_t tile = width == 0 ? 0 : kMatrixWidth / width;
+    return (tile == 1 || tile == 2 || tile == 4) && height == kMatrixHeight;
+  }
+
+  // Starts a black |canvas|. |saved| holds a copy of it for disposal method
+  // 3, which is treated as method 1 without one.
+  void Begin(rgb24* canvas, rgb24* saved, uint16_t width) {
+    canvas_ = canvas;
+    saved_ = saved;
+    width_ = width;
+    tile_ = kMatrixWidth / width;
+    memset(canvas_, 0, kFramePixels * sizeof(rgb24));
+  }
+
+  void Save() {
+    if (saved_ != nullptr) {
+      memcpy(saved_, canvas_, kFramePixels * sizeof(rgb24));
+    }
+  }
+
+  void Restore() {
+    if (saved_ != nullptr) {
+      memcpy(canvas_, saved_, kFramePixels * sizeof(rgb24));
+    }
+  }
+
+  // Stores |count| pixels of canvas row |y| from |x| on, as |indices| into
+  // |palette|. Pixels of index |transparent| are left alone, -1 for none.
+  // Whatever is off the canvas is dropped.
+  void Row(int x, int y, const uint8_t* indices, int count,
+           const rgb24* palette, int transparent) {
+    if (y >= kMatrixHeight || x >= width_) return;
+    count = min(count, width_ - x);
+    if (transparent < 0) {
+      Map<false>(x, y, indices, count, palette, 0);
+    } else {
+      Map<true>(x, y, indices, count, palette, transparent);
+    }
+  }
+
+  // Blacks out part of the canvas, for disposal method 2.
+  void Clear(int x, int y, int w, int h) {
+    static const uint8_t kZeros[kMatrixWidth] = {};
+    for (int row = y; row < y + h && row < kMatrixHeight; row++) {
+      Row(x, row, kZeros, w, &COLOR_BLACK, -1);
+    }
+  }
+
+ private:
+  // Splits a span into the runs that land on one panel each.
+  template <bool kTransparent>
+  void Map(int x, int y, const uint8_t* indices, int count,
+           const rgb24* palette, uint8_t transparent) {
+    if (tile_ == 4) {
+      for (int i = 0; i < 4; i++) {
+        const int8_t* r = &kPanelRotation[4 * i];
+        Store<kTransparent>(i, x * r[0] + y * r[1], x * r[2] + y * r[3],
+                            r[0], r[2], indices, count, palette, transparent);
+      }
+      return;
+    }
+    while (count > 0) {
+      int index = x / kPanelWidth;
+      int px = x % kPanelWidth;
+      int n = min(count, kPanelWidth - px);
+      bool flipped = kPanelFlipped[index];
+      Store<kTransparent>(index, flipped ? kPanelWidth - 1 - px : px,
+                          flipped ? kMatrixHeight - 1 - y : y,
+                          flipped ? -1 : 1, 0, indices, n, palette,
+                          transparent);
+      if (tile_ == 2) {
+        flipped = kPanelFlipped[index + 2];
+        Store<kTransparent>(index + 2, flipped ? px : kPanelWidth - 1 - px,
+                            flipped ? y : kMatrixHeight - 1 - y,
+                            flipped ? 1 : -1, 0, indices, n, palette,
+                            transparent);
+      }
+      x += n;
+      indices += n;
+      count -= n;
+    }
+  }
+
+  // Stores pixels on |panel| from |xpos|, |ypos| on, moving |dx|, |dy| per
+  // pixel and wrapping around the panel's edges.
+  template <bool kTransparent>
+  void Store(size_t panel, int xpos, int ypos, int dx, int dy,
+             const uint8_t* indices, int count, const rgb24* palette,
+             uint8_t transparent) {
+    xpos = (xpos % kPanelWidth + kPanelWidth) % kPanelWidth;
+    ypos = (ypos % kMatrixHeight + kMatrixHeight) % kMatrixHeight;
+    int step = dx + dy * kMatrixWidth;
+    while (count > 0) {
+      int run = count;
+      if (dx > 0) run = min(run, kPanelWidth - xpos);
+      if (dx < 0) run = min(run, xpos + 1);
+      if (dy > 0) run = min(run, kMatrixHeight - ypos);
+      if (dy < 0) run = min(run, ypos + 1);
+      rgb24* dest = &canvas_[kMatrixWidth * ypos + kPanelPositions[panel] + xpos];
+      for (int i = 0; i < run; i++, dest += step) {
+        uint8_t index = indices[i];
+        if (kTransparent && index == transparent) continue;
+        *dest = palette[index];
+      }
+      indices += run;
+      count -= run;
+      xpos = Wrap(xpos + dx * run, kPanelWidth);
+      ypos = Wrap(ypos + dy * run, kMatrixHeight);
+    }
+  }
+
+  static int Wrap(int value, int size) {
+    if (value < 0) return value + size;
+    if (value >= size) return value - size;
+    return value;
+  }
+
+  rgb24* canvas_ = nullptr;
+  rgb24* saved_ = nullptr;
+  int width_ = 0;
+  int tile_ = 0;
+};
+
+// The most a Decoder reads between two Mark()s of its reader: the header and
+// a global palette of 256 colours. A reader fed a piece at a time has to be
+// able to hold this much past its last Mark().
+const size_t kMaxUnmarked = 13 + 3 * 256;
+
+// Decodes the frames of a GIF one after the other. |Reader| has
+//   int ReadBlock(void* buffer, int count), reading front to back,
+//   void Mark(), after which nothing read so far is read again,
+//   void Rewind(), which goes back to the last Mark(), and
+//   bool Waiting(), whether the last short read stopped at bytes that
+//   haven't arrived yet rather than at the end of the file,
+// like GifReader. When the next bytes haven't arrived, the decoder goes back
+// to its last Mark() and returns, see Waiting(), and picks up from there
+// when it is called again.
+template <typename Reader>
+class Decoder {
+ public:
+  // Reads the header and the global palette. Returns false if |reader|
+  // doesn't hold a GIF, or if they haven't arrived yet, see Waiting().
+  bool Begin(Reader* reader) {
+    reader_ = reader;
+    failed_ = waiting_ = false;
+    disposal_ = 0;
+    phase_ = kBlocks;
+    NextControl();
+    uint8_t header[13];
+    if (!Read(header, sizeof(header))) return Pause();
+    if (memcmp(header, "GIF", 3) != 0) return false;
+    width_ = header[6] | header[7] << 8;
+    height_ = header[8] | header[9] << 8;
+    memset(global_, 0, sizeof(global_));
+    if (!ReadPalette(header[10], global_)) return Pause();
+    reader_->Mark();
+    return true;
+  }
+
+  uint16_t width() const { return width_; }
+  uint16_t height() const { return height_; }
+
+  // Draws the next frame onto the canvas of |sink|, over what the frames
+  // before it left there, and returns its delay in |delay_ms|. Returns false
+  // once there are no more frames, or if the file is broken, see Failed(),
+  // or if the rest of the frame hasn't arrived yet, see Waiting().
+  template <typename Sink>
+  bool DecodeFrame(Sink* sink, size_t* delay_ms) {
+    waiting_ = false;
+    if (!NextFrame(sink)) return Pause();
+    *delay_ms = delay_ms_;
+    NextControl();
+    return true;
+  }
+
+  // Whether decoding stopped because the file is broken or cut short.
+  bool Failed() const { return failed_; }
+
+  // Whether the last call returned false only because the bytes it needed
+  // next haven't arrived. Call it again once more has.
+  bool Waiting() const { return waiting_; }
+
+ private:
+  // Where in the file the decoder is.
+  enum Phase : uint8_t {
+    // Before a frame's extensions and image descriptor.
+    kBlocks,
+    // Skipping the rest of an extension.
+    kExtension,
+    // In a frame's image data.
+    kPixels,
+    // Skipping what is left of the image data after its end code.
+    kTrailing,
+  };
+
+  template <typename Sink>
+  bool NextFrame(Sink* sink) {
+    if (phase_ == kExtension) {
+      if (!SkipBlocks()) return false;
+      phase_ = kBlocks;
+    }
+    if (phase_ == kBlocks && !ReadDescriptor(sink)) return false;
+    if (phase_ == kPixels && !DecodePixels(sink)) return false;
+    if (!data_done_ && !SkipBlocks()) return false;
+    phase_ = kBlocks;
+    disposal_ = disposal_next_;
+    clear_x_ = left_;
+    clear_y_ = top_;
+    clear_w_ = w_;
+    clear_h_ = h_;
+    return true;
+  }
+
+  // Reads up to the next frame's image data, going through its extensions.
+  template <typename Sink>
+  bool ReadDescriptor(Sink* sink) {
+    while (true) {
+      uint8_t block;
+      // The end of the file without a trailer ends the animation too.
+      if (reader_->ReadBlock(&block, 1) != 1) {
+        waiting_ = reader_->Waiting();
+        return false;
+      }
+      if (block == 0x3b) return false;
+      if (block == 0x2c) break;
+      if (block != 0x21) return Fail();
+      uint8_t label;
+      if (!Read(&label, 1)) return false;
+      if (label == 0xf9) {
+        // Graphic control extension: disposal, delay and transparency.
+        uint8_t size;
+        if (!Read(&size, 1) || !Read(block_, size)) return false;
+        if (size >= 4) {
+          disposal_next_ = (block_[0] >> 2) & 7;
+          delay_ms_ = (block_[1] | block_[2] << 8) * 10;
+          transparent_ = block_[0] & 1 ? block_[3] : -1;
+        }
+      }
+      phase_ = kExtension;
+      reader_->Mark();
+      if (!SkipBlocks()) return false;
+      phase_ = kBlocks;
+    }
+
+    uint8_t descriptor[9];
+    if (!Read(descriptor, sizeof(descriptor))) return false;
+    left_ = descriptor[0] | descriptor[1] << 8;
+    top_ = descriptor[2] | descriptor[3] << 8;
+    w_ = descriptor[4] | descriptor[5] << 8;
+    h_ = descriptor[6] | descriptor[7] << 8;
+    interlaced_ = descriptor[8] & 0x40;
+    palette_ = global_;
+    if (descriptor[8] & 0x80) {
+      if (!ReadPalette(descriptor[8], local_)) return false;
+      palette_ = local_;
+    }
+    if (!Read(&min_code_size_, 1)) return false;
+    if (min_code_size_ < 1 || min_code_size_ > 11 ||
+        (uint32_t)w_ * h_ > kMaxPixels) {
+      return Fail();
+    }
+
+    // The last frame is disposed of only now that it has been stored.
+    if (disposal_ == 2) sink->Clear(clear_x_, clear_y_, clear_w_, clear_h_);
+    if (disposal_ == 3) sink->Restore();
+    if (disposal_next_ == 3) sink->Save();
+    const uint16_t clear = 1 << min_code_size_;
+    next_ = clear + 2;
+    code_size_ = min_code_size_ + 1;
+    bits_ = 0;
+    bit_count_ = 0;
+    prev_offset_ = prev_length_ = 0;
+    done_ = shown_ = 0;
+    block_len_ = block_pos_ = 0;
+    data_done_ = false;
+    row_y_ = 0;
+    pass_ = 0;
+    phase_ = kPixels;
+    reader_->Mark();
+    return true;
+  }
+
+  // The next frame's graphic control extension starts from the defaults.
+  void NextControl() {
+    disposal_next_ = 0;
+    delay_ms_ = 0;
+    transparent_ = -1;
+  }
+
+  bool Read(void* dest, int count) {
+    if (reader_->ReadBlock(dest, count) == count) return true;
+    if (reader_->Waiting()) {
+      waiting_ = true;
+      return false;
+    }
+    return Fail();
+  }
+
+  bool Fail() {
+    failed_ = true;
+    return false;
+  }
+
+  // Returns false, going back to the last Mark() if that is because the
+  // next bytes haven't arrived.
+  bool Pause() {
+    if (waiting_) reader_->Rewind();
+    return false;
+  }
+
+  bool ReadPalette(uint8_t flags, rgb24* palette) {
+    if (!(flags & 0x80)) return true;
+    return Read(palette, 3 << ((flags & 7) + 1));
+  }
+
+  // Skips data sub-blocks up to and including the terminator, marking each
+  // one, so that a long extension needn't have arrived all at once.
+  bool SkipBlocks() {
+    while (true) {
+      uint8_t size;
+      if (!Read(&size, 1)) return false;
+      if (size != 0 && !Read(block_, size)) return false;
+      reader_->Mark();
+      if (size == 0) return true;
+    }
+  }
+
+  // The next byte of the image data, or -1 after its last sub-block, or if
+  // the next sub-block hasn't arrived yet.
+  inline int NextByte() {
+    if (block_pos_ == block_len_) {
+      if (data_done_) return -1;
+      uint8_t size;
+      if (!Read(&size, 1) || (size != 0 && !Read(block_, size))) {
+        if (!waiting_) data_done_ = true;
+        return -1;
+      }
+      reader_->Mark();
+      if (size == 0) {
+        data_done_ = true;
+        return -1;
+      }
+      block_len_ = size;
+      block_pos_ = 0;
+    }
+    return block_[block_pos_++];
+  }
+
+  // Decodes the image data that has arrived. The state of the LZW decoder
+  // is kept in locals while it runs, and put back only if it has to wait for
+  // more.
+  template <typename Sink>
+  bool DecodePixels(Sink* sink) {
+    const uint16_t clear = 1 << min_code_size_;
+    const uint16_t end = clear + 1;
+    const uint16_t total = w_ * h_;
+    uint16_t next = next_;
+    uint8_t code_size = code_size_;
+    uint32_t bits = bits_;
+    uint8_t bit_count = bit_count_;
+    // Where the last code's string went, none right after a clear code.
+    uint16_t prev_offset = prev_offset_, prev_length = prev_length_;
+    // Pixels decoded, and handed out as rows.
+    uint16_t done = done_, shown = shown_;
+
+    while (done < total) {
+      while (bit_count < code_size) {
+        int byte = NextByte();
+        if (byte < 0) break;
+        bits |= (uint32_t)byte << bit_count;
+        bit_count += 8;
+      }
+      if (bit_count < code_size) {
+        if (waiting_) {
+          next_ = next;
+          code_size_ = code_size;
+          bits_ = bits;
+          bit_count_ = bit_count;
+          prev_offset_ = prev_offset;
+          prev_length_ = prev_length;
+          done_ = done;
+          shown_ = shown;
+          return false;
+        }
+        // The data ran out early: the rest of the frame stays as it was.
+        break;
+      }
+      uint16_t code = bits & ((1 << code_size) - 1);
+      bits >>= code_size;
+      bit_count -= code_size;
+
+      if (code == clear) {
+        next = clear + 2;
+        code_size = min_code_size_ + 1;
+        prev_length = 0;
+        continue;
+      }
+      if (code == end) break;
+      uint8_t* out = &pixels_[done];
+      uint16_t room = total - done;
+      uint16_t length;
+      if (code < clear) {
+        out[0] = code;
+        length = 1;
+      } else if (prev_length == 0 || code > next) {
+        return Fail();
+      } else if (code < next) {
+        length = length_[code];
+        memcpy(out, &pixels_[offset_[code]], min(length, room));
+      } else {
+        // Not in the table yet: the last string plus its own first pixel.
+        length = prev_length + 1;
+        memcpy(out, &pixels_[prev_offset], min(prev_length, room));
+        if (length <= room) out[prev_length] = out[0];
+      }
+      // The new entry is the last string plus this one's first pixel, which
+      // is where it was decoded.
+      if (prev_length > 0 && next < kMaxCodes) {
+        offset_[next] = prev_offset;
+        length_[next] = prev_length + 1;
+        next++;
+        if (next == (1 << code_size) && code_size < 12) code_size++;
+      }
+      prev_offset = done;
+      prev_length = length;
+      done += min(length, room);
+
+      while (done - shown >= w_) {
+        EmitRow(sink, &pixels_[shown], w_);
+        shown += w_;
+        NextRow();
+      }
+    }
+    // A row that was cut short still shows what did arrive.
+    if (done > shown) EmitRow(sink, &pixels_[shown], done - shown);
+    phase_ = kTrailing;
+    return true;
+  }
+
+  template <typename Sink>
+  void EmitRow(Sink* sink, const uint8_t* row, uint16_t count) {
+    sink->Row(left_, top_ + row_y_, row, count, palette_, transparent_);
+  }
+
+  // Interlaced frames come in four passes: every 8th row from 0, every 8th
+  // from 4, every 4th from 2 and every 2nd from 1.
+  void NextRow() {
+    static const uint8_t kStart[] = { 0, 4, 2, 1 };
+    static const uint8_t kStep[] = { 8, 8, 4, 2 };
+    if (!interlaced_) {
+      row_y_++;
+      return;
+    }
+    row_y_ += kStep[pass_];
+    while (row_y_ >= h_ && pass_ < 3) row_y_ = kStart[++pass_];
+  }
+
+  Reader* reader_ = nullptr;
+  bool failed_ = false;
+  bool waiting_ = false;
+  Phase phase_ = kBlocks;
+  uint16_t width_ = 0;
+  uint16_t height_ = 0;
+
+  // How the last frame is disposed of before the next one is drawn, and the
+  // part of the canvas it covered.
+  uint8_t disposal_ = 0;
+  uint16_t clear_x_, clear_y_, clear_w_, clear_h_;
+
+  // The next frame's graphic control extension.
+  uint8_t disposal_next_;
+  size_t delay_ms_;
+  int transparent_;
+
+  // The frame being decoded.
+  uint16_t left_, top_, w_, h_;
+  bool interlaced_;
+  const rgb24* palette_;
+  uint16_t row_y_;
+  uint8_t pass_;
+
+  // The LZW decoder, while it waits for the next sub-block, see
+  // DecodePixels().
+  uint8_t min_code_size_;
+  uint8_t code_size_;
+  uint16_t next_;
+  uint32_t bits_;
+  uint8_t bit_count_;
+  uint16_t prev_offset_, prev_length_;
+  uint16_t done_, shown_;
+
+  uint8_t block_[255];
+  uint8_t block_len_ = 0, block_pos_ = 0;
+  bool data_done_ = false;
+
+  rgb24 global_[256];
+  rgb24 local_[256];
+  // The frame's palette indices in the order they are decoded. Every code's
+  // string is somewhere in there already, so a code is decoded with one copy
+  // rather than by following its prefixes back a pixel at a time.
+  uint8_t pixels_[kMaxPixels];
+  // Where each code's string is in pixels_, and its length.
+  uint16_t offset_[kMaxCodes];
+  uint16_t length_[kMaxCodes];
+};
+
+}  // namespace PanelGif
@@ -0,0 +1,40 @@
+// Where each panel's pixels are, in an animation frame and on the display.
+// Needs rgb24 from SmartMatrix, kPanelsPerPad from SensorConfig.h and
+// kNumPads from led-panel-fsr.ino. The host benchmarks include it too, so
+// they always work on the layout the firmware has.
+
+const uint16_t kPanelWidth = 64;
+// Every panel of every pad, pad by pad in kStates order.
+const uint16_t kNumPanels = kPanelsPerPad * kNumPads;
+//L, D, U, R, within a pad
+const uint16_t kPanelPositions[] = {128, 64, 192, 0};
+const bool kPanelFlipped[] = {false, true, false, true};
+const int8_t kPanelRotation[] = {
+  0, 1, -1, 0,
+  1, 0, 0, 1,
+  1, 0, 0, 1,
+  0, 1, -1, 0
+};
+
+const rgb24 COLOR_BLACK = {
+    0, 0, 0 };
+
+const uint16_t kMatrixWidth = kPanelWidth * kPanelsPerPad;    // Width of one pad's panels, and of the animation frames
+const uint16_t kMatrixHeight = 64;      // Set to the height of your display
+const uint16_t kChainWidth = kMatrixWidth * kNumPads;  // Width of the whole display: the pads are chained one after the other
+
+// Every pad shows the same animation frames, which are kMatrixWidth wide;
+// the display is kChainWidth wide. PanelX() is where a panel is on the
+// display, FrameX() where its pixels are in a frame.
+inline uint16_t FrameX(size_t panel) {
+  return kPanelPositions[panel % kPanelsPerPad];
+}
+
+inline uint16_t PanelX(size_t panel) {
+  return panel / kPanelsPerPad * kMatrixWidth + FrameX(panel);
+}
+
+// Most frames an animation keeps. How many fit depends on how much they
+// change from one to the next and on the memory fitted, see FrameStore.h.
+const size_t maxFrames = 1024;
+const size_t kFrameBytes = kMatrixWidth * kMatrixHeight * sizeof(rgb24);
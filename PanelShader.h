@@ -0,0 +1,142 @@
+#include "PixelMath.h"
+
+// What LedPanel shows. kRenderFrames plays the loaded animation on pressed
+// panels; the other modes are drawn procedurally from each panel's pressure,
+// see SensorState::GetPressure(), and need no frame memory at all.
+enum RenderMode : uint8_t {
+  kRenderFrames,
+  // The whole panel brightens with pressure.
+  kRenderRamp,
+  // The panel fills up from the bottom, reaching the top at the threshold.
+  kRenderFill,
+  // Rings run outwards from the centre, stronger the harder the press.
+  kRenderRipple,
+  kNumRenderModes,
+};
+
+// L, D, U, R, in the same order as kPanelPositions. Every pad uses the same.
+const rgb24 kPanelColors[kPanelsPerPad] = {
+  { 0, 96, 255 }, { 255, 0, 96 }, { 255, 0, 96 }, { 0, 96, 255 },
+};
+
+// Upper bound for drawing one whole procedural frame. LedPanel measures
+// every frame against it, see "r" in SerialProcessor.h.
+const uint32_t kShaderBudgetMicros = 2000;
+
+// Fixed-point shaders for the procedural render modes. A frame is drawn row by
+// row straight into the layer's back buffer: Begin() works out everything
+// that is constant for the frame, then ShadeRow() is called for every row of
+// every panel.
+class PanelShader {
+ public:
+  // Rings repeat every 16 pixels; distances are kept in 1/16 pixels so that
+  // the ring phase is simply the low byte.
+  static const uint8_t kDistanceShift = 4;
+  static const uint16_t kHalf = kPanelWidth / 2;
+  // Rings are 16 pixels apart and move outwards at 32 pixels per second, so
+  // they look the same again every kRingPeriodMs.
+  static const uint32_t kRingPeriodMs = 500;
+  static_assert(kRingPeriodMs * (32 << kDistanceShift) % (1000 << 8) == 0,
+                "The phase must wrap around at the end of a period");
+
+  void Init() {
+    // The distance from the panel's centre, for one quadrant. The other three
+    // are mirror images of it.
+    for (uint16_t y = 0; y < kHalf; y++) {
+      for (uint16_t x = 0; x < kHalf; x++) {
+        float dx = x + 0.5f, dy = y + 0.5f;
+        distance_[y * kHalf + x] =
+            (uint16_t)(sqrtf(dx * dx + dy * dy) * (1 << kDistanceShift));
+      }
+    }
+  }
+
+  // |levels| holds every panel's pressure, 0-255.
+  void Begin(RenderMode mode, const uint8_t* levels, uint32_t now_ms) {
+    mode_ = mode;
+    // Rings move outwards at 32 pixels per second. Only the time into the
+    // period counts, so that the product doesn't overflow after a few hours.
+    phase_ = (now_ms % kRingPeriodMs) * (32 << kDistanceShift) / 1000;
+    for (size_t i = 0; i < kNumPanels; i++) {
+      levels_[i] = levels[i];
+      uint8_t base = mode == kRenderRipple ? levels[i] / 4 : levels[i];
+      base_[i] = QuadOf(ScaleColor(kPanelColors[i % kPanelsPerPad], base));
+      // The fill height in 1/256 rows, all of them at 255.
+      fill_[i] = levels[i] * (kMatrixHeight << 8) / 255;
+    }
+  }
+
+  // Draws row |y| of panel |panel| into |row|, the panel's first pixel in
+  // that row.
+  void ShadeRow(size_t panel, uint8_t y, rgb24* row) const {
+    switch (mode_) {
+      case kRenderRamp:
+        FillQuads(row, base_[panel], kPanelWidth);
+        break;
+      case kRenderFill:
+        ShadeFillRow(panel, y, row);
+        break;
+      case kRenderRipple:
+        ShadeRippleRow(panel, y, row);
+        break;
+      default:
+        break;
+    }
+  }
+
+ private:
+  static inline uint8_t Quadrant(uint16_t coordinate) {
+    return coordinate < kHalf ? kHalf - 1 - coordinate : coordinate - kHalf;
+  }
+
+  // 0 -> 0, 128 -> 254, 255 -> 0.
+  static inline uint8_t Triangle(uint8_t x) {
+    return x < 128 ? x * 2 : (255 - x) * 2;
+  }
+
+  void ShadeFillRow(size_t panel, uint8_t y, rgb24* row) const {
+    // Flipped panels are mounted upside down, so their bottom is row 0.
+    uint16_t height =
+        kPanelFlipped[panel % kPanelsPerPad] ? y : kMatrixHeight - 1 - y;
+    uint16_t lit = fill_[panel] >> 8;
+    if (height < lit) {
+      FillQuads(row, base_[panel], kPanelWidth);
+    } else if (height == lit) {
+      // The partially filled row gets the fractional part of the fill.
+      FillQuads(row, QuadOf(ScaleColor(kPanelColors[panel % kPanelsPerPad],
+                                       fill_[panel] & 0xff)),
+                kPanelWidth);
+    } else {
+      FillQuads(row, QuadOf(COLOR_BLACK), kPanelWidth);
+    }
+  }
+
+  void ShadeRippleRow(size_t panel, uint8_t y, rgb24* row) const {
+    const uint16_t* distances = &distance_[Quadrant(y) * kHalf];
+    const PixelQuad& base = base_[panel];
+    rgb24 color = kPanelColors[panel % kPanelsPerPad];
+    uint8_t level = levels_[panel];
+    uint8_t* out = (uint8_t*)row;
+    for (uint16_t x = 0; x < kPanelWidth; x += 4, out += 12) {
+      rgb24 rings[4];
+      for (uint8_t j = 0; j < 4; j++) {
+        uint8_t ring = Triangle(distances[Quadrant(x + j)] - phase_);
+        rings[j] = ScaleColor(color, (ring * level) >> 8);
+      }
+      // The rings are added on top of the dimmed panel colour, four pixels
+      // (three words) at a time, saturating instead of wrapping.
+      const uint8_t* ring_bytes = (const uint8_t*)rings;
+      for (uint8_t w = 0; w < 3; w++) {
+        StoreWord(out + 4 * w,
+                  AddSaturate8(base.words[w], LoadWord(ring_bytes + 4 * w)));
+      }
+    }
+  }
+
+  RenderMode mode_ = kRenderFrames;
+  uint32_t phase_ = 0;
+  uint8_t levels_[kNumPanels];
+  PixelQuad base_[kNumPanels];
+  uint16_t fill_[kNumPanels];
+  uint16_t distance_[kHalf * kHalf];
+};
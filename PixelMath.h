@@ -0,0 +1,104 @@
+// Arithmetic on four packed 8-bit channels at a time. Uses the Cortex-M7's
+// SIMD instructions where the compiler targets them and 32-bit SWAR
+// everywhere else, which gives the same results.
+//
+// rgb24 rows are worked on as 32-bit words: four pixels are exactly three
+// words. Every row the renderers touch starts on a word boundary, but the
+// loads and stores go through memcpy so the compiler knows they may alias
+// rgb24 data.
+
+inline uint32_t LoadWord(const void* src) {
+  uint32_t word;
+  memcpy(&word, src, sizeof(word));
+  return word;
+}
+
+inline void StoreWord(void* dest, uint32_t word) {
+  memcpy(dest, &word, sizeof(word));
+}
+
+// Per-byte a + b, clamped to 255.
+inline uint32_t AddSaturate8(uint32_t a, uint32_t b) {
+#if defined(__ARM_FEATURE_SIMD32)
+  uint32_t result;
+  asm("uqadd8 %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+  return result;
+#else
+  // Add the low seven bits of every byte, then work out the top bit and the
+  // carry out of it by hand so that nothing crosses into the next byte.
+  uint32_t low = (a & 0x7f7f7f7f) + (b & 0x7f7f7f7f);
+  uint32_t sum = low ^ ((a ^ b) & 0x80808080);
+  uint32_t carry = ((a & b) | ((a | b) & low)) & 0x80808080;
+  return sum | ((carry >> 7) * 0xff);
+#endif
+}
+
+// |color| scaled by |level| / 256.
+inline rgb24 ScaleColor(rgb24 color, uint8_t level) {
+  return (rgb24){ (uint8_t)((color.red * level) >> 8),
+                  (uint8_t)((color.green * level) >> 8),
+                  (uint8_t)((color.blue * level) >> 8) };
+}
+
+// The three words that hold four pixels of |color|.
+struct PixelQuad {
+  uint32_t words[3];
+};
+
+inline PixelQuad QuadOf(rgb24 color) {
+  PixelQuad quad;
+  rgb24 pixels[4] = { color, color, color, color };
+  memcpy(quad.words, pixels, sizeof(quad.words));
+  return quad;
+}
+
+// Fills |count| pixels, a multiple of 4, with |quad|.
+inline void FillQuads(rgb24* dest, const PixelQuad& quad, size_t count) {
+  uint8_t* out = (uint8_t*)dest;
+  for (size_t i = 0; i < count; i += 4, out += 12) {
+    StoreWord(out, quad.words[0]);
+    StoreWord(out + 4, quad.words[1]);
+    StoreWord(out + 8, quad.words[2]);
+  }
+}
+
+// Bytes 0 and 2 of |word| in the low byte of each halfword, i.e.
+// 0x00BB00RR for the word 0xAABBGGRR. UXTB16 on the M7.
+inline uint32_t EvenBytes(uint32_t word) {
+#if defined(__ARM_FEATURE_SIMD32)
+  uint32_t result;
+  asm("uxtb16 %0, %1" : "=r"(result) : "r"(word));
+  return result;
+#else
+  return word & 0x00ff00ff;
+#endif
+}
+
+// Bytes 1 and 3 of |word|, the same way. UXTB16 with a rotation on the M7.
+inline uint32_t OddBytes(uint32_t word) {
+#if defined(__ARM_FEATURE_SIMD32)
+  uint32_t result;
+  asm("uxtb16 %0, %1, ror #8" : "=r"(result) : "r"(word));
+  return result;
+#else
+  return (word >> 8) & 0x00ff00ff;
+#endif
+}
+
+// Per-byte (a * (256 - weight) + b * weight) / 256, for a |weight| of 0-256.
+//
+// Two channels are unpacked into the halves of a word and multiplied together
+// by one 32-bit multiply: each half holds at most 255 * 256, so nothing
+// carries into the other. SMLAD would add the two halves together, which is
+// the opposite of what a per-channel blend needs.
+inline uint32_t Blend8(uint32_t a, uint32_t b, uint32_t weight) {
+  uint32_t inverse = 256 - weight;
+  uint32_t even = EvenBytes(a) * inverse + EvenBytes(b) * weight;
+  uint32_t odd = OddBytes(a) * inverse + OddBytes(b) * weight;
+  return ((even >> 8) & 0x00ff00ff) | (odd & 0xff00ff00);
+}
+
+// An 8-bit alpha as a Blend8() weight, so that 255 is fully |b|.
+inline uint32_t WeightOf(uint8_t alpha) {
+  return alpha + (alpha >> 7);
+}
@@ -0,0 +1,165 @@
+// The matrix refresh rate the panels start at, and the lowest the load
+// policy below may take it to, in Hz.
+const uint16_t kRefreshRate = 60;
+const uint16_t kMinRefreshRate = 30;
+const uint16_t kRefreshRateStep = 10;
+// The longest the sensors may go between two samples, i.e. between two
+// starts of loop(). A second in which the refresh interrupt pushes a gap
+// over this, or takes more than kMaxRefreshLoadPercent of the CPU, lowers
+// the refresh rate by a step.
+const uint32_t kSensorLoopBudgetMicros = 500;
+const uint8_t kMaxRefreshLoadPercent = 20;
+// Seconds in a row that both have to stay under half their limit before the
+// rate goes back up a step.
+const uint8_t kRefreshRaiseWindows = 5;
+const uint32_t kRefreshWindowMicros = 1000000;
+
+// Written by TimedRefreshIsr(), read by RefreshMeter.
+volatile uint32_t refreshIsrCycles HOT_DATA = 0;
+volatile uint32_t refreshIsrCount HOT_DATA = 0;
+volatile uint32_t refreshIsrWorstCycles HOT_DATA = 0;
+void (*refreshIsr)(void) HOT_DATA = nullptr;
+
+// Stands in for SmartMatrix's row calculation interrupt, which is where the
+// refresh spends its CPU time: filling rows from the layers and converting
+// them to bit planes. SmartMatrix raises it as the software interrupt, so
+// this is installed in that vector and times every call of the real one.
+void TimedRefreshIsr() {
+  uint32_t start = ARM_DWT_CYCCNT;
+  refreshIsr();
+  uint32_t cycles = ARM_DWT_CYCCNT - start;
+  refreshIsrCycles += cycles;
+  refreshIsrCount++;
+  if (cycles > refreshIsrWorstCycles) refreshIsrWorstCycles = cycles;
+}
+
+// Measures what the matrix refresh costs the sensor loop, and trades refresh
+// rate for loop time when the loop goes over its budget.
+//
+// Every kRefreshWindowMicros it takes the time spent in the refresh
+// interrupt and the longest gap between two loop() iterations, which is the
+// longest any sensor went unsampled. The refresh depth is a template
+// parameter of SmartMatrix and fixed at build time, so the rate is the only
+// knob: over budget, it drops by kRefreshRateStep down to kMinRefreshRate,
+// and comes back once there is headroom again.
+//
+// Only gaps the refresh is to blame for count against the budget: a gap
+// that would still be over it without the interrupt time inside it, such as
+// the "c" sweep or a benchmark blocking loop(), is reported but left out of
+// the policy, since a lower rate wouldn't shorten it.
+class RefreshMeter {
+ public:
+  // Must run after matrix.begin(), which installs the interrupt.
+  void Init() {
+    ceiling_ = rate_ = kRefreshRate;
+    matrix.setRefreshRate(rate_);
+#if defined(__IMXRT1062__)
+    noInterrupts();
+    refreshIsr = _VectorsRam[IRQ_SOFTWARE + 16];
+    attachInterruptVector(IRQ_SOFTWARE, TimedRefreshIsr);
+    interrupts();
+#endif
+  }
+
+  // Called at the start of every loop().
+  void Loop(uint32_t now_us) {
+    uint32_t cycles_per_us = F_CPU_ACTUAL / 1000000;
+    // A single aligned word, so it reads whole without masking interrupts.
+    uint32_t isr_total = refreshIsrCycles;
+    if (last_loop_ != 0) {
+      uint32_t gap = now_us - last_loop_;
+      uint32_t isr_in_gap = (isr_total - gap_isr_start_) / cycles_per_us;
+      loop_worst_ = max(loop_worst_, gap);
+      if (gap - min(gap, isr_in_gap) <= kSensorLoopBudgetMicros) {
+        refresh_gap_worst_ = max(refresh_gap_worst_, gap);
+      }
+    }
+    last_loop_ = now_us;
+    gap_isr_start_ = isr_total;
+    if (window_start_ == 0) window_start_ = now_us;
+    uint32_t elapsed = now_us - window_start_;
+    if (elapsed < kRefreshWindowMicros) return;
+
+    noInterrupts();
+    uint32_t cycles = refreshIsrCycles;
+    uint32_t count = refreshIsrCount;
+    uint32_t worst = refreshIsrWorstCycles;
+    refreshIsrCycles = refreshIsrCount = refreshIsrWorstCycles = 0;
+    interrupts();
+    // The next gap started at |isr_total|, which is now |cycles| back.
+    gap_isr_start_ = isr_total - cycles;
+
+    isr_micros_ = (uint64_t)cycles / cycles_per_us * 1000000 / elapsed;
+    isr_count_ = (uint64_t)count * 1000000 / elapsed;
+    isr_worst_micros_ = worst / cycles_per_us;
+    loop_worst_micros_ = loop_worst_;
+    refresh_gap_worst_micros_ = refresh_gap_worst_;
+    loop_worst_ = refresh_gap_worst_ = 0;
+    window_start_ = now_us;
+    Adapt();
+  }
+
+  // Sets the highest rate the policy may use, and goes straight to it.
+  void SetCeiling(uint16_t rate) {
+    ceiling_ = rate_ = constrain(rate, kMinRefreshRate, kRefreshRate);
+    calm_windows_ = 0;
+    matrix.setRefreshRate(rate_);
+  }
+
+  // "f <rate Hz> <ceiling Hz> <refresh us per s> <refreshes per s>
+  // <worst refresh us> <worst loop gap us> <lowered>", for the last window.
+  // The last field is 1 when SmartMatrix itself had to lower the rate.
+  void Print() {
+    Serial.print("f ");
+    Serial.print(rate_);
+    Serial.print(" ");
+    Serial.print(ceiling_);
+    Serial.print(" ");
+    Serial.print(isr_micros_);
+    Serial.print(" ");
+    Serial.print(isr_count_);
+    Serial.print(" ");
+    Serial.print(isr_worst_micros_);
+    Serial.print(" ");
+    Serial.print(loop_worst_micros_);
+    Serial.print(" ");
+    Serial.print(matrix.getRefreshRateLoweredFlag() ? 1 : 0);
+    Serial.print("\n");
+  }
+
+ private:
+  void Adapt() {
+    uint32_t load_limit = kMaxRefreshLoadPercent * 10000;
+    bool over = refresh_gap_worst_micros_ > kSensorLoopBudgetMicros ||
+                isr_micros_ > load_limit;
+    bool calm = refresh_gap_worst_micros_ < kSensorLoopBudgetMicros / 2 &&
+                isr_micros_ < load_limit / 2;
+    uint16_t rate = rate_;
+    if (over) {
+      calm_windows_ = 0;
+      rate = max((int)kMinRefreshRate, rate_ - kRefreshRateStep);
+    } else if (calm && ++calm_windows_ >= kRefreshRaiseWindows) {
+      calm_windows_ = 0;
+      rate = min((int)ceiling_, rate_ + kRefreshRateStep);
+    } else if (!calm) {
+      calm_windows_ = 0;
+    }
+    if (rate != rate_) {
+      rate_ = rate;
+      matrix.setRefreshRate(rate_);
+    }
+  }
+
+  uint16_t rate_ = kRefreshRate;
+  uint16_t ceiling_ = kRefreshRate;
+  uint8_t calm_windows_ = 0;
+  uint32_t window_start_ = 0;
+  uint32_t last_loop_ = 0;
+  uint32_t loop_worst_ = 0;
+  // The worst gap the refresh is to blame for, see above.
+  uint32_t refresh_gap_worst_ = 0;
+  // refreshIsrCycles when the current gap started.
+  uint32_t gap_isr_start_ = 0;
+  uint32_t isr_micros_ = 0, isr_count_ = 0, isr_worst_micros_ = 0;
+  uint32_t loop_worst_micros_ = 0, refresh_gap_worst_micros_ = 0;
+};
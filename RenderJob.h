@@ -0,0 +1,104 @@
+// Procedural modes, fades and the idle layer are redrawn at about 60Hz.
+const uint32_t kShaderFrameMs = 16;
+// Frames are drawn a slice per Update(), so that drawing never holds up
+// loop() for long. A slice ends after kRenderSliceMicros or after
+// kRenderSliceRows rows of a panel, whichever comes first; 0 rows means only
+// the time counts. A slice always draws at least one row.
+const uint32_t kRenderSliceMicros = 100;
+const uint16_t kRenderSliceRows = 0;
+// A frame that takes longer than this from start to swap counts as a missed
+// deadline, see "r" in SerialProcessor.h.
+const uint32_t kRenderDeadlineMs = kShaderFrameMs;
+
+// A frame that LedPanel draws into the back buffer a slice at a time, and the
+// render time statistics that "r" reports. Drawing the rows is left to the
+// caller, so host/bench_render.cpp runs the same slicing with a simulated
+// cycle counter.
+class RenderJob {
+ public:
+  static uint32_t SliceCycles() {
+    return kRenderSliceMicros * (F_CPU_ACTUAL / 1000000);
+  }
+
+  // Starts a frame that is due on screen kRenderDeadlineMs after |now_ms|.
+  void Start(unsigned long now_ms) {
+    active_ = true;
+    row_ = 0;
+    cycles_ = 0;
+    deadline_ = now_ms + kRenderDeadlineMs;
+    memset(skipped_, 0, sizeof(skipped_));
+  }
+
+  // Leaves out the rows of |panel|, which the DMA draws.
+  void Skip(size_t panel) { skipped_[panel] = true; }
+
+  // Drops the frame, however much of it was drawn.
+  void Cancel() { active_ = false; }
+
+  bool Active() const { return active_; }
+
+  // Draws rows with |draw_row|(panel, y), the rows of every panel in turn,
+  // until the slice is used up. Returns whether every row is drawn.
+  template <typename DrawRow>
+  bool Slice(DrawRow draw_row) {
+    const size_t kRows = kNumPanels * kMatrixHeight;
+    const uint32_t budget = SliceCycles();
+    uint32_t start = ARM_DWT_CYCCNT;
+    uint16_t rows = 0;
+    while (row_ < kRows) {
+      size_t i = row_ / kMatrixHeight;
+      uint8_t y = row_ % kMatrixHeight;
+      if (skipped_[i]) {
+        row_ = (i + 1) * kMatrixHeight;
+        continue;
+      }
+      draw_row(i, y);
+      row_++;
+      rows++;
+      if ((kRenderSliceRows > 0 && rows >= kRenderSliceRows) ||
+          ARM_DWT_CYCCNT - start >= budget) {
+        break;
+      }
+    }
+    uint32_t cycles = ARM_DWT_CYCCNT - start;
+    cycles_ += cycles;
+    slice_worst_micros_ =
+        max(slice_worst_micros_, cycles / (F_CPU_ACTUAL / 1000000));
+    return row_ == kRows;
+  }
+
+  // Ends a frame that Slice() has drawn, as it is handed to the refresh at
+  // |now_ms|. Drawing it should have taken at most |budget_micros|.
+  void Finish(unsigned long now_ms, uint32_t budget_micros) {
+    active_ = false;
+    micros_ = cycles_ / (F_CPU_ACTUAL / 1000000);
+    worst_micros_ = max(worst_micros_, micros_);
+    if (micros_ > budget_micros) overruns_++;
+    if ((long)(now_ms - deadline_) > 0) deadline_misses_++;
+  }
+
+  void ResetStats() {
+    micros_ = worst_micros_ = slice_worst_micros_ = 0;
+    overruns_ = deadline_misses_ = 0;
+  }
+
+  // The last frame's drawing time, the sum of its slices, and the worst.
+  uint32_t micros() const { return micros_; }
+  uint32_t worst_micros() const { return worst_micros_; }
+  // Frames that took longer than their budget to draw.
+  uint32_t overruns() const { return overruns_; }
+  uint32_t slice_worst_micros() const { return slice_worst_micros_; }
+  // Frames that went on screen later than kRenderDeadlineMs after starting.
+  uint32_t deadline_misses() const { return deadline_misses_; }
+
+ private:
+  bool active_ = false;
+  // The next row to draw, counting the rows of every panel in turn.
+  size_t row_ = 0;
+  bool skipped_[kNumPanels] = {};
+  uint32_t cycles_ = 0;
+  unsigned long deadline_ = 0;
+
+  uint32_t micros_ = 0, worst_micros_ = 0, overruns_ = 0;
+  uint32_t slice_worst_micros_ = 0, deadline_misses_ = 0;
+};
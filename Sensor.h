@@ -1,14 +1,26 @@
 // Class containing all relevant information per sensor.
 class Sensor {
  public:
-  Sensor(ADC* adc, uint8_t pin_value, SensorState* sensor_state = nullptr)
-      : initialized_(false), adc_(adc), pin_value_(pin_value),
+  // A sensor wired into a shared state, see PadTopology.h.
+  Sensor(ADC* adc, const SensorTopology& topology, SensorState* sensor_state)
+      : initialized_(false), adc_(adc), pin_value_(topology.pin),
         user_threshold_(kDefaultThreshold),
         #if defined(CAN_AVERAGE)
           moving_average_(kWindowSize),
         #endif
         offset_(0), sensor_state_(sensor_state),
-        should_delete_state_(false) {}
+        should_delete_state_(false), slot_(topology.slot),
+        last_in_state_(topology.last_in_state) {}
+
+  // A sensor with a state of its own, created during Init().
+  Sensor(ADC* adc, uint8_t pin_value)
+      : initialized_(false), adc_(adc), pin_value_(pin_value),
+        user_threshold_(kDefaultThreshold),
+        #if defined(CAN_AVERAGE)
+          moving_average_(kWindowSize),
+        #endif
+        offset_(0), sensor_state_(nullptr),
+        should_delete_state_(false), slot_(0), last_in_state_(true) {}
   
   ~Sensor() {
     if (should_delete_state_) {
@@ -33,12 +45,6 @@ class Sensor {
       // If this sensor created the state, then it's in charge of deleting it.
       should_delete_state_ = true;
     }
-
-    // If this sensor hasn't been added to the state, then try adding it.
-    if (sensor_state_->GetIndexForSensor(sensor_id) == SIZE_MAX) {
-      sensor_state_->AddSensor(sensor_id);
-    }
-    sensor_id_ = sensor_id;
     initialized_ = true;
   }
 
@@ -47,17 +53,23 @@ class Sensor {
     if (!initialized_) {
       return;
     }
-    // If this sensor was never added to the state, then return early.
-    if (sensor_state_->GetIndexForSensor(sensor_id_) == SIZE_MAX) {
+    EvaluateSample(adcTuner.Normalize(latencyTest.Sample(
+                       pin_value_, adc_->analogRead(pin_value_))),
+                   willSend);
+  }
+
+  // Same as EvaluateSensor, but for a value that was already converted, e.g.
+  // by a synchronized read of both sensors of a panel, and normalized with
+  // AdcTuner::Normalize().
+  void EvaluateSample(int16_t sensor_value, bool willSend) {
+    if (!initialized_) {
       return;
     }
 
-    int16_t sensor_value = adc_->analogRead(pin_value_);
-
     #if defined(CAN_AVERAGE)
       // Fetch the updated Weighted Moving Average.
       cur_value_ = moving_average_.GetAverage(sensor_value) - offset_;
-      cur_value_ = constrain(cur_value_, 0, 1023);
+      cur_value_ = constrain(cur_value_, 0, kMaxSensorValue);
     #else
       // Don't use averaging for Arduino Leonardo, Uno, Mega1280, and Mega2560
       // since averaging seems to be broken with it. This should also include
@@ -68,9 +80,18 @@ class Sensor {
     #endif
 
     if (willSend) {
-      sensor_state_->EvaluateSensor(
-        sensor_id_, cur_value_, user_threshold_);
+      EvaluateState();
+    }
+  }
+
+  // For values that were already filtered, e.g. by a CicDecimator, and only
+  // need the offset applied before thresholding.
+  void EvaluateFiltered(int16_t filtered_value) {
+    if (!initialized_) {
+      return;
     }
+    cur_value_ = constrain(filtered_value - offset_, 0, kMaxSensorValue);
+    EvaluateState();
   }
 
   void UpdateThreshold(int16_t new_threshold) {
@@ -93,10 +114,23 @@ class Sensor {
     return user_threshold_;
   }
 
+  uint8_t GetPin() const {
+    return pin_value_;
+  }
+
   // Delete default constructor. Pin number MUST be explicitly specified.
   Sensor() = delete;
  
  private:
+  void EvaluateState() {
+    sensor_state_->EvaluateSensor(slot_, cur_value_, user_threshold_);
+    // The topology guarantees every other sensor of this state has already
+    // been evaluated in this pass.
+    if (last_in_state_) {
+      sensor_state_->Resolve();
+    }
+  }
+
   // Ensures that Init() has been called at exactly once on this Sensor.
   bool initialized_;
   ADC* adc_;
@@ -123,6 +157,8 @@ class Sensor {
   // passed in from outside
   bool should_delete_state_;
 
-  // A unique number corresponding to this sensor. Set during Init().
-  uint8_t sensor_id_;
+  // This sensor's index within its state.
+  uint8_t slot_;
+  // Whether the state is resolved after evaluating this sensor.
+  bool last_in_state_;
 };
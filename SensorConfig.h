@@ -0,0 +1,27 @@
+// The sensor pipeline's sample width, thresholds and window sizes, and how
+// sensors are grouped into panels and panels into pads. The host benchmarks
+// include it too, so they always run the pipeline the firmware has.
+
+#if !defined(__AVR_ATmega32U4__) && !defined(__AVR_ATmega328P__) && \
+    !defined(__AVR_ATmega1280__) && !defined(__AVR_ATmega2560__)
+  #define CAN_AVERAGE
+#endif
+
+// Width of the samples the whole sensor pipeline works with: ADC results are
+// normalized to it, and offsets, filters, thresholds and the values printed
+// over serial are all in these units. At most 13, see MovingAverage.h.
+const uint8_t kPipelineBits = 12;
+// The largest value a sensor can read.
+const int16_t kMaxSensorValue = (1 << kPipelineBits) - 1;
+// Default threshold value for each of the sensors, 1000 out of 1023 at 10
+// bits.
+const int16_t kDefaultThreshold = (int32_t)1000 * kMaxSensorValue / 1023;
+// Max window size for both of the moving averages classes.
+const size_t kWindowSize = 50;
+// Max number of sensors per panel.
+// NOTE(teejusb): This is arbitrary, if you need to support more sensors
+// per panel then just change the following number.
+const size_t kMaxSharedSensors = 2;
+// Panels with a state, a joystick button and an LED panel each, per pad. How
+// many pads there are is NUM_PADS in led-panel-fsr.ino.
+const size_t kPanelsPerPad = 4;
@@ -1,101 +1,83 @@
 // The class that actually evaluates a sensor and actually triggers the button
-// press or release event. If there are multiple sensors added to a
-// SensorState, they will all be evaluated first before triggering the event.
+// press or release event. If there are multiple sensors sharing a
+// SensorState, they are all evaluated first and only then is the state
+// resolved into a press or release.
 class SensorState {
  public:
-  SensorState(uint8_t _buttonNum)
-      : num_sensors_(0),
+  SensorState(uint8_t _buttonNum, size_t num_sensors = 1)
+      : num_sensors_(min(num_sensors, kMaxSharedSensors)),
         #if defined(ENABLE_LIGHTS)
         kLightsPin(curLightPin++),
         #endif
         buttonNum(_buttonNum) {
     for (size_t i = 0; i < kMaxSharedSensors; ++i) {
-      sensor_ids_[i] = 0;
       individual_states_[i] = SensorState::OFF;
+      levels_[i] = 0;
     }
   }
 
-  // Adds a new sensor to share this state with. If we try adding a sensor that
-  // we don't have space for, it's essentially dropped.
-  void AddSensor(uint8_t sensor_id) {
-    if (num_sensors_ < kMaxSharedSensors) {
-      sensor_ids_[num_sensors_++] = sensor_id;
-    }
-  }
-
-  // Evaluates a single sensor as part of the shared state.
-  void EvaluateSensor(uint8_t sensor_id,
+  // Evaluates a single sensor as part of the shared state. |slot| is the
+  // sensor's index within this state, see PadTopology.h.
+  void EvaluateSensor(size_t slot,
                       int16_t cur_value,
                       int16_t user_threshold) {
-    size_t sensor_index = GetIndexForSensor(sensor_id);
-
-    // The sensor we're evaluating is not part of this shared state.
-    // This should not happen.
-    if (sensor_index == SIZE_MAX) {
-      return;
-    }
-
     // If we're above the threshold, turn the individual sensor on.
     if (cur_value >= user_threshold + kPaddingWidth) {
-      individual_states_[sensor_index] = SensorState::ON;
+      individual_states_[slot] = SensorState::ON;
     }
 
     // If we're below the threshold, turn the individual sensor off.
     if (cur_value < user_threshold - kPaddingWidth) {
-      individual_states_[sensor_index] = SensorState::OFF;
+      individual_states_[slot] = SensorState::OFF;
     }
-    
-    // If we evaluated all the sensors this state applies to, only then
-    // should we determine if we want to send a press/release event.
-    bool all_evaluated = (sensor_index == num_sensors_ - 1);
 
-    if (all_evaluated) {
-      switch (combined_state_) {
-        case SensorState::OFF:
-          {
-            // If ANY of the sensors triggered, then we trigger a button press.
-            bool turn_on = false;
-            for (size_t i = 0; i < num_sensors_; ++i) {
-              if (individual_states_[i] == SensorState::ON) {
-                turn_on = true;
-                break;
-              }
-            }
-            if (turn_on) {
-              ButtonPress(buttonNum);
-              combined_state_ = SensorState::ON;
+    // How far along the sensor is towards its threshold, for the LEDs.
+    levels_[slot] = cur_value >= user_threshold
+                        ? 255
+                        : (int32_t)cur_value * 255 / user_threshold;
+  }
+
+  // Sends a press/release event if needed. Must only be called once all the
+  // sensors of this state have been evaluated.
+  void Resolve() {
+    pressure_ = 0;
+    for (size_t i = 0; i < num_sensors_; ++i) {
+      pressure_ = max(pressure_, levels_[i]);
+    }
+    switch (combined_state_) {
+      case SensorState::OFF:
+        {
+          // If ANY of the sensors triggered, then we trigger a button press.
+          bool turn_on = false;
+          for (size_t i = 0; i < num_sensors_; ++i) {
+            if (individual_states_[i] == SensorState::ON) {
+              turn_on = true;
+              break;
             }
           }
-          break;
-        case SensorState::ON:
-          {
-            // ALL of the sensors must be off to trigger a release.
-            // i.e. If any of them are ON we do not release.
-            bool turn_off = true;
-            for (size_t i = 0; i < num_sensors_; ++i) {
-              if (individual_states_[i] == SensorState::ON) {
-                turn_off = false;
-              }
-            }
-            if (turn_off) {
-              ButtonRelease(buttonNum);
-              combined_state_ = SensorState::OFF;
+          if (turn_on) {
+            ButtonPress(buttonNum);
+            combined_state_ = SensorState::ON;
+          }
+        }
+        break;
+      case SensorState::ON:
+        {
+          // ALL of the sensors must be off to trigger a release.
+          // i.e. If any of them are ON we do not release.
+          bool turn_off = true;
+          for (size_t i = 0; i < num_sensors_; ++i) {
+            if (individual_states_[i] == SensorState::ON) {
+              turn_off = false;
             }
           }
-          break;
-      }
-    }
-  }
-
-  // Given a sensor_id, returns the index in the sensor_ids_ array.
-  // Returns SIZE_MAX if not found.
-  size_t GetIndexForSensor(uint8_t sensor_id) {
-    for (size_t i = 0; i < num_sensors_; ++i) {
-      if (sensor_ids_[i] == sensor_id) {
-        return i;
-      }
+          if (turn_off) {
+            ButtonRelease(buttonNum);
+            combined_state_ = SensorState::OFF;
+          }
+        }
+        break;
     }
-    return SIZE_MAX;
   }
 
   // Used to determine the state of each individual sensor, as well as
@@ -104,9 +86,11 @@ class SensorState {
 
   inline State GetCurrentState() const { return combined_state_; }
 
+  // The pressure on the panel as of the last Resolve(), 0-255 with 255 at or
+  // above the threshold. The highest of its sensors.
+  inline uint8_t GetPressure() const { return pressure_; }
+
  private:
-  // The collection of sensors shared with this state.
-  uint8_t sensor_ids_[kMaxSharedSensors];
   // The number of sensors this state combines with.
   size_t num_sensors_;
 
@@ -114,11 +98,15 @@ class SensorState {
   State individual_states_[kMaxSharedSensors];
   // The aggregated state.
   State combined_state_ = SensorState::OFF;
+  // Each sensor's value relative to its threshold, see GetPressure().
+  uint8_t levels_[kMaxSharedSensors];
+  uint8_t pressure_ = 0;
 
   // One-tailed width size to create a window around user_threshold to
-  // mitigate fluctuations by noise. 
+  // mitigate fluctuations by noise. One 10-bit LSB, whatever kPipelineBits is.
   // TODO(teejusb): Make this a user controllable variable.
-  const int16_t kPaddingWidth = 1;
+  const int16_t kPaddingWidth =
+      kPipelineBits > 10 ? 1 << (kPipelineBits - 10) : 1;
 
   // The button number this state corresponds to.
   // Set once in Init().
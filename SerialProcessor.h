@@ -1,3 +1,13 @@
+// An upload that stops arriving for this long is dropped, the same as
+// Serial.readBytes() timing out used to drop it.
+const uint32_t kUploadTimeoutMs = 1000;
+
+enum UploadKind : uint8_t {
+  kNoUpload, kGifUpload, kAssetUpload,
+  // An upload that failed, whose payload is skipped.
+  kDiscardUpload,
+};
+
 class SerialProcessor {
  public:
    void Init(long baud_rate) {
@@ -5,14 +15,18 @@ class SerialProcessor {
   }
 
   void CheckAndMaybeProcessData() {
-    while (Serial.available() > 0) {
-      size_t bytes_read = Serial.readBytesUntil(
-          '\n', buffer_, kBufferSize - 1);
-      buffer_[bytes_read] = '\0';
-
-      if (bytes_read == 0) { return; }
- 
-      switch(buffer_[0]) {
+    ring_.Fill();
+    while (true) {
+      if (upload_ != kNoUpload) {
+        if (!ContinueUpload()) return;
+        continue;
+      }
+      size_t bytes_read;
+      line_ = ring_.NextLine(&bytes_read);
+      if (line_ == nullptr) { return; }
+      if (bytes_read == 0) { continue; }
+
+      switch(line_[0]) {
         case 'o':
         case 'O':
           UpdateOffsets();
@@ -29,6 +43,54 @@ class SerialProcessor {
         case 'G':
           UpdateGif(bytes_read);
           break;
+        case 'a':
+        case 'A':
+          UpdateAsset(bytes_read);
+          break;
+        case 'c':
+        case 'C':
+          TuneAdc(bytes_read);
+          break;
+        case 'l':
+        case 'L':
+          animationLibrary.PrintNames();
+          break;
+        case 'p':
+        case 'P':
+          PlayAnimation(bytes_read);
+          break;
+        case 'i':
+        case 'I':
+          PrintInfo();
+          break;
+        case 'r':
+        case 'R':
+          UpdateRenderMode(bytes_read);
+          break;
+        case 'b':
+        case 'B':
+          BenchmarkComposite(bytes_read);
+          break;
+        case 's':
+        case 'S':
+          BenchmarkSampling(bytes_read);
+          break;
+        case 'f':
+        case 'F':
+          UpdateRefreshRate(bytes_read);
+          break;
+        case 'y':
+        case 'Y':
+          RunLatencyTest(bytes_read);
+          break;
+        case 'm':
+        case 'M':
+          PrintMemoryRegions(kHotObjects, kNumHotObjects);
+          break;
+        case 'e':
+        case 'E':
+          BenchmarkTiers(bytes_read);
+          break;
         case '0' ... '9': // Case ranges are non-standard but work in gcc
           UpdateAndPrintThreshold(bytes_read);
         default:
@@ -38,40 +100,208 @@ class SerialProcessor {
   }
 
   void UpdateGif(size_t bytes_read) {
+    StartUpload(kGifUpload, bytes_read);
+  }
+
+  // Same as UpdateGif, but for a prebuilt .lpa asset from tools/mkasset.py.
+  void UpdateAsset(size_t bytes_read) {
+    StartUpload(kAssetUpload, bytes_read);
+  }
+
+  // Starts taking in the payload of a "<command> <filesize>" line. It is
+  // taken out of the ring by ContinueUpload() as it arrives, over as many
+  // loop() iterations as that takes, so the sensors are sampled all through
+  // a transfer.
+  void StartUpload(UploadKind kind, size_t bytes_read) {
     if (bytes_read < 3) return;
-    size_t filesize = strtoul(buffer_ + 2, nullptr, 10);
+    size_t filesize = strtoul(line_ + 2, nullptr, 10);
     if (filesize == 0) return;
 
-    char* fbuffer = (char*)malloc(filesize);
-    bytes_read = 0;
-    while (bytes_read < filesize) {
-      int result = Serial.readBytes(fbuffer + bytes_read, filesize - bytes_read);
-      if (result <= 0) return;
-      bytes_read += result;
+    upload_left_ = filesize;
+    upload_last_ms_ = millis();
+    upload_ = kind;
+    if (kind == kGifUpload) {
+      // GIFs are decoded straight from the ring, a frame per loop().
+      panel.BeginGif(&ring_, filesize);
+      return;
+    }
+    // Assets are expanded straight from the ring.
+    panel.BeginAsset();
+  }
+
+  // Hands the payload that has arrived to the upload. Returns false if
+  // there was none.
+  bool ContinueUpload() {
+    if (upload_ == kGifUpload) return ContinueGif();
+    size_t length;
+    const uint8_t* data = ring_.Peek(upload_left_, &length);
+    if (length == 0) {
+      if (millis() - upload_last_ms_ > kUploadTimeoutMs) EndUpload(false);
+      return false;
+    }
+    if (upload_ == kAssetUpload && !panel.AddAsset(data, length)) {
+      // The rest of the payload still has to be read past.
+      upload_ = kDiscardUpload;
+    }
+    ring_.Consume(length);
+    upload_left_ -= length;
+    upload_last_ms_ = millis();
+    if (upload_left_ == 0) EndUpload(true);
+    return true;
+  }
+
+  // Decodes a frame of the GIF, if enough of it has arrived, then returns
+  // false to let loop() sample before the next one. While it decodes,
+  // upload_left_ is the part of the file that hasn't arrived yet.
+  bool ContinueGif() {
+    bool decoding = panel.ContinueGif();
+    size_t left = gifReader.Left();
+    if (!decoding) {
+      // Whatever the decoder didn't need is read past.
+      upload_left_ = left;
+      upload_last_ms_ = millis();
+      upload_ = left > 0 ? kDiscardUpload : kNoUpload;
+      return true;
+    }
+    size_t missing = left - min(left, ring_.Size());
+    if (missing < upload_left_) {
+      upload_left_ = missing;
+      upload_last_ms_ = millis();
+    } else if (missing > 0 && millis() - upload_last_ms_ > kUploadTimeoutMs) {
+      EndUpload(false);
+    }
+    return false;
+  }
+
+  // |complete| is false if the transfer was cut short.
+  void EndUpload(bool complete) {
+    if (upload_ == kGifUpload) panel.CancelGif();
+    if (upload_ == kAssetUpload) {
+      if (complete) {
+        panel.EndAsset();
+      } else {
+        panel.CancelAsset();
+      }
+    }
+    upload_ = kNoUpload;
+  }
+
+  // "p <name>" streams <name> from the SD card library, a bare "p" goes back
+  // to the uploaded or built-in animation.
+  void PlayAnimation(size_t bytes_read) {
+    if (bytes_read < 3) {
+      panel.StopLibrary();
+      return;
+    }
+    if (!panel.PlayFromLibrary(line_ + 2)) {
+      Serial.println("Animation not found");
+    }
+  }
+
+  // "r <mode>" switches the panels to a render mode, see PanelShader.h: 0 plays
+  // the animation, 1-3 are procedural. A bare "r" only prints the render time
+  // statistics.
+  void UpdateRenderMode(size_t bytes_read) {
+    if (bytes_read > 2) {
+      unsigned long mode = strtoul(line_ + 2, nullptr, 10);
+      if (mode >= kNumRenderModes) return;
+      panel.SetRenderMode((RenderMode)mode);
+    }
+    panel.PrintRenderStats();
+  }
+
+  // "b <frames>" times the compositor on the worst case, see
+  // LedPanel::BenchmarkComposite(). 100 frames without a count.
+  void BenchmarkComposite(size_t bytes_read) {
+    size_t frames = bytes_read > 2 ? strtoul(line_ + 2, nullptr, 10) : 100;
+    if (frames == 0) return;
+    panel.BenchmarkComposite(frames);
+  }
+
+  // "e <frames>" times blits out of each frame store tier, see
+  // LedPanel::BenchmarkTiers(). 20 frames without a count.
+  void BenchmarkTiers(size_t bytes_read) {
+    size_t frames = bytes_read > 2 ? strtoul(line_ + 2, nullptr, 10) : 20;
+    if (frames == 0) return;
+    panel.BenchmarkTiers(frames);
+  }
+
+  // "s <passes>" times the sensor path, see ::BenchmarkSampling(). 10000
+  // passes without a count.
+  void BenchmarkSampling(size_t bytes_read) {
+    size_t passes = bytes_read > 2 ? strtoul(line_ + 2, nullptr, 10) : 10000;
+    if (passes == 0) return;
+    ::BenchmarkSampling(passes);
+  }
+
+  // "f <rate>" sets the highest refresh rate the load policy may use, in Hz,
+  // see RefreshMeter.h. Both forms print the refresh load.
+  void UpdateRefreshRate(size_t bytes_read) {
+    if (bytes_read > 2) {
+      unsigned long rate = strtoul(line_ + 2, nullptr, 10);
+      if (rate == 0) return;
+      refreshMeter.SetCeiling(rate);
     }
-    panel.SetGif(fbuffer, filesize);
-    free(fbuffer);
+    refreshMeter.Print();
+  }
+
+  // "y <sensor> <runs>" measures the latency from a synthetic step on
+  // <sensor> to the button press and the HID report, see LatencyTest.h. 100
+  // runs without a count. The results are printed once the runs are done; a
+  // bare "y" prints them again.
+  void RunLatencyTest(size_t bytes_read) {
+    if (bytes_read < 3) {
+      if (!latencyTest.Running()) latencyTest.Print();
+      return;
+    }
+    char* next = nullptr;
+    size_t sensor = strtoul(line_ + 2, &next, 10);
+    if (sensor >= kNumSensors || latencyTest.Running()) return;
+    unsigned long runs = strtoul(next, nullptr, 10);
+    // Clamped here, before it is narrowed: 65536 would wrap to no runs.
+    runs = min(runs, (unsigned long)kMaxLatencyRuns);
+    StartLatencyTest(sensor, runs > 0 ? runs : 100);
+  }
+
+  // "c <noise budget>" sweeps the ADC configurations and applies the fastest
+  // one whose idle noise stays within the budget (standard deviation, in
+  // LSBs). Without a budget, 1 LSB is used.
+  void TuneAdc(size_t bytes_read) {
+    float budget = bytes_read > 2 ? strtof(line_ + 2, nullptr) : 1.0f;
+    SweepAdc(budget);
   }
 
   void UpdateAndPrintThreshold(size_t bytes_read) {
     // Need to specify:
     // Sensor number + Threshold value, separated by a space.
-    // {0, 1, 2, 3,...} + "0"-"1023"
+    // {0, 1, 2, 3,...} + "0"-kMaxSensorValue
     // e.g. 3 180 (fourth FSR, change threshold to 180)
     
     if (bytes_read < 3 || bytes_read > 7) { return; }
 
     char* next = nullptr;
-    size_t sensor_index = strtoul(buffer_, &next, 10);
+    size_t sensor_index = strtoul(line_, &next, 10);
     if (sensor_index >= kNumSensors) { return; }
 
     int16_t sensor_threshold = strtol(next, nullptr, 10);
-    if (sensor_threshold < 0 || sensor_threshold > 1023) { return; }
+    if (sensor_threshold < 0 || sensor_threshold > kMaxSensorValue) {
+      return;
+    }
 
     kSensors[sensor_index].UpdateThreshold(sensor_threshold);
     PrintThresholds();
   }
 
+  // "i <bits> <max>": the width of the values that "v" prints and "t" and
+  // threshold updates use, so a client can scale them.
+  void PrintInfo() {
+    Serial.print("i ");
+    Serial.print(kPipelineBits);
+    Serial.print(" ");
+    Serial.print(kMaxSensorValue);
+    Serial.print("\n");
+  }
+
   void UpdateOffsets() {
     for (size_t i = 0; i < kNumSensors; ++i) {
       kSensors[i].UpdateOffset();
@@ -97,6 +327,11 @@ class SerialProcessor {
   }
 
  private:
-   static const size_t kBufferSize = 64;
-   char buffer_[kBufferSize];
+  SerialRing ring_;
+  // The line being processed, in place in ring_.
+  char* line_ = nullptr;
+
+  UploadKind upload_ = kNoUpload;
+  size_t upload_left_ = 0;
+  uint32_t upload_last_ms_ = 0;
 };
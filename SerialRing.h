@@ -0,0 +1,89 @@
+// Serial input held between loop() iterations, in bytes. A power of two.
+const size_t kSerialRingSize = 4096;
+// Longest command line. Longer lines are cut into pieces of this size less
+// one, the same as readBytesUntil() into a buffer of this size did.
+const size_t kMaxCommandLength = 64;
+
+// Receive buffer of SerialProcessor.
+//
+// Fill() moves whatever the USB stack has received into the ring with as few
+// bulk reads as possible. Commands are then parsed where they landed, and
+// upload payloads are handed to their handler as spans of the ring, so
+// nothing is copied again or allocated on the way.
+//
+// A line that wraps around the end of the ring is made contiguous in the
+// kMaxCommandLength bytes past the end, so a handler always gets one
+// NUL-terminated string.
+class SerialRing {
+ public:
+  void Fill() {
+    while (true) {
+      size_t free = kSerialRingSize - Size();
+      int available = Serial.available();
+      if (free == 0 || available <= 0) return;
+      size_t at = head_ & kMask;
+      size_t count = min(min((size_t)available, free), kSerialRingSize - at);
+      size_t read = Serial.readBytes((char*)data_ + at, count);
+      head_ += read;
+      if (read < count) return;
+    }
+  }
+
+  size_t Size() const { return head_ - tail_; }
+
+  // Takes the next line out of the ring and returns it NUL-terminated, with
+  // its length in |length|, or returns nullptr if no line is complete yet.
+  // The line stays valid until the next Fill().
+  char* NextLine(size_t* length) {
+    size_t limit = min(Size(), kMaxCommandLength - 1);
+    size_t at = tail_ & kMask;
+    size_t n = 0;
+    while (n < limit && data_[(at + n) & kMask] != '\n') n++;
+    bool cut = n == kMaxCommandLength - 1;
+    if (n == limit && !cut) return nullptr;
+
+    *length = n;
+    if (cut) {
+      // No newline to put the terminator in, and the next byte belongs to
+      // the next line.
+      for (size_t i = 0; i < n; i++) cut_[i] = data_[(at + i) & kMask];
+      cut_[n] = '\0';
+      tail_ += n;
+      return cut_;
+    }
+    if (at + n > kSerialRingSize) {
+      memcpy(data_ + kSerialRingSize, data_, at + n - kSerialRingSize);
+    }
+    char* line = (char*)data_ + at;
+    line[n] = '\0';
+    tail_ += n + 1;
+    return line;
+  }
+
+  // The longest run of unread bytes that is contiguous in the ring, at most
+  // |max| of them. Consume() them once they have been used.
+  const uint8_t* Peek(size_t max, size_t* length) const {
+    return Peek(0, max, length);
+  }
+
+  // The same, from |offset| bytes past the oldest unread one.
+  const uint8_t* Peek(size_t offset, size_t max, size_t* length) const {
+    size_t at = (tail_ + offset) & kMask;
+    *length = min(min(Size() - min(Size(), offset), max),
+                  kSerialRingSize - at);
+    return data_ + at;
+  }
+
+  void Consume(size_t count) { tail_ += count; }
+
+ private:
+  static const size_t kMask = kSerialRingSize - 1;
+  static_assert((kSerialRingSize & kMask) == 0,
+                "kSerialRingSize must be a power of two");
+
+  // Free-running, only their low bits index the ring.
+  size_t head_ = 0;
+  size_t tail_ = 0;
+  uint8_t data_[kSerialRingSize + kMaxCommandLength];
+  char cut_[kMaxCommandLength];
+};
@@ -9,9 +9,11 @@
   }
   void ButtonPress(uint8_t button_num) {
     Joystick.button(button_num, 1);
+    latencyTest.OnButton(button_num, true);
   }
   void ButtonRelease(uint8_t button_num) {
     Joystick.button(button_num, 0);
+    latencyTest.OnButton(button_num, false);
   }
 #else
   #include <Keyboard.h>
@@ -21,8 +23,10 @@
   }
   void ButtonPress(uint8_t button_num) {
     Keyboard.press('a' + button_num - 1);
+    latencyTest.OnButton(button_num, true);
   }
   void ButtonRelease(uint8_t button_num) {
     Keyboard.release('a' + button_num - 1);
+    latencyTest.OnButton(button_num, false);
   }
 #endif
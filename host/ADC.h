@@ -0,0 +1,39 @@
+// Stand-in for the Teensy ADC library. Host benchmarks feed samples to
+// Sensor::EvaluateSample() directly, so conversions always read zero.
+#ifndef HOST_ADC_H_
+#define HOST_ADC_H_
+
+#include "arduino_shim.h"
+
+enum class ADC_CONVERSION_SPEED : uint8_t {
+  VERY_LOW_SPEED, LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED,
+};
+enum class ADC_SAMPLING_SPEED : uint8_t {
+  VERY_LOW_SPEED, LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED,
+};
+
+class ADC_Module {
+ public:
+  void setAveraging(uint8_t) {}
+  void setResolution(uint8_t) {}
+  void setConversionSpeed(ADC_CONVERSION_SPEED) {}
+  void setSamplingSpeed(ADC_SAMPLING_SPEED) {}
+  bool checkPin(uint8_t) { return true; }
+  int analogRead(uint8_t) { return 0; }
+};
+
+class ADC {
+ public:
+  struct Sync_result {
+    int32_t result_adc0, result_adc1;
+  };
+  ADC_Module* adc0 = &modules_[0];
+  ADC_Module* adc1 = &modules_[1];
+  int analogRead(uint8_t) { return 0; }
+  Sync_result analogSynchronizedRead(uint8_t, uint8_t) { return {0, 0}; }
+
+ private:
+  ADC_Module modules_[2];
+};
+
+#endif  // HOST_ADC_H_
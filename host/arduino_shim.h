@@ -0,0 +1,42 @@
+// The small part of the Arduino/Teensy API that the firmware's filter and
+// sensor headers use, so they can be compiled unchanged for host benchmarks.
+#ifndef HOST_ARDUINO_SHIM_H_
+#define HOST_ARDUINO_SHIM_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+#define constrain(amt, low, high) \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define INPUT 0
+inline void pinMode(uint8_t, uint8_t) {}
+
+// Only used for timing on the device; reads as zero here.
+#define F_CPU_ACTUAL 600000000
+inline uint32_t ARM_DWT_CYCCNT = 0;
+
+// There is no OCRAM here, so data placed there is ordinary memory.
+#define DMAMEM
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// Serial output from the firmware is dropped.
+class HostSerial {
+ public:
+  template <typename T> size_t print(T) { return 0; }
+  template <typename T> size_t print(T, int) { return 0; }
+  template <typename T> size_t println(T) { return 0; }
+  size_t println() { return 0; }
+};
+inline HostSerial Serial;
+
+#endif  // HOST_ARDUINO_SHIM_H_
@@ -0,0 +1,210 @@
+// Speed and exactness benchmark for the LED compositor and procedural shaders.
+//
+// Reports the time to produce one whole 256x64 frame for:
+//   - the compositor with every panel mid-fade, so every pixel is blended,
+//   - the same blend done one channel at a time,
+//   - the compositor with every panel fully on (row copies) and fully idle
+//     (row fills),
+//   - every procedural shader at full pressure,
+// and checks that the packed blend gives exactly the scalar blend's result
+// for every alpha, that AddSaturate8() gives min(a + b, 255) in every byte
+// for every pair of bytes, whatever the other bytes hold, and that the
+// ripple shader draws the same rings after days of uptime as after a few
+// periods. Fails if any of these doesn't hold, or if a worst-case composite
+// takes longer than kCompositeBudgetMicros.
+//
+// These are host timings: the budget check catches gross regressions, the
+// numbers that matter come from "b" on the device.
+//
+// Build and run with `make bench` from this directory.
+
+#include <stdio.h>
+#include <vector>
+
+#include "bench_util.h"
+
+#include "PanelShader.h"
+#include "Compositor.h"
+
+namespace {
+
+const size_t kFramePixels = kMatrixWidth * kMatrixHeight;
+const size_t kDisplayPixels = kChainWidth * kMatrixHeight;
+const size_t kFrames = 2000;
+
+std::vector<rgb24> MakeFrame() {
+  std::vector<rgb24> frame(kFramePixels);
+  uint32_t seed = 12345;
+  for (rgb24& pixel : frame) {
+    seed = seed * 1664525u + 1013904223u;
+    pixel = { (uint8_t)(seed >> 24), (uint8_t)(seed >> 16), (uint8_t)(seed >> 8) };
+  }
+  return frame;
+}
+
+void Composite(Compositor* compositor, const uint8_t* alphas,
+               const rgb24* frame, rgb24* dest, uint32_t now) {
+  compositor->Begin(alphas, frame, now);
+  for (size_t i = 0; i < kNumPanels; i++) {
+    for (uint8_t y = 0; y < kMatrixHeight; y++) {
+      compositor->ComposeRow(i, y, dest);
+    }
+  }
+}
+
+// Checks AddSaturate8() against the scalar sum for every pair of bytes, in
+// every lane, with random bytes in the other lanes. Returns the mismatches.
+size_t SaturateMismatches() {
+  size_t bad = 0;
+  uint32_t seed = 54321;
+  for (unsigned a = 0; a < 256; a++) {
+    for (unsigned b = 0; b < 256; b++) {
+      seed = seed * 1664525u + 1013904223u;
+      uint32_t x = seed;
+      seed = seed * 1664525u + 1013904223u;
+      uint32_t y = seed;
+      for (int lane = 0; lane < 4; lane++) {
+        uint32_t shift = 8 * lane;
+        uint32_t mask = ~(0xffu << shift);
+        uint32_t sum = AddSaturate8((x & mask) | a << shift,
+                                    (y & mask) | b << shift);
+        for (int i = 0; i < 4; i++) {
+          unsigned xi = i == lane ? a : (x >> 8 * i) & 0xff;
+          unsigned yi = i == lane ? b : (y >> 8 * i) & 0xff;
+          if (((sum >> 8 * i) & 0xff) != min(xi + yi, 255u)) {
+            bad++;
+            break;
+          }
+        }
+      }
+    }
+  }
+  return bad;
+}
+
+// Whether the ripple shader draws the same frame at |now_ms| and at
+// |later_ms|, a whole number of ring periods on.
+bool SameRipple(PanelShader* shader, const uint8_t* levels, uint32_t now_ms,
+                uint32_t later_ms) {
+  std::vector<rgb24> first(kDisplayPixels), second(kDisplayPixels);
+  for (std::vector<rgb24>* frame : { &first, &second }) {
+    shader->Begin(kRenderRipple, levels, frame == &first ? now_ms : later_ms);
+    for (size_t i = 0; i < kNumPanels; i++) {
+      for (uint8_t y = 0; y < kMatrixHeight; y++) {
+        shader->ShadeRow(i, y, &(*frame)[kChainWidth * y + PanelX(i)]);
+      }
+    }
+  }
+  return memcmp(first.data(), second.data(), kDisplayPixels * sizeof(rgb24))
+      == 0;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<rgb24> frame = MakeFrame();
+  std::vector<rgb24> dest(kDisplayPixels), expected(kDisplayPixels);
+  Compositor compositor;
+  int failures = 0;
+
+  // Exactness of the packed blend, for every alpha.
+  for (unsigned alpha = 0; alpha < 256; alpha++) {
+    uint8_t alphas[kNumPanels];
+    memset(alphas, alpha, sizeof(alphas));
+    Composite(&compositor, alphas, frame.data(), dest.data(), 0);
+    for (size_t i = 0; i < kNumPanels; i++) {
+      rgb24 idle = ScaleColor(kPanelColors[i % kPanelsPerPad], kIdleLevel / 2);
+      for (uint8_t y = 0; y < kMatrixHeight; y++) {
+        size_t offset = kChainWidth * y + PanelX(i);
+        Compositor::BlendRowScalar(&expected[offset],
+                                   &frame[kMatrixWidth * y + FrameX(i)], idle,
+                                   WeightOf(alpha));
+        if (memcmp(&expected[offset], &dest[offset],
+                   kPanelWidth * sizeof(rgb24)) != 0) {
+          printf("Packed blend differs from scalar at alpha %u panel %zu "
+                 "row %u\n", alpha, i, y);
+          failures++;
+          break;
+        }
+      }
+    }
+  }
+
+  size_t saturate_bad = SaturateMismatches();
+  if (saturate_bad > 0) {
+    printf("AddSaturate8 differs from min(a + b, 255) %zu times\n",
+           saturate_bad);
+    failures++;
+  }
+
+  uint8_t fading[kNumPanels], on[kNumPanels], off[kNumPanels];
+  memset(fading, 128, sizeof(fading));
+  memset(on, 255, sizeof(on));
+  memset(off, 0, sizeof(off));
+  uint32_t now = 0;
+
+  PanelShader shader;
+  shader.Init();
+  // Past the 2.3 hours after which now_ms * 512 overflows, and right before
+  // millis() itself wraps.
+  const uint32_t kPeriod = PanelShader::kRingPeriodMs;
+  for (uint32_t uptime : { 3u * 3600 * 1000, UINT32_MAX - kPeriod }) {
+    for (uint32_t into : { 0u, 123u, kPeriod - 1 }) {
+      uint32_t later = uptime - uptime % kPeriod + into;
+      if (!SameRipple(&shader, fading, into, later)) {
+        printf("Ripple at %ums differs from %ums\n", later, into);
+        failures++;
+      }
+    }
+  }
+
+  struct Result {
+    const char* name;
+    double micros;
+  };
+  std::vector<Result> results;
+  double blend = MicrosPerCall(kFrames, [&]() {
+    Composite(&compositor, fading, frame.data(), dest.data(), now++);
+  });
+  results.push_back({ "composite blend", blend });
+  results.push_back({ "composite blend scalar", MicrosPerCall(kFrames, [&]() {
+    for (size_t i = 0; i < kNumPanels; i++) {
+      for (uint8_t y = 0; y < kMatrixHeight; y++) {
+        Compositor::BlendRowScalar(&dest[kChainWidth * y + PanelX(i)],
+                                   &frame[kMatrixWidth * y + FrameX(i)],
+                                   kPanelColors[i % kPanelsPerPad],
+                                   WeightOf(128));
+      }
+    }
+  }) });
+  results.push_back({ "composite copy", MicrosPerCall(kFrames, [&]() {
+    Composite(&compositor, on, frame.data(), dest.data(), now++);
+  }) });
+  results.push_back({ "composite idle", MicrosPerCall(kFrames, [&]() {
+    Composite(&compositor, off, frame.data(), dest.data(), now++);
+  }) });
+
+  const char* shader_names[] = { nullptr, "shader ramp", "shader fill",
+                                 "shader ripple" };
+  for (uint8_t mode = kRenderRamp; mode < kNumRenderModes; mode++) {
+    results.push_back({ shader_names[mode], MicrosPerCall(kFrames, [&]() {
+      shader.Begin((RenderMode)mode, on, now++);
+      for (size_t i = 0; i < kNumPanels; i++) {
+        for (uint8_t y = 0; y < kMatrixHeight; y++) {
+          shader.ShadeRow(i, y, &dest[kChainWidth * y + PanelX(i)]);
+        }
+      }
+    }) });
+  }
+
+  printf("%-24s %10s\n", "kernel", "us/frame");
+  for (const Result& result : results) {
+    printf("%-24s %10.2f\n", result.name, result.micros);
+  }
+  if (blend > kCompositeBudgetMicros) {
+    printf("Worst-case composite over budget: %.2fus > %uus\n", blend,
+           (unsigned)kCompositeBudgetMicros);
+    failures++;
+  }
+  return failures > 0 ? 1 : 0;
+}
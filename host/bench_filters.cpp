@@ -0,0 +1,260 @@
+// Speed and accuracy benchmark for the firmware's smoothing kernels.
+//
+// For every kernel and window size this reports:
+//   - ns/sample and samples/second over a long noisy signal,
+//   - for each synthetic signal (step, ramp, noise and a full-scale step that
+//     probes headroom): the maximum error against a double-precision
+//     reference that saturates where the firmware does, the number of
+//     overflow events and, for steps, the lag in samples until the output
+//     crosses half the step height.
+//
+// Overflow events are counted in the reference, which works out every
+// intermediate the firmware keeps in an integer exactly and checks it
+// against that integer's range: the WMA sums against int32, the Hull input
+// 2 * WMA(n/2) - WMA(n) against the int16 it is saturated to, and the CIC
+// output against int32. A sum past its range would have wrapped, a Hull
+// input past it was clamped.
+//
+// Build and run with `make bench` from this directory.
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdio.h>
+#include <vector>
+
+#include "bench_sensors.h"
+#include "MovingAverage.h"
+#include "CicDecimator.h"
+
+namespace {
+
+const size_t kSignalLength = 4000;
+const size_t kStepAt = 1000;
+const size_t kSpeedSamples = 2000000;
+
+struct Signal {
+  const char* name;
+  std::vector<int16_t> samples;
+  // Height of the step at kStepAt, or 0 if the signal has no step.
+  int16_t step;
+};
+
+std::vector<Signal> MakeSignals() {
+  std::vector<Signal> signals;
+  Signal step = { "step", {}, 800 };
+  Signal ramp = { "ramp", {}, 0 };
+  Signal noise = { "noise", {}, 0 };
+  Signal full = { "fullscale", {}, 32000 };
+  // Deterministic Gaussian noise (Box-Muller over an LCG).
+  uint32_t seed = 12345;
+  auto uniform = [&seed]() {
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) / double(1 << 24) + 1e-9;
+  };
+  for (size_t i = 0; i < kSignalLength; i++) {
+    step.samples.push_back(i < kStepAt ? 0 : step.step);
+    ramp.samples.push_back(min<size_t>(i, 2000) / 2);
+    double gauss = sqrt(-2 * log(uniform())) * cos(2 * M_PI * uniform());
+    noise.samples.push_back(500 + (int16_t)lround(30 * gauss));
+    full.samples.push_back(i < kStepAt ? 0 : full.step);
+  }
+  signals.push_back(step);
+  signals.push_back(ramp);
+  signals.push_back(noise);
+  signals.push_back(full);
+  return signals;
+}
+
+// Counts intermediates that leave the range of the integer the firmware
+// keeps them in. Doubles hold every one of them exactly.
+struct RangeCheck {
+  size_t events = 0;
+
+  template <typename Int>
+  double Check(double value) {
+    if (value < std::numeric_limits<Int>::min() ||
+        value > std::numeric_limits<Int>::max()) {
+      events++;
+    }
+    return value;
+  }
+};
+
+// Double-precision WMA with the same zero-filled start as the firmware's.
+class ReferenceWma {
+ public:
+  ReferenceWma(size_t size, RangeCheck* range)
+      : values_(min(size, kWindowSize), 0.0), range_(range) {}
+  double Step(double value) {
+    values_.pop_front();
+    values_.push_back(value);
+    double sum = 0, weighted = 0;
+    size_t n = values_.size();
+    for (size_t i = 0; i < n; i++) {
+      sum += values_[i];
+      weighted += (i + 1) * values_[i];
+    }
+    range_->Check<int32_t>(sum);
+    range_->Check<int32_t>(weighted);
+    return weighted / (n * (n + 1) / 2.0);
+  }
+
+ private:
+  std::deque<double> values_;
+  RangeCheck* range_;
+};
+
+// The firmware saturates the Hull input to int16, and so does this.
+class ReferenceHma {
+ public:
+  ReferenceHma(size_t size, RangeCheck* range)
+      : wma1_(size / 2, range), wma2_(size, range),
+        hull_((size_t)sqrt(size), range), range_(range) {}
+  double Step(double value) {
+    double input = range_->Check<int16_t>(2 * wma1_.Step(value) -
+                                          wma2_.Step(value));
+    return hull_.Step(constrain(input, (double)INT16_MIN, (double)INT16_MAX));
+  }
+
+ private:
+  ReferenceWma wma1_, wma2_, hull_;
+  RangeCheck* range_;
+};
+
+// kOrder cascaded length-kRatio boxcars, i.e. a CIC normalized to unity gain.
+class ReferenceCic {
+ public:
+  ReferenceCic(int order, int ratio, int gain_bits, RangeCheck* range)
+      : stages_(order, std::deque<double>(ratio, 0.0)),
+        gain_(1 << gain_bits), range_(range) {}
+  double Step(double value) {
+    for (auto& stage : stages_) {
+      stage.pop_front();
+      stage.push_back(value);
+      double sum = 0;
+      for (double v : stage) sum += v;
+      value = sum / stage.size();
+    }
+    // What Output() holds before it is scaled back down.
+    range_->Check<int32_t>(value * gain_);
+    return value;
+  }
+
+ private:
+  std::vector<std::deque<double>> stages_;
+  double gain_;
+  RangeCheck* range_;
+};
+
+// A kernel under test: Step() returns false for inputs that produce no
+// output (decimators), otherwise stores the output in |out|.
+struct Kernel {
+  const char* name;
+  size_t window;
+  std::function<bool(int16_t, double*)> step;
+  std::function<double(double)> reference;
+  // The reference's count of out-of-range intermediates.
+  std::shared_ptr<RangeCheck> range;
+};
+
+template <uint8_t kOrder, uint16_t kRatio>
+Kernel MakeCic(const char* name) {
+  const int kGainBits = CicDecimator<kOrder, kRatio>::kGainBits;
+  auto cic = std::make_shared<CicDecimator<kOrder, kRatio>>();
+  auto range = std::make_shared<RangeCheck>();
+  auto ref = std::make_shared<ReferenceCic>(kOrder, kRatio, kGainBits,
+                                            range.get());
+  return Kernel{
+      name, kRatio,
+      [cic](int16_t v, double* out) {
+        if (!cic->Push(v)) return false;
+        *out = cic->Output() / double(1 << kGainBits);
+        return true;
+      },
+      [ref](double v) { return ref->Step(v); }, range};
+}
+
+std::vector<Kernel> MakeKernels() {
+  std::vector<Kernel> kernels;
+  const size_t windows[] = { 4, 8, 16, 32, 50 };
+  for (size_t window : windows) {
+    auto wma = std::make_shared<WeightedMovingAverage>(window);
+    auto range = std::make_shared<RangeCheck>();
+    auto wma_ref = std::make_shared<ReferenceWma>(window, range.get());
+    kernels.push_back(Kernel{
+        "WeightedMovingAverage", window,
+        [wma](int16_t v, double* out) { *out = wma->GetAverage(v); return true; },
+        [wma_ref](double v) { return wma_ref->Step(v); }, range});
+  }
+  for (size_t window : windows) {
+    auto hma = std::make_shared<HullMovingAverage>(window);
+    auto range = std::make_shared<RangeCheck>();
+    auto hma_ref = std::make_shared<ReferenceHma>(window, range.get());
+    kernels.push_back(Kernel{
+        "HullMovingAverage", window,
+        [hma](int16_t v, double* out) { *out = hma->GetAverage(v); return true; },
+        [hma_ref](double v) { return hma_ref->Step(v); }, range});
+  }
+  kernels.push_back(MakeCic<1, 8>("CicDecimator<1>"));
+  kernels.push_back(MakeCic<2, 8>("CicDecimator<2>"));
+  kernels.push_back(MakeCic<3, 8>("CicDecimator<3>"));
+  kernels.push_back(MakeCic<3, 16>("CicDecimator<3>"));
+  kernels.push_back(MakeCic<3, 32>("CicDecimator<3>"));
+  return kernels;
+}
+
+// Kernels are stateful, so each measurement gets a fresh one.
+Kernel Fresh(size_t index) { return MakeKernels()[index]; }
+
+double NanosPerSample(size_t index, const std::vector<int16_t>& noise) {
+  Kernel kernel = Fresh(index);
+  double sink = 0, out = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kSpeedSamples; i++) {
+    if (kernel.step(noise[i % noise.size()], &out)) sink += out;
+  }
+  auto end = std::chrono::steady_clock::now();
+  // Keep the loop from being optimized away.
+  volatile double keep = sink;
+  (void)keep;
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         kSpeedSamples;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<Signal> signals = MakeSignals();
+  size_t num_kernels = MakeKernels().size();
+
+  printf("%-22s %6s %10s %12s  %-9s %9s %9s %5s\n", "kernel", "window",
+         "ns/sample", "samples/s", "signal", "max_err", "overflows", "lag");
+  for (size_t k = 0; k < num_kernels; k++) {
+    double ns = NanosPerSample(k, signals[2].samples);
+    for (const Signal& signal : signals) {
+      Kernel kernel = Fresh(k);
+      double max_error = 0, out = 0;
+      long lag = -1;
+      for (size_t i = 0; i < signal.samples.size(); i++) {
+        double expected = kernel.reference(signal.samples[i]);
+        if (!kernel.step(signal.samples[i], &out)) continue;
+        double error = fabs(out - expected);
+        max_error = max(max_error, error);
+        if (signal.step != 0 && lag < 0 && i >= kStepAt &&
+            out >= signal.step / 2.0) {
+          lag = i - kStepAt;
+        }
+      }
+      char lag_text[16] = "-";
+      if (signal.step != 0) snprintf(lag_text, sizeof(lag_text), "%ld", lag);
+      printf("%-22s %6zu %10.2f %12.0f  %-9s %9.2f %9zu %5s\n", kernel.name,
+             kernel.window, ns, 1e9 / ns, signal.name, max_error,
+             kernel.range->events,
+             lag_text);
+    }
+  }
+  return 0;
+}
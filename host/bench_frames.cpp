@@ -0,0 +1,252 @@
+// Size, speed and exactness benchmark for the delta-encoded frame store.
+//
+// Fills FrameStore.h with:
+//   - ../ldur.lpa, through PanelAsset::Loader as BeginAsset() does,
+//   - ../ldur.gif, through PanelGif.h as BeginGif() does,
+//   - a synthetic step animation, a lit arrow sliding across each panel over
+//     a steady background, kSyntheticFrames long,
+//   - frames of noise, which don't compress at all,
+// and checks that several loops of playback give exactly the frames and
+// delays that went in, also with the deltas applied a kApplyBytes slice per
+// Prepare() call ahead of Next() as Update() does, and that a store copied
+// the way FrameCache does plays back the same. Reports the bytes stored
+// against whole frames, how many frames fit, and the time per Next() against
+// copying a whole frame. Fails if anything differs, if any animation takes
+// more bytes than its whole frames would, or if fewer than
+// kMinSyntheticFrames synthetic frames fit, far more than the
+// kFrameStoreBytes / kFrameBytes whole frames that would.
+//
+// Build and run with `make bench` from this directory.
+
+#include <stdio.h>
+#include <vector>
+
+#include "bench_util.h"
+
+#include "FrameStore.h"
+#include "PanelGif.h"
+#include "PanelAsset.h"
+
+namespace {
+
+const size_t kSyntheticFrames = 64;
+const size_t kMinSyntheticFrames = 32;
+const size_t kLoops = 3;
+const size_t kRepeats = 2000;
+// Prepare() slices before each Next(), fewer than a frame that changed
+// everywhere takes, so that Next() finishes some.
+const size_t kSlices = 8;
+
+// What went into a store, a whole frame at a time.
+struct Frames {
+  std::vector<rgb24> pixels;
+  std::vector<size_t> delays;
+
+  size_t size() const { return delays.size(); }
+  const rgb24* operator[](size_t i) const { return &pixels[kFramePixels * i]; }
+  void Add(const rgb24* frame, size_t delay) {
+    pixels.insert(pixels.end(), frame, frame + kFramePixels);
+    delays.push_back(delay);
+  }
+};
+
+FrameStore store;
+FrameStore copy;
+
+bool LoadAsset(const std::vector<uint8_t>& lpa) {
+  PanelAsset::Header header;
+  memcpy(&header, lpa.data(), sizeof(header));
+  PanelAsset::Loader loader;
+  loader.Begin(&store, header.layout);
+  loader.Add(lpa.data(), lpa.size());
+  return loader.status() == PanelAsset::Loader::kDone && store.End();
+}
+
+// Also keeps every frame as it was drawn, in |frames|.
+bool LoadGif(const std::vector<uint8_t>& gif, Frames* frames) {
+  static PanelGif::Decoder<MemoryReader> decoder;
+  static PanelGif::PanelSink sink;
+  MemoryReader reader = { gif.data(), gif.size(), 0 };
+  if (!decoder.Begin(&reader)) return false;
+  store.Begin(true);
+  sink.Begin(store.Canvas(), store.Spare(), decoder.width());
+  size_t delay;
+  while (decoder.DecodeFrame(&sink, &delay) && store.Add(delay)) {
+    frames->Add(store.Canvas(), delay);
+  }
+  return !decoder.Failed() && store.End();
+}
+
+// Adds frames from |draw| until kSyntheticFrames are in or the store is
+// full. Keeps the ones that went in, in |frames|. Add() leaves the canvas
+// as it was.
+template <typename Draw>
+void Fill(Draw draw, Frames* frames) {
+  store.Begin();
+  for (size_t f = 0; f < kSyntheticFrames; f++) {
+    draw(f, store.Canvas());
+    size_t delay = 20 + f % 3;
+    if (!store.Add(delay)) break;
+    frames->Add(store.Canvas(), delay);
+  }
+  store.End();
+}
+
+// A dim gradient with an arrow on each panel, one row further along every
+// frame, like a step chart's receptors.
+void DrawArrows(size_t frame, rgb24* canvas) {
+  for (int y = 0; y < kMatrixHeight; y++) {
+    for (int x = 0; x < kMatrixWidth; x++) {
+      canvas[kMatrixWidth * y + x] = { (uint8_t)(x / 8), (uint8_t)(y / 4), 8 };
+    }
+  }
+  for (int panel = 0; panel < 4; panel++) {
+    int top = (frame * 2 + panel * 16) % kMatrixHeight;
+    for (int row = 0; row < 12; row++) {
+      int y = (top + row) % kMatrixHeight;
+      int half = row < 6 ? row : 3;
+      for (int x = 32 - half - 2; x <= 32 + half + 2; x++) {
+        canvas[kMatrixWidth * y + kPanelWidth * panel + x] = {
+          255, (uint8_t)(40 * panel), (uint8_t)(row * 20) };
+      }
+    }
+  }
+}
+
+void DrawNoise(size_t frame, rgb24* canvas) {
+  uint32_t seed = 777 + frame;
+  for (size_t i = 0; i < kFramePixels; i++) {
+    seed = seed * 1664525u + 1013904223u;
+    canvas[i] = { (uint8_t)(seed >> 8), (uint8_t)(seed >> 16),
+                  (uint8_t)(seed >> 24) };
+  }
+}
+
+// Plays |from| for kLoops loops, calling Prepare() |slices| times with no
+// time to spare before each frame, so it applies one kApplyBytes slice each.
+// Returns how many frames differ from |frames|, or |frames| doesn't say what
+// the store holds.
+size_t Mismatches(FrameStore* from, const Frames& frames, size_t slices = 0) {
+  if (from->frames() != frames.size()) return frames.size() + 1;
+  size_t bad = 0;
+  for (size_t i = 0; i < kLoops * frames.size(); i++) {
+    for (size_t s = 0; s < slices; s++) from->Prepare(0);
+    size_t delay = 0;
+    const rgb24* frame = from->Next(&delay);
+    size_t f = i % frames.size();
+    if (memcmp(frame, frames[f], kFrameBytes) != 0 ||
+        delay != frames.delays[f]) {
+      bad++;
+    }
+  }
+  from->Rewind();
+  return bad;
+}
+
+// Makes |copy| from |store| the way FrameCache stores and loads it.
+bool CopyStore() {
+  memcpy(copy.entries(), store.entries(),
+         store.frames() * sizeof(FrameStore::Entry));
+  uint32_t used[kNumFrameTiers] = {};
+  used[kStaticTier] = store.used(kStaticTier);
+  memcpy(copy.data(kStaticTier), store.data(kStaticTier), used[kStaticTier]);
+  return copy.Adopt(store.frames(), used);
+}
+
+int failures = 0;
+volatile uint8_t touched;
+
+void Check(const char* name, const Frames& frames) {
+  size_t bad = Mismatches(&store, frames);
+  if (bad > 0) {
+    printf("%s: %zu frames play back wrong\n", name, bad);
+    failures++;
+  }
+  bad = Mismatches(&store, frames, kSlices);
+  if (bad > 0) {
+    printf("%s: %zu frames play back wrong from Prepare() slices\n", name,
+           bad);
+    failures++;
+  }
+  if (store.bytes() > store.frames() * kFrameBytes) {
+    printf("%s: %zu bytes stored, more than the whole frames\n", name,
+           store.bytes());
+    failures++;
+  }
+  if (!CopyStore() || Mismatches(&copy, frames) > 0) {
+    printf("%s: the copied store plays back wrong\n", name);
+    failures++;
+  }
+
+  // What playing whole frames costs, a copy into the frame on screen. A
+  // pixel of each frame is read so that neither loop can be dropped.
+  static std::vector<rgb24> whole(kFramePixels);
+  size_t delay, n = 0;
+  double next = MicrosPerCall(kRepeats, [&]() {
+    touched = store.Next(&delay)[n++ % kFramePixels].red;
+  });
+  double memcpy_us = MicrosPerCall(kRepeats, [&]() {
+    memcpy(whole.data(), n++ % 2 ? store.Keyframe() : copy.Keyframe(),
+           kFrameBytes);
+    touched = whole[n % kFramePixels].red;
+  });
+  store.Rewind();
+  printf("%-8s %7zu %10zu %10zu %7.1f%% %10.2f %10.2f\n", name,
+         store.frames(), store.bytes(), store.frames() * kFrameBytes,
+         100.0 * store.bytes() / (store.frames() * kFrameBytes), next,
+         memcpy_us);
+}
+
+}  // namespace
+
+int main() {
+  std::vector<uint8_t> gif = ReadFile("../ldur.gif");
+  std::vector<uint8_t> lpa = ReadFile("../ldur.lpa");
+  if (gif.empty() || lpa.size() < sizeof(PanelAsset::Header)) {
+    printf("Can't read ../ldur.gif or ../ldur.lpa\n");
+    return 1;
+  }
+
+  printf("%-8s %7s %10s %10s %8s %10s %10s\n", "frames", "count", "bytes",
+         "whole", "ratio", "us/Next", "us/memcpy");
+
+  Frames ldur;
+  if (!LoadGif(gif, &ldur)) {
+    printf("Can't decode ../ldur.gif\n");
+    return 1;
+  }
+  Check("gif", ldur);
+  // The asset was built from the same GIF, so it has to play back the same.
+  if (!LoadAsset(lpa)) {
+    printf("Can't load ../ldur.lpa\n");
+    return 1;
+  }
+  Check("lpa", ldur);
+
+  Frames arrows;
+  Fill(DrawArrows, &arrows);
+  Check("arrows", arrows);
+  if (arrows.size() < kMinSyntheticFrames) {
+    printf("Only %zu arrow frames fit, want %zu\n", arrows.size(),
+           kMinSyntheticFrames);
+    failures++;
+  }
+
+  // Fills up, and the loop back to the start doesn't fit either.
+  Frames noise;
+  Fill(DrawNoise, &noise);
+  Check("noise", noise);
+
+  // A delta that runs past the stored bytes must not be adopted.
+  CopyStore();
+  copy.entries()[1].length = store.bytes();
+  uint32_t used[kNumFrameTiers] = { (uint32_t)store.bytes() };
+  if (copy.Adopt(store.frames(), used)) {
+    printf("Adopted a store with a delta out of bounds\n");
+    failures++;
+  }
+
+  printf("%zu whole frames fit in %zu bytes\n", kFrameStoreBytes / kFrameBytes,
+         kFrameStoreBytes);
+  return failures > 0 ? 1 : 0;
+}
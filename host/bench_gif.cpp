@@ -0,0 +1,342 @@
+// Speed and exactness benchmark for GIF decoding into panel-mapped frames.
+//
+// Decodes ../ldur.gif with PanelGif.h two ways:
+//   - rows of palette indices into PanelSink, which maps a span at a time,
+//   - the same decoder handing out one pixel at a time through a function
+//     pointer to drawPixelCallback(), the way GifDecoder did,
+// and reports frames/s and MB/s of GIF data for both, and for decoding alone
+// with the output dropped, which is what both paths share. Checks that the
+// frames are exactly those ../ldur.lpa plays back, which tools/mkasset.py
+// built from the same GIF, and that both paths agree for the tile 2 and tile
+// 4 layouts, with and without transparency. Also decodes the GIF as if it
+// arrived a byte at a time and in uneven pieces, the decoder going back to
+// its last Mark() whenever it has to wait, and checks that the frames are
+// the same. Fails if anything differs, or if the row path isn't faster.
+//
+// Build and run with `make bench` from this directory.
+
+#include <stdio.h>
+#include <vector>
+
+#include "bench_util.h"
+
+// The pixel path draws into a single canvas.
+size_t current_frame = 0;
+int8_t tile = 1;
+rgb24 framesBuffer[kMatrixWidth * kMatrixHeight];
+
+// As it was in LedPanel.h.
+void drawPixelCallback(int16_t x, int16_t y, uint8_t red, uint8_t green, uint8_t blue) {
+  if (tile <= 2) {
+    int16_t index = x / kPanelWidth;
+    int16_t xpos = kPanelPositions[index] + (kPanelFlipped[index]? kPanelWidth - 1 - x % kPanelWidth : x % kPanelWidth);
+    int16_t ypos = (kPanelFlipped[index]? kMatrixHeight - 1 - y : y);
+    framesBuffer[kMatrixWidth * kMatrixHeight * current_frame + kMatrixWidth * ypos + xpos] = (rgb24){red, green, blue};
+    if (tile == 2) {
+      int16_t xpos1 = kPanelPositions[index + 2] + (kPanelFlipped[index + 2]? x % kPanelWidth : kPanelWidth - 1 - x % kPanelWidth);
+      int16_t ypos1 = (kPanelFlipped[index + 2]? y : kMatrixHeight - 1 - y);
+      framesBuffer[kMatrixWidth * kMatrixHeight * current_frame + kMatrixWidth * ypos1 + xpos1] = (rgb24){red, green, blue};
+    }
+  }
+  else if (tile == 4) {
+    for (int i = 0; i < 4; i++) {
+      int16_t xpos = x * kPanelRotation[4*i] + y * kPanelRotation[4*i + 1];
+      xpos = kPanelPositions[i] + (xpos + kPanelWidth) % kPanelWidth;
+      int16_t ypos = x * kPanelRotation[4*i + 2] + y * kPanelRotation[4*i + 3];
+      ypos = (ypos + kMatrixHeight) % kMatrixHeight;
+      framesBuffer[kMatrixWidth * kMatrixHeight * current_frame + kMatrixWidth * ypos + xpos] = (rgb24){red, green, blue};
+    }
+  }
+}
+
+// Not const, so that every pixel is an indirect call as in GifDecoder.
+void (*drawPixel)(int16_t, int16_t, uint8_t, uint8_t, uint8_t) =
+    drawPixelCallback;
+
+#include "FrameStore.h"
+#include "PanelGif.h"
+#include "PanelAsset.h"
+
+namespace {
+
+const size_t kRepeats = 200;
+
+// Hands every pixel to drawPixel(), into framesBuffer.
+class PixelSink {
+ public:
+  void Begin() { memset(framesBuffer, 0, sizeof(framesBuffer)); }
+  void Save() { memcpy(saved_, framesBuffer, sizeof(framesBuffer)); }
+  void Restore() { memcpy(framesBuffer, saved_, sizeof(framesBuffer)); }
+
+  void Row(int x, int y, const uint8_t* indices, int count,
+           const rgb24* palette, int transparent) {
+    int width = kMatrixWidth / tile;
+    for (int i = 0; i < count && x + i < width; i++) {
+      if (y >= kMatrixHeight || indices[i] == transparent) continue;
+      const rgb24& color = palette[indices[i]];
+      drawPixel(x + i, y, color.red, color.green, color.blue);
+    }
+  }
+
+  void Clear(int x, int y, int w, int h) {
+    int width = kMatrixWidth / tile;
+    for (int row = y; row < y + h && row < kMatrixHeight; row++) {
+      for (int col = x; col < x + w && col < width; col++) {
+        drawPixel(col, row, 0, 0, 0);
+      }
+    }
+  }
+
+ private:
+  rgb24 saved_[kFramePixels];
+};
+
+// Drops everything, to time the decoding on its own.
+class NullSink {
+ public:
+  void Save() {}
+  void Restore() {}
+  void Row(int x, int y, const uint8_t* indices, int count,
+           const rgb24* palette, int transparent) {}
+  void Clear(int x, int y, int w, int h) {}
+};
+
+// Decodes up to maxFrames frames, returns how many. If |canvas| is given,
+// each frame is copied from it into |frames|.
+template <typename Sink>
+size_t Decode(const std::vector<uint8_t>& gif, Sink* sink,
+              PanelGif::Decoder<MemoryReader>* decoder, size_t* times,
+              const rgb24* canvas = nullptr, rgb24* frames = nullptr) {
+  MemoryReader reader = { gif.data(), gif.size(), 0 };
+  if (!decoder->Begin(&reader)) return 0;
+  tile = kMatrixWidth / decoder->width();
+  size_t count = 0;
+  while (count < maxFrames && decoder->DecodeFrame(sink, &times[count])) {
+    if (canvas != nullptr) {
+      memcpy(&frames[kFramePixels * count], canvas, kFrameBytes);
+    }
+    count++;
+  }
+  return decoder->Failed() ? 0 : count;
+}
+
+// Hands a file to the decoder as if it arrived a few bytes at a time, the
+// way GifReader does out of the serial ring, and keeps track of the most it
+// read past a Mark().
+struct TrickleReader {
+  const uint8_t* data;
+  size_t size;
+  // Bytes that have arrived.
+  size_t arrived;
+  size_t marked;
+  size_t position;
+  size_t most_unmarked;
+  bool waiting;
+
+  int ReadBlock(void* buffer, int count) {
+    size_t n = min((size_t)count, arrived - position);
+    memcpy(buffer, data + position, n);
+    position += n;
+    waiting = n < (size_t)count && position < size;
+    most_unmarked = max(most_unmarked, position - marked);
+    return n;
+  }
+
+  void Mark() { marked = position; }
+  void Rewind() { position = marked; }
+  bool Waiting() const { return waiting; }
+};
+
+// Decodes |gif| into |sink| with more of it arriving, |step(i)| bytes, only
+// whenever the decoder waits, and returns whether the frames are exactly
+// |expected|. Fails if the decoder read further past a Mark() than
+// PanelGif::kMaxUnmarked, or never waited.
+bool DecodesAsItArrives(const std::vector<uint8_t>& gif,
+                        const std::vector<rgb24>& expected, size_t frames,
+                        const std::function<size_t(size_t)>& step) {
+  static PanelGif::Decoder<TrickleReader> decoder;
+  std::vector<rgb24> canvas(kFramePixels), saved(kFramePixels);
+  PanelGif::PanelSink sink;
+  sink.Begin(canvas.data(), saved.data(), kMatrixWidth);
+  TrickleReader reader = { gif.data(), gif.size(), 0, 0, 0, 0, false };
+  size_t waits = 0;
+  auto arrive = [&]() {
+    reader.arrived = min(gif.size(), reader.arrived + step(waits++));
+  };
+  while (!decoder.Begin(&reader)) {
+    if (!decoder.Waiting()) return false;
+    arrive();
+  }
+  size_t count = 0;
+  size_t delay;
+  bool right = true;
+  while (count < frames) {
+    if (!decoder.DecodeFrame(&sink, &delay)) {
+      if (!decoder.Waiting()) break;
+      arrive();
+      continue;
+    }
+    right = right && memcmp(canvas.data(), &expected[kFramePixels * count],
+                            kFrameBytes) == 0;
+    count++;
+  }
+  if (reader.most_unmarked > PanelGif::kMaxUnmarked) {
+    printf("Read %zu bytes past a Mark(), more than kMaxUnmarked\n",
+           reader.most_unmarked);
+    return false;
+  }
+  return right && count == frames && !decoder.Failed() && waits > count;
+}
+
+// Feeds the same random rows and clears through both sinks for a canvas
+// |width| wide, and returns whether the frames agree.
+bool SinksAgree(uint16_t width, int transparent) {
+  rgb24 palette[256];
+  uint32_t seed = 12345 + width;
+  auto next = [&seed]() {
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+  };
+  for (rgb24& color : palette) {
+    uint32_t value = next();
+    color = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16) };
+  }
+  std::vector<uint8_t> indices(width);
+  std::vector<rgb24> rows(kFramePixels);
+  std::vector<rgb24> saved(kFramePixels);
+  PanelGif::PanelSink sink;
+  static PixelSink pixels;
+  tile = kMatrixWidth / width;
+  sink.Begin(rows.data(), saved.data(), width);
+  pixels.Begin();
+  for (int pass = 0; pass < 3; pass++) {
+    if (pass == 1) {
+      sink.Save();
+      pixels.Save();
+    }
+    if (pass == 2) {
+      sink.Restore();
+      pixels.Restore();
+    }
+    for (int y = 0; y < kMatrixHeight; y++) {
+      for (uint8_t& index : indices) index = next() & 0xff;
+      // Spans that start and end anywhere, some past the canvas.
+      int x = next() % width;
+      int count = next() % (width + 8);
+      sink.Row(x, y, indices.data(), count, palette, transparent);
+      pixels.Row(x, y, indices.data(), count, palette, transparent);
+    }
+    sink.Clear(width / 3, 5, width / 2, 70);
+    pixels.Clear(width / 3, 5, width / 2, 70);
+  }
+  return memcmp(rows.data(), framesBuffer, kFramePixels * sizeof(rgb24)) == 0;
+}
+
+}  // namespace
+
+int main() {
+  int failures = 0;
+  std::vector<uint8_t> gif = ReadFile("../ldur.gif");
+  std::vector<uint8_t> lpa = ReadFile("../ldur.lpa");
+  if (gif.empty() || lpa.size() < sizeof(PanelAsset::Header)) {
+    printf("Can't read ../ldur.gif or ../ldur.lpa\n");
+    return 1;
+  }
+
+  // The frames tools/mkasset.py made, as the asset plays back.
+  static FrameStore store;
+  PanelAsset::Header header;
+  memcpy(&header, lpa.data(), sizeof(header));
+  PanelAsset::Loader loader;
+  loader.Begin(&store, header.layout);
+  loader.Add(lpa.data(), lpa.size());
+  if (loader.status() != PanelAsset::Loader::kDone || !store.End()) {
+    printf("Can't load ../ldur.lpa\n");
+    return 1;
+  }
+  std::vector<rgb24> expected(kFramePixels * store.frames());
+  std::vector<size_t> expected_times(store.frames());
+  for (size_t f = 0; f < store.frames(); f++) {
+    memcpy(&expected[kFramePixels * f], store.Next(&expected_times[f]),
+           kFrameBytes);
+  }
+
+  static PanelGif::Decoder<MemoryReader> decoder;
+  std::vector<rgb24> canvas(kFramePixels), saved(kFramePixels);
+  std::vector<rgb24> frames(kFramePixels * maxFrames);
+  std::vector<rgb24> pixel_frames(kFramePixels * maxFrames);
+  size_t times[maxFrames];
+  PanelGif::PanelSink sink;
+  sink.Begin(canvas.data(), saved.data(), kMatrixWidth);
+  static PixelSink pixels;
+  pixels.Begin();
+
+  size_t count = Decode(gif, &sink, &decoder, times, canvas.data(),
+                        frames.data());
+  size_t pixel_count = Decode(gif, &pixels, &decoder, times, framesBuffer,
+                              pixel_frames.data());
+  if (count != store.frames() || pixel_count != count) {
+    printf("Decoded %zu and %zu frames, the asset has %zu\n", count,
+           pixel_count, store.frames());
+    failures++;
+  }
+  for (size_t f = 0; f < min(count, store.frames()); f++) {
+    const rgb24* want = &expected[kFramePixels * f];
+    if (memcmp(&frames[kFramePixels * f], want, kFrameBytes) != 0) {
+      printf("Row path frame %zu differs from ../ldur.lpa\n", f);
+      failures++;
+    }
+    if (memcmp(&pixel_frames[kFramePixels * f], want, kFrameBytes) != 0) {
+      printf("Pixel path frame %zu differs from ../ldur.lpa\n", f);
+      failures++;
+    }
+    if (times[f] != expected_times[f]) {
+      printf("Frame %zu delay %zums, the asset has %zums\n", f, times[f],
+             expected_times[f]);
+      failures++;
+    }
+  }
+
+  // A byte at a time, and in uneven pieces.
+  uint32_t seed = 1;
+  auto uneven = [&seed](size_t) {
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) % 700 + 1;
+  };
+  if (!DecodesAsItArrives(gif, expected, store.frames(),
+                          [](size_t) { return 1; }) ||
+      !DecodesAsItArrives(gif, expected, store.frames(), uneven)) {
+    printf("Frames decoded as the file arrives differ from ../ldur.lpa\n");
+    failures++;
+  }
+
+  for (uint16_t width : { kMatrixWidth / 2, kMatrixWidth / 4 }) {
+    for (int transparent : { -1, 7 }) {
+      if (!SinksAgree(width, transparent)) {
+        printf("Row and pixel paths differ for width %u, transparent %d\n",
+               width, transparent);
+        failures++;
+      }
+    }
+  }
+
+  double rows = MicrosPerCall(kRepeats, [&]() { Decode(gif, &sink, &decoder, times); });
+  double pixel = MicrosPerCall(kRepeats, [&]() { Decode(gif, &pixels, &decoder, times); });
+  NullSink none;
+  double decode = MicrosPerCall(kRepeats, [&]() { Decode(gif, &none, &decoder, times); });
+  printf("%-12s %10s %10s %10s\n", "output", "us/file", "frames/s", "MB/s");
+  for (auto result : { std::make_pair("rows", rows),
+                       std::make_pair("pixels", pixel),
+                       std::make_pair("none", decode) }) {
+    printf("%-12s %10.1f %10.0f %10.2f\n", result.first, result.second,
+           count * 1e6 / result.second, gif.size() / result.second);
+  }
+  printf("%zu frames, %zu bytes, rows %.2fx faster, %.2fx for the output "
+         "alone\n", count, gif.size(), pixel / rows,
+         (pixel - decode) / max(rows - decode, 1.0));
+  if (rows >= pixel) {
+    printf("Row output is no faster than pixel output\n");
+    failures++;
+  }
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,484 @@
+// Round-trip latency and throughput of pad_link.h against emulated pads.
+//
+// Every pad is a pseudo-terminal whose master end is served by a thread that
+// answers the way SerialProcessor.h does, so the numbers are those of the
+// client library and the kernel's tty layer, not of USB or the firmware.
+// Reports:
+//   - the round trip of one "v" at a time: mean, median, 99th percentile and
+//     worst,
+//   - "v" replies per second with kWindow requests in flight, for one pad and
+//     for kMaxPads pads served from the one epoll loop,
+//   - upload throughput in MB/s for a kUploadSize GIF,
+//   - value callbacks per second from StreamValues() on kMaxPads pads.
+// Also checks, with a short reply timeout, that a threshold out of range
+// fails at once without shifting later replies, that a request the pad
+// drops fails and the next one gets its own reply, that a stream carries on
+// past a dropped "v", and that an upload the pad prints news about but takes
+// is reported as accepted. Fails if a typed call gets a wrong answer, an
+// upload arrives damaged or a rejected one is reported as accepted, or a
+// reply goes missing. Times are not checked, the host varies too much.
+//
+// Build and run with `make bench` from this directory.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "bench_sensors.h"
+#include "pad_link.h"
+
+namespace {
+
+// Must match led-panel-fsr.ino with one pad.
+const size_t kNumSensors = 8;
+// The emulator rejects uploads over this, as LedPanel does when a GIF
+// doesn't fit.
+const size_t kMaxUpload = 4 << 20;
+
+const size_t kRoundTrips = 2000;
+const size_t kPipelined = 20000;
+const size_t kWindow = 16;
+const size_t kMaxPads = 4;
+const size_t kUploadSize = 1 << 20;
+const size_t kUploads = 3;
+const int kStreamIntervalMs = 1;
+const int kStreamMs = 500;
+const int kTimeoutMs = 10000;
+const int kShortTimeoutMs = 200;
+
+// Answers the firmware's serial protocol on the master end of a
+// pseudo-terminal.
+class Emulator {
+ public:
+  Emulator() {
+    master_ = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master_ < 0 || grantpt(master_) != 0 || unlockpt(master_) != 0) {
+      return;
+    }
+    path_ = ptsname(master_);
+    thresholds_.assign(kNumSensors, kDefaultThreshold);
+  }
+
+  ~Emulator() {
+    Stop();
+    if (master_ >= 0) close(master_);
+  }
+
+  bool ok() const { return !path_.empty(); }
+  const std::string& path() const { return path_; }
+  uint32_t upload_sum() const { return upload_sum_; }
+  size_t upload_bytes() const { return upload_bytes_; }
+
+  // Ignores the next request starting with |command|, as if the line was
+  // lost.
+  void DropNext(char command) { drop_ = command; }
+  // Printed once an upload is taken in, as LedPanel does when it had to
+  // shorten an animation or couldn't cache it.
+  void SetUploadNote(const std::string& note) {
+    std::lock_guard<std::mutex> lock(note_mutex_);
+    note_ = note;
+  }
+
+  void Start() {
+    thread_ = std::thread([this] { Serve(); });
+  }
+
+  void Stop() {
+    stop_ = true;
+    if (thread_.joinable()) thread_.join();
+  }
+
+ private:
+  void Serve() {
+    std::string in;
+    char buffer[4096];
+    while (!stop_) {
+      pollfd pfd = { master_, POLLIN, 0 };
+      if (poll(&pfd, 1, 20) <= 0) continue;
+      ssize_t count = read(master_, buffer, sizeof(buffer));
+      if (count <= 0) continue;
+      in.append(buffer, count);
+      size_t start = 0;
+      while (start < in.size()) {
+        if (upload_left_ > 0) {
+          size_t take = std::min(upload_left_, in.size() - start);
+          uint32_t sum = upload_sum_;
+          for (size_t i = 0; i < take; i++) {
+            sum = sum * 31 + (uint8_t)in[start + i];
+          }
+          upload_sum_ = sum;
+          upload_bytes_ += take;
+          upload_left_ -= take;
+          start += take;
+          if (upload_left_ == 0) {
+            std::lock_guard<std::mutex> lock(note_mutex_);
+            if (!note_.empty()) Write(note_ + "\n");
+          }
+          continue;
+        }
+        size_t end = in.find('\n', start);
+        if (end == std::string::npos) break;
+        Handle(in.substr(start, end - start));
+        start = end + 1;
+      }
+      in.erase(0, start);
+    }
+  }
+
+  void Handle(const std::string& line) {
+    if (line.empty()) return;
+    if (line[0] == drop_) {
+      drop_ = 0;
+      return;
+    }
+    switch (line[0]) {
+      case 'v': {
+        std::string reply = "v";
+        for (size_t i = 0; i < kNumSensors; i++) {
+          reply += " " + std::to_string((requests_ + i * 97) % kMaxSensorValue);
+        }
+        requests_++;
+        Write(reply + "\n");
+        break;
+      }
+      case 't':
+        PrintThresholds();
+        break;
+      case 'i':
+        Write("i " + std::to_string(kPipelineBits) + " " +
+              std::to_string(kMaxSensorValue) + "\n");
+        break;
+      case 'g':
+      case 'a': {
+        size_t size = strtoul(line.c_str() + 2, nullptr, 10);
+        // The firmware reads the payload either way and drops it if it
+        // can't use it.
+        upload_left_ = size;
+        upload_sum_ = 0;
+        upload_bytes_ = 0;
+        if (size > kMaxUpload) Write("GIF incorrect size, skipping\n");
+        break;
+      }
+      case '0' ... '9': {
+        if (line.size() < 3 || line.size() > 7) return;
+        char* next = nullptr;
+        size_t sensor = strtoul(line.c_str(), &next, 10);
+        int value = strtol(next, nullptr, 10);
+        if (sensor >= kNumSensors || value < 0 || value > kMaxSensorValue) {
+          return;
+        }
+        thresholds_[sensor] = value;
+        PrintThresholds();
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  void PrintThresholds() {
+    std::string reply = "t";
+    for (int threshold : thresholds_) {
+      reply += " " + std::to_string(threshold);
+    }
+    Write(reply + "\n");
+  }
+
+  void Write(const std::string& reply) {
+    size_t done = 0;
+    while (done < reply.size()) {
+      ssize_t written = write(master_, reply.data() + done, reply.size() - done);
+      if (written <= 0) return;
+      done += written;
+    }
+  }
+
+  int master_ = -1;
+  std::string path_;
+  std::thread thread_;
+  std::atomic<bool> stop_{false};
+  std::vector<int> thresholds_;
+  size_t requests_ = 0;
+  size_t upload_left_ = 0;
+  std::atomic<uint32_t> upload_sum_{0};
+  std::atomic<size_t> upload_bytes_{0};
+  std::atomic<char> drop_{0};
+  std::mutex note_mutex_;
+  std::string note_;
+};
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+int failures = 0;
+
+void Fail(const char* what) {
+  printf("FAIL: %s\n", what);
+  failures++;
+}
+
+void CheckTypedCalls(padlink::PadLink* link, int pad) {
+  int bits = 0, max = 0;
+  link->GetInfo(pad, [&](int b, int m) { bits = b; max = m; });
+  std::vector<int> thresholds;
+  link->SetThreshold(pad, 2, 1234,
+                     [&](const std::vector<int>& t) { thresholds = t; });
+  std::vector<int> read_back;
+  link->ResetOffsets(pad);
+  link->GetThresholds(pad, [&](const std::vector<int>& t) { read_back = t; });
+  if (!link->RunUntil([&] { return !read_back.empty(); }, kTimeoutMs)) {
+    Fail("typed calls timed out");
+    return;
+  }
+  if (bits != kPipelineBits || max != kMaxSensorValue) Fail("i reply");
+  if (thresholds.size() != kNumSensors || thresholds[2] != 1234) {
+    Fail("threshold not set");
+  }
+  if (read_back != thresholds) Fail("thresholds not read back");
+}
+
+// Runs with a short reply timeout on a pad that wasn't asked for "i" yet.
+void CheckFailures(padlink::PadLink* link, int pad, Emulator* emulator) {
+  link->SetReplyTimeout(kShortTimeoutMs);
+  auto collect = [](std::vector<int>* into, bool* done) {
+    return [into, done](const std::vector<int>& values) {
+      *into = values;
+      *done = true;
+    };
+  };
+
+  // Out of range: the firmware would say nothing, and the next threshold
+  // reply must still go to the request it answers.
+  std::vector<int> high, good, bad_sensor, read_back;
+  bool high_done = false, good_done = false, sensor_done = false;
+  bool read_done = false;
+  link->SetThreshold(pad, 3, kMaxSensorValue + 1, collect(&high, &high_done));
+  link->SetThreshold(pad, 3, 500, collect(&good, &good_done));
+  link->GetThresholds(pad, collect(&read_back, &read_done));
+  if (!link->RunUntil([&] { return read_done; }, kTimeoutMs) || !high_done ||
+      !good_done) {
+    Fail("threshold out of range left a request waiting");
+  } else if (!high.empty() || good.size() != kNumSensors || good[3] != 500 ||
+             read_back != good) {
+    Fail("threshold out of range shifted the replies");
+  }
+  link->SetThreshold(pad, kNumSensors, 500, collect(&bad_sensor, &sensor_done));
+  if (!sensor_done || !bad_sensor.empty()) Fail("sensor out of range taken");
+
+  // A request the pad drops fails, both on its own and once a later one is
+  // answered, and the next gets its own reply.
+  std::vector<int> lost, next;
+  bool lost_done = false, next_done = false;
+  emulator->DropNext('t');
+  link->GetThresholds(pad, collect(&lost, &lost_done));
+  if (!link->RunUntil([&] { return lost_done; }, kTimeoutMs) ||
+      !lost.empty()) {
+    Fail("dropped request never timed out");
+  }
+  lost_done = false;
+  emulator->DropNext('t');
+  link->GetThresholds(pad, collect(&lost, &lost_done));
+  link->GetValues(pad, collect(&next, &next_done));
+  if (!link->RunUntil([&] { return next_done; }, kTimeoutMs) || !lost_done) {
+    Fail("dropped request never failed");
+  } else if (!lost.empty() || next.size() != kNumSensors) {
+    Fail("dropped request shifted the replies");
+  }
+
+  // A stream carries on past a lost "v".
+  size_t values = 0;
+  emulator->DropNext('v');
+  link->StreamValues(pad, kStreamIntervalMs,
+                     [&values](const std::vector<int>&) { values++; });
+  if (!link->RunUntil([&] { return values >= 10; }, kTimeoutMs)) {
+    Fail("stream stuck after a lost reply");
+  }
+  link->StopStream(pad);
+  link->RunUntil([&] { return link->Outstanding(pad) == 0; }, kTimeoutMs);
+
+  // News printed while taking an upload in isn't a rejection.
+  const char* const notes[] = {
+    "GIF longer than the frame store, keeping 6 frames",
+    "Animation too large to cache",
+  };
+  std::vector<uint8_t> gif(4096, 1);
+  for (const char* note : notes) {
+    emulator->SetUploadNote(note);
+    bool done = false, ok = false;
+    link->UploadGif(pad, gif, [&](bool o, const std::string&) {
+      ok = o;
+      done = true;
+    });
+    if (!link->RunUntil([&] { return done; }, kTimeoutMs) || !ok) {
+      Fail("accepted upload reported as rejected");
+    }
+  }
+  emulator->SetUploadNote("");
+  link->SetReplyTimeout(kTimeoutMs);
+}
+
+void BenchRoundTrip(padlink::PadLink* link, int pad) {
+  std::vector<double> us;
+  for (size_t i = 0; i < kRoundTrips; i++) {
+    bool done = false;
+    size_t sensors = 0;
+    auto start = std::chrono::steady_clock::now();
+    link->GetValues(pad, [&](const std::vector<int>& v) {
+      sensors = v.size();
+      done = true;
+    });
+    if (!link->RunUntil([&] { return done; }, kTimeoutMs)) {
+      Fail("round trip timed out");
+      return;
+    }
+    us.push_back(Seconds(start) * 1e6);
+    if (sensors != kNumSensors) {
+      Fail("wrong number of values");
+      return;
+    }
+  }
+  double total = 0;
+  for (double u : us) total += u;
+  std::sort(us.begin(), us.end());
+  printf("%-20s %10.1f %10.1f %10.1f %10.1f\n", "round_trip_us",
+         total / us.size(), us[us.size() / 2], us[us.size() * 99 / 100],
+         us.back());
+}
+
+void BenchPipelined(padlink::PadLink* link, const std::vector<int>& pads) {
+  size_t sent = 0, received = 0;
+  size_t total = kPipelined * pads.size();
+  std::function<void(int)> send = [&](int pad) {
+    sent++;
+    link->GetValues(pad, [&, pad](const std::vector<int>& v) {
+      received++;
+      if (sent < total) send(pad);
+    });
+  };
+  auto start = std::chrono::steady_clock::now();
+  for (int pad : pads) {
+    for (size_t i = 0; i < kWindow; i++) send(pad);
+  }
+  if (!link->RunUntil([&] { return received == sent; }, kTimeoutMs)) {
+    Fail("pipelined replies missing");
+    return;
+  }
+  double seconds = Seconds(start);
+  printf("%-20s %10zu %10.0f\n", "pipelined_pads", pads.size(),
+         received / seconds);
+}
+
+void BenchUpload(padlink::PadLink* link, int pad, Emulator* emulator) {
+  std::vector<uint8_t> gif(kUploadSize);
+  uint32_t sum = 0;
+  for (size_t i = 0; i < gif.size(); i++) {
+    gif[i] = (uint8_t)(i * 7 + (i >> 9));
+    sum = sum * 31 + gif[i];
+  }
+  double best = 0;
+  for (size_t run = 0; run < kUploads; run++) {
+    bool done = false, ok = false;
+    auto start = std::chrono::steady_clock::now();
+    link->UploadGif(pad, gif, [&](bool o, const std::string&) {
+      ok = o;
+      done = true;
+    });
+    if (!link->RunUntil([&] { return done; }, kTimeoutMs)) {
+      Fail("upload timed out");
+      return;
+    }
+    double seconds = Seconds(start);
+    if (!ok || emulator->upload_bytes() != gif.size() ||
+        emulator->upload_sum() != sum) {
+      Fail("upload damaged");
+      return;
+    }
+    best = std::max(best, gif.size() / seconds / 1e6);
+  }
+  printf("%-20s %10zu %10.1f\n", "upload_MB_per_s", kUploadSize, best);
+
+  // One the pad turns down must come back as such.
+  std::vector<uint8_t> too_big(kMaxUpload + 1);
+  bool done = false, ok = true;
+  std::string message;
+  link->UploadGif(pad, too_big, [&](bool o, const std::string& m) {
+    ok = o;
+    message = m;
+    done = true;
+  });
+  if (!link->RunUntil([&] { return done; }, kTimeoutMs) || ok ||
+      message.empty()) {
+    Fail("rejected upload not reported");
+  }
+}
+
+void BenchStream(padlink::PadLink* link, const std::vector<int>& pads) {
+  std::vector<size_t> counts(pads.size());
+  for (size_t i = 0; i < pads.size(); i++) {
+    link->StreamValues(pads[i], kStreamIntervalMs,
+                       [&counts, i](const std::vector<int>&) { counts[i]++; });
+  }
+  auto start = std::chrono::steady_clock::now();
+  link->RunUntil([] { return false; }, kStreamMs);
+  double seconds = Seconds(start);
+  for (size_t i = 0; i < pads.size(); i++) {
+    link->StopStream(pads[i]);
+    printf("%-20s %10zu %10.0f\n", "stream_per_s", i, counts[i] / seconds);
+    if (counts[i] == 0) Fail("stream never called back");
+  }
+  // Let the last answers in so the next run starts clean.
+  link->RunUntil([&] {
+    for (int pad : pads) {
+      if (link->Outstanding(pad) > 0) return false;
+    }
+    return true;
+  }, kTimeoutMs);
+}
+
+}  // namespace
+
+int main() {
+  std::vector<std::unique_ptr<Emulator>> emulators;
+  padlink::PadLink link;
+  std::vector<int> pads;
+  for (size_t i = 0; i < kMaxPads; i++) {
+    emulators.emplace_back(new Emulator);
+    if (!emulators.back()->ok()) {
+      printf("No pseudo-terminals available\n");
+      return 1;
+    }
+    emulators.back()->Start();
+    int pad = link.Open(emulators.back()->path());
+    if (pad < 0) {
+      printf("Could not open %s\n", emulators.back()->path().c_str());
+      return 1;
+    }
+    pads.push_back(pad);
+  }
+
+  CheckTypedCalls(&link, pads[0]);
+  CheckFailures(&link, pads[1], emulators[1].get());
+  printf("%-20s %10s %10s %10s %10s\n", "", "mean", "p50", "p99", "max");
+  BenchRoundTrip(&link, pads[0]);
+  printf("%-20s %10s %10s\n", "", "pads", "replies_s");
+  BenchPipelined(&link, { pads[0] });
+  BenchPipelined(&link, pads);
+  printf("%-20s %10s %10s\n", "", "bytes", "best");
+  BenchUpload(&link, pads[0], emulators[0].get());
+  printf("%-20s %10s %10s\n", "", "pad", "values_s");
+  BenchStream(&link, pads);
+  return failures > 0 ? 1 : 0;
+}
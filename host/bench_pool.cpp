@@ -0,0 +1,213 @@
+// Capacity, speed and exactness benchmark for the frame store's memory tiers.
+//
+// Gives FrameStore.h an OCRAM heap tier of kHeapTierBytes and a PSRAM tier of
+// kExtTierBytes, as Init() does on a Teensy 4.1 with PSRAM fitted, and adds a
+// synthetic animation kLongFrames long: arrows sliding down each panel over a
+// steady background, with a bar that changes colour every frame. Checks that
+// every frame was kept, spread over all three tiers, and that several loops
+// of playback give exactly the frames that went in, both with Prefetch()
+// called between frames as loop() does and without it. Reports for each tier
+// its size, the bytes and frames in it, and the time to copy a whole frame
+// out of it a panel row at a time, as the CPU path of the compositor does,
+// with the frame evicted from the cache first. Also reports the time per
+// Next() with and without Prefetch(). Fails if a frame was dropped or
+// differs, or if Next() had to read a delta from the PSRAM tier although
+// Prefetch() had time to stage it.
+//
+// All tiers are host RAM here, so the copy times only differ by where the
+// memory happens to be. The numbers that matter come from "e" on the device.
+//
+// Build and run with `make bench` from this directory.
+
+#include <chrono>
+#include <functional>
+#include <stdio.h>
+#include <vector>
+
+#include "bench_util.h"
+
+#include "FrameStore.h"
+
+namespace {
+
+// About what a Teensy 4.1 heap has left, and its larger PSRAM option.
+const size_t kHeapTierBytes = 128 * 1024;
+const size_t kExtTierBytes = 16 * 1024 * 1024;
+const size_t kLongFrames = 600;
+const size_t kLoops = 2;
+// Prefetch() calls between frames, about what loop() manages in the 20ms or
+// more a frame is shown.
+const size_t kPrefetchCalls = 8;
+const size_t kCopyRepeats = 20;
+// Read between copies to push a frame out of the host's caches.
+const size_t kEvictBytes = 64 * 1024 * 1024;
+
+const char* const kTierNames[] = { "static", "heap", "ext" };
+
+FrameStore store;
+
+// A dim gradient with an arrow on each panel, one row further along every
+// frame, and an 8 row bar that changes colour every frame.
+void Draw(size_t frame, rgb24* canvas) {
+  for (int y = 0; y < kMatrixHeight; y++) {
+    for (int x = 0; x < kMatrixWidth; x++) {
+      canvas[kMatrixWidth * y + x] = { (uint8_t)(x / 8), (uint8_t)(y / 4), 8 };
+    }
+  }
+  for (int panel = 0; panel < 4; panel++) {
+    int top = (frame * 2 + panel * 16) % kMatrixHeight;
+    for (int row = 0; row < 12; row++) {
+      int y = (top + row) % kMatrixHeight;
+      int half = row < 6 ? row : 3;
+      for (int x = 32 - half - 2; x <= 32 + half + 2; x++) {
+        canvas[kMatrixWidth * y + kPanelWidth * panel + x] = {
+          255, (uint8_t)(40 * panel), (uint8_t)(row * 20) };
+      }
+    }
+  }
+  for (size_t i = 0; i < 8 * kMatrixWidth; i++) {
+    canvas[i] = { (uint8_t)frame, (uint8_t)(frame >> 8), (uint8_t)(i / 8) };
+  }
+}
+
+// Adds kLongFrames frames until the store is full, returns the ones that
+// went in.
+std::vector<rgb24> Fill() {
+  std::vector<rgb24> frames;
+  store.Begin();
+  for (size_t f = 0; f < kLongFrames; f++) {
+    Draw(f, store.Canvas());
+    if (!store.Add(20)) break;
+    frames.insert(frames.end(), store.Canvas(),
+                  store.Canvas() + kFramePixels);
+  }
+  store.End();
+  return frames;
+}
+
+// Plays kLoops loops, calling Prefetch() |prefetch| times before each frame,
+// and returns how many frames differ from |frames|.
+size_t Mismatches(const std::vector<rgb24>& frames, size_t prefetch) {
+  store.Rewind();
+  size_t count = frames.size() / kFramePixels;
+  size_t bad = 0;
+  for (size_t i = 0; i < kLoops * count; i++) {
+    for (size_t p = 0; p < prefetch; p++) store.Prefetch();
+    size_t delay;
+    const rgb24* frame = store.Next(&delay);
+    if (memcmp(frame, &frames[kFramePixels * (i % count)], kFrameBytes) != 0) {
+      bad++;
+    }
+  }
+  return bad;
+}
+
+// Microseconds per Next() over a loop, with |prefetch| Prefetch() calls
+// before each, which aren't counted.
+double MicrosPerNext(size_t prefetch) {
+  store.Rewind();
+  double total = 0;
+  for (size_t i = 0; i < store.frames(); i++) {
+    for (size_t p = 0; p < prefetch; p++) store.Prefetch();
+    size_t delay;
+    auto start = std::chrono::steady_clock::now();
+    store.Next(&delay);
+    auto end = std::chrono::steady_clock::now();
+    total += std::chrono::duration<double, std::micro>(end - start).count();
+  }
+  return total / store.frames();
+}
+
+// Microseconds to copy the frame at the start of |tier| into |dest| a panel
+// row at a time, with the host's caches emptied before each copy.
+double MicrosPerCopy(FrameTier tier, rgb24* dest) {
+  static std::vector<uint8_t> evict(kEvictBytes, 1);
+  const rgb24* src = (const rgb24*)store.data(tier);
+  double total = 0;
+  volatile uint8_t sum = 0;
+  for (size_t r = 0; r < kCopyRepeats; r++) {
+    for (size_t i = 0; i < kEvictBytes; i += 64) sum += evict[i];
+    auto start = std::chrono::steady_clock::now();
+    for (int panel = 0; panel < 4; panel++) {
+      for (int y = 0; y < kMatrixHeight; y++) {
+        size_t at = kMatrixWidth * y + kPanelWidth * panel;
+        memcpy(&dest[at], &src[at], kPanelWidth * sizeof(rgb24));
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+    total += std::chrono::duration<double, std::micro>(end - start).count();
+    sum += dest[r].red;
+  }
+  return total / kCopyRepeats;
+}
+
+// Frames whose delta is in |tier|.
+size_t FramesIn(FrameTier tier) {
+  size_t count = 0;
+  for (size_t i = 0; i < store.frames(); i++) {
+    const FrameStore::Entry& entry = store.entries()[i];
+    if (entry.tier == tier && entry.length != FrameStore::kWholeFrame) {
+      count++;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+int main() {
+  int failures = 0;
+
+  // Only the static tier, as on a board whose heap has nothing left.
+  size_t static_frames = Fill().size() / kFramePixels;
+
+  static std::vector<uint8_t> heap(kHeapTierBytes + kCacheLine);
+  static std::vector<uint8_t> ext(kExtTierBytes + kCacheLine);
+  static std::vector<uint8_t> stage(kStageBytes + kCacheLine);
+  auto align = [](std::vector<uint8_t>& memory) {
+    return memory.data() + (-(uintptr_t)memory.data() & (kCacheLine - 1));
+  };
+  store.SetTier(kHeapTier, align(heap), kHeapTierBytes);
+  store.SetTier(kExtTier, align(ext), kExtTierBytes);
+  store.SetStage(align(stage));
+  std::vector<rgb24> frames = Fill();
+
+  if (store.frames() != kLongFrames) {
+    printf("Kept %zu of %zu frames\n", store.frames(), kLongFrames);
+    failures++;
+  }
+  for (size_t t = 0; t < kNumFrameTiers; t++) {
+    if (store.used((FrameTier)t) == 0) {
+      printf("Nothing in the %s tier\n", kTierNames[t]);
+      failures++;
+    }
+  }
+
+  size_t bad = Mismatches(frames, kPrefetchCalls);
+  if (bad > 0 || store.misses() > 0) {
+    printf("With Prefetch(): %zu frames differ, %u deltas read from PSRAM\n",
+           bad, store.misses());
+    failures++;
+  }
+  bad = Mismatches(frames, 0);
+  uint32_t misses = store.misses();
+  if (bad > 0) {
+    printf("Without Prefetch(): %zu frames differ\n", bad);
+    failures++;
+  }
+
+  std::vector<rgb24> dest(kFramePixels);
+  printf("%-8s %10s %10s %7s %10s\n", "tier", "size", "used", "frames",
+         "us/copy");
+  for (size_t t = 0; t < kNumFrameTiers; t++) {
+    FrameTier tier = (FrameTier)t;
+    printf("%-8s %10zu %10zu %7zu %10.2f\n", kTierNames[t], store.size(tier),
+           store.used(tier), FramesIn(tier), MicrosPerCopy(tier, dest.data()));
+  }
+  printf("%zu frames kept, %zu with the static tier alone\n", store.frames(),
+         static_frames);
+  printf("us/Next %.2f with Prefetch(), %.2f without, %u PSRAM reads per "
+         "%zu loops without\n", MicrosPerNext(kPrefetchCalls),
+         MicrosPerNext(0), misses, kLoops);
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,235 @@
+// Timing simulation of LedPanel's sliced rendering.
+//
+// Drives RenderJob.h the way LedPanel::Update() does, against a simulated
+// clock: every loop() iteration costs kLoopMicros of sampling before the
+// slice, every row drawn costs a fixed time, and a refresh picks up the
+// swapped buffer every kRefreshMicros, until which the next frame can't
+// start (SwapPending()). Rows are drawn for real, with the compositor or the
+// ripple shader, into two alternating back buffers.
+//
+// Checks, for composites at about the device's cost per row and for ripples:
+//   - that no slice takes longer than kRenderSliceMicros plus the row that
+//     ends it,
+//   - that no frame misses kRenderDeadlineMs,
+//   - that every frame swapped in is exactly the frame drawn in one go,
+//     also when frames are dropped halfway with Cancel(), as CancelRender()
+//     does after "b" drew over the back buffer, and the back buffer is
+//     scribbled over.
+// With rows slower than a slice it checks that a slice still draws exactly
+// one row, and that the frames are counted as missing their deadline.
+// Reports the worst slice and frame, and rows per slice. Fails if anything
+// above doesn't hold.
+//
+// Build and run with `make bench` from this directory.
+
+#include <stdio.h>
+#include <vector>
+
+#include "bench_util.h"
+
+#include "PanelShader.h"
+#include "Compositor.h"
+#include "RenderJob.h"
+
+namespace {
+
+const size_t kFramePixels = kMatrixWidth * kMatrixHeight;
+const size_t kDisplayPixels = kChainWidth * kMatrixHeight;
+const size_t kRows = kNumPanels * kMatrixHeight;
+const uint32_t kCyclesPerMicro = F_CPU_ACTUAL / 1000000;
+// Sampling every sensor and the rest of loop() around Update().
+const uint32_t kLoopMicros = 40;
+// About a 240Hz refresh.
+const uint32_t kRefreshMicros = 4167;
+const size_t kFrames = 200;
+
+struct Scenario {
+  const char* name;
+  RenderMode mode;
+  // Simulated cost of drawing one row.
+  uint32_t row_cycles;
+  // Every so many frames one is dropped halfway, 0 for never.
+  size_t cancel_every;
+  // Whether the frames are expected to be on screen in time.
+  bool in_time;
+};
+
+// A whole composite frame in kCompositeBudgetMicros, the most the device
+// should take, and rows far slower than a slice.
+const uint32_t kCompositeRowCycles =
+    kCompositeBudgetMicros * kCyclesPerMicro / kRows;
+const Scenario kScenarios[] = {
+  { "composite", kRenderFrames, kCompositeRowCycles, 0, true },
+  { "ripple", kRenderRipple, kShaderBudgetMicros * kCyclesPerMicro / kRows, 0,
+    true },
+  { "cancelled", kRenderFrames, kCompositeRowCycles, 3, true },
+  { "slow rows", kRenderFrames, 3 * RenderJob::SliceCycles(), 0, false },
+};
+
+// The simulated time, kept in step with ARM_DWT_CYCCNT.
+uint64_t now_us = 0;
+
+void Spend(uint32_t cycles) {
+  ARM_DWT_CYCCNT += cycles;
+  now_us += cycles / kCyclesPerMicro;
+}
+
+unsigned long NowMs() { return now_us / 1000; }
+
+Compositor compositor;
+PanelShader shader;
+std::vector<rgb24> animation(kFramePixels);
+
+struct Result {
+  size_t frames = 0;
+  size_t slices = 0;
+  size_t rows = 0;
+  size_t bad_frames = 0;
+  size_t cancelled = 0;
+  // Slices longer than allowed, and, with slow rows, slices of more than
+  // one row.
+  size_t overruns = 0;
+};
+
+// Starts frame |f| the way StartComposite() or StartProcedural() does.
+void BeginFrame(const Scenario& scenario, size_t f) {
+  uint8_t levels[kNumPanels];
+  for (size_t i = 0; i < kNumPanels; i++) {
+    levels[i] = (uint8_t)(f * 37 + i * 64);
+  }
+  if (scenario.mode == kRenderFrames) {
+    compositor.Begin(levels, animation.data(), NowMs());
+  } else {
+    shader.Begin(scenario.mode, levels, NowMs());
+  }
+}
+
+void DrawRow(const Scenario& scenario, size_t i, uint8_t y, rgb24* dest) {
+  if (scenario.mode == kRenderFrames) {
+    compositor.ComposeRow(i, y, dest);
+  } else {
+    shader.ShadeRow(i, y, &dest[kChainWidth * y + PanelX(i)]);
+  }
+}
+
+Result Run(const Scenario& scenario, RenderJob* job) {
+  Result result;
+  std::vector<rgb24> buffers[2] = { std::vector<rgb24>(kDisplayPixels),
+                                    std::vector<rgb24>(kDisplayPixels) };
+  std::vector<rgb24> expected(kDisplayPixels);
+  size_t back = 0;
+  // The buffer passed to the refresh, -1 once it has been picked up.
+  int swapped = -1;
+  uint64_t next_refresh = now_us + kRefreshMicros;
+  size_t started = 0;
+  // Generous: every frame waits for a refresh before it starts.
+  size_t max_loops = kFrames * (kRefreshMicros / kLoopMicros + kRows + 1);
+  for (size_t loop = 0; loop < max_loops && result.frames < kFrames; loop++) {
+    Spend(kLoopMicros * kCyclesPerMicro);
+    if (now_us >= next_refresh) {
+      if (swapped >= 0) {
+        back = 1 - swapped;
+        swapped = -1;
+      }
+      next_refresh += kRefreshMicros;
+    }
+
+    if (!job->Active() && swapped != (int)back) {
+      BeginFrame(scenario, started);
+      job->Start(NowMs());
+      started++;
+    }
+    if (!job->Active()) continue;
+
+    rgb24* dest = buffers[back].data();
+    uint32_t start = ARM_DWT_CYCCNT;
+    size_t rows = 0;
+    bool drawn = job->Slice([&](size_t i, uint8_t y) {
+      DrawRow(scenario, i, y, dest);
+      Spend(scenario.row_cycles);
+      rows++;
+    });
+    uint32_t cycles = ARM_DWT_CYCCNT - start;
+    result.slices++;
+    result.rows += rows;
+    if (cycles > RenderJob::SliceCycles() + scenario.row_cycles ||
+        (scenario.row_cycles >= RenderJob::SliceCycles() && rows != 1)) {
+      result.overruns++;
+    }
+
+    if (scenario.cancel_every > 0 && started % scenario.cancel_every == 0 &&
+        !drawn && rows > 0) {
+      // "b" drew over the back buffer and dropped the frame.
+      job->Cancel();
+      result.cancelled++;
+      memset(dest, 0x5a, kDisplayPixels * sizeof(rgb24));
+      continue;
+    }
+    if (!drawn) continue;
+
+    job->Finish(NowMs(), scenario.mode == kRenderFrames
+                             ? kCompositeBudgetMicros
+                             : kShaderBudgetMicros);
+    for (size_t i = 0; i < kNumPanels; i++) {
+      for (uint8_t y = 0; y < kMatrixHeight; y++) {
+        DrawRow(scenario, i, y, expected.data());
+      }
+    }
+    if (memcmp(dest, expected.data(), kDisplayPixels * sizeof(rgb24)) != 0) {
+      result.bad_frames++;
+    }
+    swapped = back;
+    result.frames++;
+  }
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  int failures = 0;
+  uint32_t seed = 12345;
+  for (rgb24& pixel : animation) {
+    seed = seed * 1664525u + 1013904223u;
+    pixel = { (uint8_t)(seed >> 24), (uint8_t)(seed >> 16),
+              (uint8_t)(seed >> 8) };
+  }
+  shader.Init();
+
+  printf("%-10s %7s %9s %9s %10s %7s\n", "render", "frames", "slice us",
+         "frame us", "rows/slice", "missed");
+  for (const Scenario& scenario : kScenarios) {
+    RenderJob job;
+    Result result = Run(scenario, &job);
+    printf("%-10s %7zu %9u %9u %10.1f %7u\n", scenario.name, result.frames,
+           job.slice_worst_micros(), job.worst_micros(),
+           (double)result.rows / max(result.slices, (size_t)1),
+           job.deadline_misses());
+    if (result.frames != kFrames) {
+      printf("FAIL: %s: %zu of %zu frames drawn\n", scenario.name,
+             result.frames, kFrames);
+      failures++;
+    }
+    if ((scenario.cancel_every > 0) != (result.cancelled > 0)) {
+      printf("FAIL: %s: %zu frames cancelled\n", scenario.name,
+             result.cancelled);
+      failures++;
+    }
+    if (result.overruns > 0) {
+      printf("FAIL: %s: %zu slices over budget\n", scenario.name,
+             result.overruns);
+      failures++;
+    }
+    if (result.bad_frames > 0) {
+      printf("FAIL: %s: %zu frames differ from drawing them in one go\n",
+             scenario.name, result.bad_frames);
+      failures++;
+    }
+    if (scenario.in_time != (job.deadline_misses() == 0)) {
+      printf("FAIL: %s: %u frames missed their deadline\n", scenario.name,
+             job.deadline_misses());
+      failures++;
+    }
+  }
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,11 @@
+// What the sensor pipeline benchmarks share: the firmware's own sample
+// width, thresholds and window sizes from SensorConfig.h, on top of the
+// Arduino shim.
+#ifndef HOST_BENCH_SENSORS_H_
+#define HOST_BENCH_SENSORS_H_
+
+#include "arduino_shim.h"
+
+#include "SensorConfig.h"
+
+#endif  // HOST_BENCH_SENSORS_H_
@@ -0,0 +1,239 @@
+// Exactness and speed benchmark for streaming an .lpa asset from a file.
+//
+// Plays ../ldur.lpa through AnimationStream.h from a StdioFile, the way
+// PlayFromLibrary() does from the SD card, and checks:
+//   - that kLoops loops give exactly the frames and delays in the asset,
+//     expanded here straight from its index, including the loop back to the
+//     first frame,
+//   - that a Pop() with no frame ready, because Pump() wasn't called, keeps
+//     the frame on screen and counts an underrun,
+//   - that a file cut short, or with a frame whose runs don't cover it, makes
+//     Pump() fail and close the stream after the frames before it played
+//     right, and that a file for another layout doesn't open.
+// Reports the time per Pump() and how many a frame takes. Fails if anything
+// above doesn't hold.
+//
+// Build and run with `make bench` from this directory.
+
+#include <stdio.h>
+#include <vector>
+
+#include "bench_util.h"
+
+#include "FrameStore.h"
+#include "PanelAsset.h"
+#include "AnimationStream.h"
+
+namespace {
+
+const size_t kLoops = 3;
+
+struct Asset {
+  PanelAsset::Header header;
+  std::vector<PanelAsset::IndexEntry> index;
+  std::vector<rgb24> pixels;
+
+  size_t frames() const { return index.size(); }
+  const rgb24* operator[](size_t i) const { return &pixels[kFramePixels * i]; }
+};
+
+// Expands every frame of |lpa| without going through the stream.
+bool Expand(const std::vector<uint8_t>& lpa, Asset* asset) {
+  if (lpa.size() < sizeof(asset->header)) return false;
+  memcpy(&asset->header, lpa.data(), sizeof(asset->header));
+  size_t frames = asset->header.frames;
+  size_t data_start = sizeof(PanelAsset::Header) +
+                      frames * sizeof(PanelAsset::IndexEntry);
+  if (lpa.size() < data_start) return false;
+  asset->index.resize(frames);
+  memcpy(asset->index.data(), lpa.data() + sizeof(PanelAsset::Header),
+         frames * sizeof(PanelAsset::IndexEntry));
+  asset->pixels.resize(frames * kFramePixels);
+  for (size_t i = 0; i < frames; i++) {
+    const PanelAsset::IndexEntry& entry = asset->index[i];
+    if (data_start + entry.offset + entry.length > lpa.size()) return false;
+    PanelAsset::RunExpander expander;
+    expander.Begin(&asset->pixels[kFramePixels * i], kFramePixels);
+    if (!expander.Expand(lpa.data() + data_start + entry.offset,
+                         entry.length) ||
+        !expander.Complete()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A file holding |bytes|, as the SD card would.
+StdioFile FileOf(const std::vector<uint8_t>& bytes) {
+  FILE* file = tmpfile();
+  if (file != nullptr) fwrite(bytes.data(), 1, bytes.size(), file);
+  return StdioFile(file);
+}
+
+std::vector<rgb24> slots(kStreamSlots * kFramePixels);
+AnimationStream<StdioFile> stream;
+
+int failures = 0;
+
+void Fail(const char* what) {
+  printf("FAIL: %s\n", what);
+  failures++;
+}
+
+// Pump() calls that always complete the next frame: one per chunk of the
+// longest frame, and one more for a read cut short by a chunk boundary.
+size_t PumpsPerFrame(const Asset& asset) {
+  size_t longest = 0;
+  for (const PanelAsset::IndexEntry& entry : asset.index) {
+    longest = max(longest, (size_t)entry.length);
+  }
+  return (longest + kStreamChunkSize - 1) / kStreamChunkSize + 1;
+}
+
+// Plays |count| frames from frame |first| on, pumping |pumps| times before
+// each, and returns how many were shown before one differed from |asset| or
+// Pump() failed.
+size_t Play(const Asset& asset, size_t first, size_t count, size_t pumps) {
+  for (size_t i = 0; i < count; i++) {
+    for (size_t p = 0; p < pumps; p++) {
+      if (!stream.Pump()) return i;
+    }
+    const rgb24* frame = stream.Front();
+    size_t f = (first + i) % asset.frames();
+    if (frame == nullptr || memcmp(frame, asset[f], kFrameBytes) != 0 ||
+        stream.FrontDelay() != asset.index[f].delay_ms) {
+      return i;
+    }
+    stream.Pop();
+  }
+  return count;
+}
+
+void CheckPlayback(const Asset& asset) {
+  FILE* file = fopen("../ldur.lpa", "rb");
+  if (!stream.Open(StdioFile(file), slots.data(), asset.header.layout)) {
+    Fail("can't open ../ldur.lpa as a stream");
+    return;
+  }
+  size_t count = kLoops * asset.frames();
+  if (Play(asset, 0, count, PumpsPerFrame(asset)) != count) {
+    Fail("streamed frames differ from the asset");
+  }
+  if (stream.Underruns() != 0) Fail("underrun with Pump() keeping up");
+
+  // Starved: the frames already complete play out, then the last one stays
+  // on screen.
+  size_t shown = count - 1;
+  for (size_t i = 0; i < kStreamSlots; i++) {
+    uint32_t underruns = stream.Underruns();
+    stream.Pop();
+    if (stream.Underruns() != underruns) break;
+    shown++;
+  }
+  if (stream.Underruns() == 0) Fail("no underrun without Pump()");
+  size_t f = shown % asset.frames();
+  const rgb24* front = stream.Front();
+  if (front == nullptr || memcmp(front, asset[f], kFrameBytes) != 0 ||
+      stream.FrontDelay() != asset.index[f].delay_ms) {
+    Fail("underrun doesn't repeat the frame on screen");
+  }
+  // And carries on where it was once Pump() runs again.
+  if (Play(asset, shown + 1, asset.frames(), PumpsPerFrame(asset)) !=
+      asset.frames()) {
+    Fail("stream didn't recover from the underrun");
+  }
+  stream.Close();
+}
+
+// |lpa| damaged so that frame |bad| can't be read: the frames before it must
+// play, then Pump() fails and the stream closes.
+void CheckDamaged(const char* name, const std::vector<uint8_t>& lpa,
+                  const Asset& asset, size_t bad) {
+  if (!stream.Open(FileOf(lpa), slots.data(), asset.header.layout)) {
+    printf("FAIL: %s: doesn't open\n", name);
+    failures++;
+    return;
+  }
+  // Every frame is shown as soon as it is complete, so each good one is
+  // checked before the damage is read.
+  // Bounded, in case the damage goes unnoticed and the stream loops.
+  size_t played = 0;
+  bool right = true;
+  size_t pumps = kLoops * asset.frames() * PumpsPerFrame(asset);
+  for (size_t p = 0; p < pumps && stream.Pump(); p++) {
+    uint32_t underruns = stream.Underruns();
+    const rgb24* frame = stream.Front();
+    stream.Pop();
+    if (stream.Underruns() != underruns) continue;
+    if (played >= asset.frames() ||
+        memcmp(frame, asset[played], kFrameBytes) != 0) {
+      right = false;
+    }
+    played++;
+  }
+  if (stream.IsOpen()) {
+    printf("FAIL: %s: stream still open after Pump() failed\n", name);
+    failures++;
+  }
+  if (!right || played != bad) {
+    printf("FAIL: %s: %zu frames played, want the %zu before the damage\n",
+           name, played, bad);
+    failures++;
+  }
+  stream.Close();
+}
+
+void BenchPump(const Asset& asset) {
+  FILE* file = fopen("../ldur.lpa", "rb");
+  stream.Open(StdioFile(file), slots.data(), asset.header.layout);
+  size_t pumps = PumpsPerFrame(asset);
+  double us = MicrosPerCall(kLoops * asset.frames(), [&]() {
+    for (size_t p = 0; p < pumps; p++) stream.Pump();
+    stream.Pop();
+  });
+  stream.Close();
+  printf("%-8s %7s %10s %10s\n", "stream", "frames", "us/Pump",
+         "Pump/frame");
+  printf("%-8s %7zu %10.2f %10zu\n", "ldur", asset.frames(), us / pumps,
+         pumps);
+}
+
+}  // namespace
+
+int main() {
+  std::vector<uint8_t> lpa = ReadFile("../ldur.lpa");
+  Asset asset;
+  if (!Expand(lpa, &asset) || asset.frames() < 2) {
+    printf("Can't read ../ldur.lpa\n");
+    return 1;
+  }
+
+  CheckPlayback(asset);
+
+  // Cut off in the middle of the last frame's runs.
+  const PanelAsset::IndexEntry& last = asset.index.back();
+  size_t data_start = sizeof(PanelAsset::Header) +
+                      asset.frames() * sizeof(PanelAsset::IndexEntry);
+  std::vector<uint8_t> truncated(
+      lpa.begin(), lpa.begin() + data_start + last.offset + last.length / 2);
+  CheckDamaged("truncated", truncated, asset, asset.frames() - 1);
+
+  // The second frame's index says its runs are shorter than they are, so
+  // they stop before the frame is covered.
+  std::vector<uint8_t> corrupt = lpa;
+  size_t at = sizeof(PanelAsset::Header) + sizeof(PanelAsset::IndexEntry) +
+              offsetof(PanelAsset::IndexEntry, length);
+  uint32_t length;
+  memcpy(&length, &corrupt[at], sizeof(length));
+  length /= 2;
+  memcpy(&corrupt[at], &length, sizeof(length));
+  CheckDamaged("corrupt", corrupt, asset, 1);
+
+  if (stream.Open(FileOf(lpa), slots.data(), asset.header.layout + 1)) {
+    Fail("opened an asset for another layout");
+    stream.Close();
+  }
+
+  BenchPump(asset);
+  return failures > 0 ? 1 : 0;
+}
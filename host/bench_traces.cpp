@@ -0,0 +1,374 @@
+// Latency and false-trigger regression benchmark over the traces in traces/.
+//
+// Every trace is played through the firmware's own Sensor -> HullMovingAverage
+// -> SensorState pipeline, and the resulting button events are compared with
+// the trace's annotated steps. Per trace this reports:
+//   - actuation latency: from an annotated press to the button press,
+//   - release latency: from an annotated release to the button release,
+//   - missed steps: annotated steps that produced no press in time,
+//   - ghost presses: presses that don't belong to an annotated step, including
+//     a second press during one step.
+// Latencies are in milliseconds, as the mean and the worst over all steps.
+//
+// The results are compared with traces/baseline.txt and the benchmark fails if
+// any metric got worse by more than its tolerance. Run with --update to write
+// the current results as the new baseline.
+//
+// A .trace file is plain text:
+//   # comment
+//   rate <samples per second and sensor>
+//   bits <sample width>                   values and the threshold are scaled
+//                                         from it to kPipelineBits
+//   send_every <samples per HID report>   states are resolved on report samples
+//   threshold <value>
+//   panels <panel of sensor 0> <panel of sensor 1> ...
+//   press <sample> <panel>                annotated ground truth
+//   release <sample> <panel>
+//   <sensor 0> <sensor 1> ...             one line per sample, raw values
+// Sensors of the same panel must be listed next to each other, as in the
+// sketch's kWiring.
+//
+// Build and run with `make bench` from this directory.
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "bench_sensors.h"
+#include "ADC.h"
+
+namespace {
+
+struct ButtonEvent {
+  size_t sample;
+  uint8_t button;
+  bool press;
+};
+
+// Where SensorState's presses and releases end up.
+std::vector<ButtonEvent> events;
+size_t current_sample = 0;
+
+}  // namespace
+
+void ButtonPress(uint8_t button_num) {
+  events.push_back({ current_sample, button_num, true });
+}
+
+void ButtonRelease(uint8_t button_num) {
+  events.push_back({ current_sample, button_num, false });
+}
+
+#include "MemoryPlacement.h"
+#include "AdcTuner.h"
+#include "LatencyTest.h"
+#include "MovingAverage.h"
+#include "SensorState.h"
+#include "PadTopology.h"
+#include "Sensor.h"
+
+namespace {
+
+// Presses later than this after an annotated press count as missed steps.
+const double kMaxLatencyMs = 50;
+
+struct Step {
+  size_t press;
+  size_t release;
+  uint8_t panel;
+};
+
+struct Trace {
+  std::string name;
+  unsigned rate = 1000;
+  unsigned bits = kPipelineBits;
+  unsigned send_every = 1;
+  // In the trace's bits until LoadTrace() scales it, -1 if not given.
+  int32_t threshold = -1;
+  std::vector<uint8_t> panels;
+  std::vector<Step> steps;
+  std::vector<std::vector<int16_t>> samples;
+};
+
+bool LoadTrace(const std::filesystem::path& path, Trace* trace) {
+  std::ifstream in(path);
+  if (!in) return false;
+  trace->name = path.stem().string();
+  std::map<uint8_t, size_t> open_presses;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    std::string key;
+    fields >> key;
+    if (key == "rate") {
+      fields >> trace->rate;
+    } else if (key == "bits") {
+      fields >> trace->bits;
+    } else if (key == "send_every") {
+      fields >> trace->send_every;
+    } else if (key == "threshold") {
+      fields >> trace->threshold;
+    } else if (key == "panels") {
+      unsigned panel;
+      while (fields >> panel) trace->panels.push_back(panel);
+    } else if (key == "press" || key == "release") {
+      size_t sample;
+      unsigned panel;
+      fields >> sample >> panel;
+      if (key == "press") {
+        open_presses[panel] = sample;
+      } else if (open_presses.count(panel)) {
+        trace->steps.push_back({ open_presses[panel], sample, (uint8_t)panel });
+        open_presses.erase(panel);
+      }
+    } else {
+      std::istringstream values(line);
+      std::vector<int16_t> sample;
+      int value;
+      while (values >> value) sample.push_back(value);
+      if (sample.size() != trace->panels.size()) {
+        fprintf(stderr, "%s: sample %zu has %zu values, expected %zu\n",
+                path.c_str(), trace->samples.size(), sample.size(),
+                trace->panels.size());
+        return false;
+      }
+      trace->samples.push_back(sample);
+    }
+  }
+  // Brings the trace to kPipelineBits the way AdcTuner::Normalize() does.
+  auto scale = [trace](int32_t value) -> int16_t {
+    return trace->bits > kPipelineBits ? value >> (trace->bits - kPipelineBits)
+                                       : value << (kPipelineBits - trace->bits);
+  };
+  trace->threshold =
+      trace->threshold < 0 ? kDefaultThreshold : scale(trace->threshold);
+  for (auto& sample : trace->samples) {
+    for (int16_t& value : sample) value = scale(value);
+  }
+  std::sort(trace->steps.begin(), trace->steps.end(),
+            [](const Step& a, const Step& b) { return a.press < b.press; });
+  return !trace->panels.empty() && trace->send_every > 0;
+}
+
+// Plays |trace| through a freshly wired pad and returns the button events.
+// Panel p reports as button p + 1.
+std::vector<ButtonEvent> Play(const Trace& trace) {
+  size_t num_panels =
+      *std::max_element(trace.panels.begin(), trace.panels.end()) + 1;
+  std::vector<std::unique_ptr<SensorState>> states;
+  for (size_t p = 0; p < num_panels; p++) {
+    size_t count = std::count(trace.panels.begin(), trace.panels.end(), p);
+    states.emplace_back(new SensorState(p + 1, count));
+  }
+
+  ADC adc;
+  std::vector<std::unique_ptr<Sensor>> sensors;
+  for (size_t i = 0; i < trace.panels.size(); i++) {
+    uint8_t panel = trace.panels[i];
+    uint8_t slot = std::count(trace.panels.begin(), trace.panels.begin() + i,
+                              panel);
+    bool last = i + 1 == trace.panels.size() || trace.panels[i + 1] != panel;
+    SensorTopology topology = { (uint8_t)i, panel, slot, last, kUnpaired };
+    sensors.emplace_back(new Sensor(&adc, topology, states[panel].get()));
+    sensors.back()->Init(i + 1);
+    sensors.back()->UpdateThreshold(trace.threshold);
+  }
+
+  events.clear();
+  for (current_sample = 0; current_sample < trace.samples.size();
+       current_sample++) {
+    bool willSend = current_sample % trace.send_every == trace.send_every - 1;
+    const std::vector<int16_t>& sample = trace.samples[current_sample];
+    for (size_t i = 0; i < sensors.size(); i++) {
+      sensors[i]->EvaluateSample(sample[i], willSend);
+    }
+  }
+  return events;
+}
+
+struct Metrics {
+  double mean_press_ms = 0;
+  double max_press_ms = 0;
+  double mean_release_ms = 0;
+  double max_release_ms = 0;
+  double missed = 0;
+  double ghosts = 0;
+};
+
+// Name, member and how much worse than the baseline a metric may get.
+struct MetricInfo {
+  const char* name;
+  double Metrics::*value;
+  double tolerance;
+};
+
+const MetricInfo kMetrics[] = {
+  { "mean_press_ms", &Metrics::mean_press_ms, 0.5 },
+  { "max_press_ms", &Metrics::max_press_ms, 1.0 },
+  { "mean_release_ms", &Metrics::mean_release_ms, 0.5 },
+  { "max_release_ms", &Metrics::max_release_ms, 1.0 },
+  { "missed", &Metrics::missed, 0 },
+  { "ghosts", &Metrics::ghosts, 0 },
+};
+
+Metrics Score(const Trace& trace, const std::vector<ButtonEvent>& events) {
+  Metrics metrics;
+  double ms_per_sample = 1000.0 / trace.rate;
+  size_t max_latency = kMaxLatencyMs / ms_per_sample;
+  std::vector<bool> used(events.size(), false);
+  size_t presses = 0, releases = 0;
+
+  for (const Step& step : trace.steps) {
+    uint8_t button = step.panel + 1;
+    // The first press of this panel within the step, or shortly after it.
+    size_t press = events.size();
+    for (size_t e = 0; e < events.size(); e++) {
+      const ButtonEvent& event = events[e];
+      if (used[e] || event.button != button || !event.press) continue;
+      if (event.sample >= step.press &&
+          event.sample < min(step.release, step.press + max_latency)) {
+        press = e;
+        break;
+      }
+    }
+    if (press == events.size()) {
+      metrics.missed++;
+      continue;
+    }
+    used[press] = true;
+    double latency = (events[press].sample - step.press) * ms_per_sample;
+    metrics.mean_press_ms += latency;
+    metrics.max_press_ms = max(metrics.max_press_ms, latency);
+    presses++;
+
+    // The release that ends it. Anything this panel does in between is a
+    // ghost release/press pair, which the unused press will count.
+    for (size_t e = press + 1; e < events.size(); e++) {
+      const ButtonEvent& event = events[e];
+      if (event.button != button || event.press) continue;
+      bool next_is_press = false;
+      for (size_t n = e + 1; n < events.size(); n++) {
+        if (events[n].button == button) {
+          next_is_press = events[n].sample < step.release;
+          break;
+        }
+      }
+      if (next_is_press) continue;
+      used[e] = true;
+      double release = ((double)event.sample - step.release) * ms_per_sample;
+      metrics.mean_release_ms += release;
+      metrics.max_release_ms = max(metrics.max_release_ms, release);
+      releases++;
+      break;
+    }
+  }
+  for (size_t e = 0; e < events.size(); e++) {
+    if (events[e].press && !used[e]) metrics.ghosts++;
+  }
+  if (presses > 0) metrics.mean_press_ms /= presses;
+  if (releases > 0) metrics.mean_release_ms /= releases;
+  return metrics;
+}
+
+// Baseline lines are "<trace> <metric> <value>".
+typedef std::map<std::string, std::map<std::string, double>> Baseline;
+
+Baseline LoadBaseline(const std::filesystem::path& path) {
+  Baseline baseline;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    std::string trace, metric;
+    double value;
+    if (fields >> trace >> metric >> value) baseline[trace][metric] = value;
+  }
+  return baseline;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool update = false;
+  std::filesystem::path dir = "traces";
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--update") {
+      update = true;
+    } else {
+      dir = arg;
+    }
+  }
+
+  std::vector<std::filesystem::path> paths;
+  for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+    if (entry.path().extension() == ".trace") paths.push_back(entry.path());
+  }
+  std::sort(paths.begin(), paths.end());
+  if (paths.empty()) {
+    fprintf(stderr, "No traces in %s\n", dir.c_str());
+    return 1;
+  }
+
+  std::filesystem::path baseline_path = dir / "baseline.txt";
+  Baseline baseline = LoadBaseline(baseline_path);
+  std::ostringstream new_baseline;
+  new_baseline << "# Written by bench_traces --update.\n";
+  size_t regressions = 0;
+
+  printf("%-16s %6s %10s %10s %10s %10s %7s %7s\n", "trace", "steps",
+         "press_avg", "press_max", "rel_avg", "rel_max", "missed", "ghosts");
+  for (const auto& path : paths) {
+    Trace trace;
+    if (!LoadTrace(path, &trace)) {
+      fprintf(stderr, "Could not load %s\n", path.c_str());
+      return 1;
+    }
+    Metrics metrics = Score(trace, Play(trace));
+    printf("%-16s %6zu %10.2f %10.2f %10.2f %10.2f %7.0f %7.0f\n",
+           trace.name.c_str(), trace.steps.size(), metrics.mean_press_ms,
+           metrics.max_press_ms, metrics.mean_release_ms,
+           metrics.max_release_ms, metrics.missed, metrics.ghosts);
+
+    for (const MetricInfo& info : kMetrics) {
+      double value = metrics.*info.value;
+      char text[32];
+      snprintf(text, sizeof(text), "%.2f", value);
+      new_baseline << trace.name << " " << info.name << " " << text << "\n";
+      auto known = baseline.find(trace.name);
+      if (update || known == baseline.end() ||
+          !known->second.count(info.name)) {
+        continue;
+      }
+      double expected = known->second[info.name];
+      if (value > expected + info.tolerance + 1e-9) {
+        printf("  REGRESSION %s: %.2f, baseline %.2f (tolerance %.2f)\n",
+               info.name, value, expected, info.tolerance);
+        regressions++;
+      }
+    }
+  }
+
+  if (update) {
+    std::ofstream(baseline_path) << new_baseline.str();
+    printf("Wrote %s\n", baseline_path.c_str());
+    return 0;
+  }
+  if (baseline.empty()) {
+    printf("No baseline in %s, run with --update to create one\n",
+           baseline_path.c_str());
+  }
+  if (regressions > 0) {
+    printf("%zu metric(s) regressed\n", regressions);
+    return 1;
+  }
+  return 0;
+}
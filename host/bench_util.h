@@ -0,0 +1,61 @@
+// What the LED benchmarks share: the pixel type SmartMatrix has on the
+// device, the firmware's own panel layout for one pad, and helpers to read
+// the animation files and time a call.
+#ifndef HOST_BENCH_UTIL_H_
+#define HOST_BENCH_UTIL_H_
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "arduino_shim.h"
+
+// As SmartMatrix defines it.
+typedef struct rgb24 {
+  uint8_t red, green, blue;
+} rgb24;
+
+#include "SensorConfig.h"
+// One pad, as led-panel-fsr.ino is set up by default.
+const size_t kNumPads = 1;
+
+#include "MemoryPlacement.h"
+#include "PanelLayout.h"
+
+inline std::vector<uint8_t> ReadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(in),
+                              std::istreambuf_iterator<char>());
+}
+
+// Hands a file in memory to PanelGif's decoder.
+struct MemoryReader {
+  const uint8_t* data;
+  size_t size;
+  size_t position;
+
+  int ReadBlock(void* buffer, int count) {
+    size_t n = min((size_t)count, size - position);
+    memcpy(buffer, data + position, n);
+    position += n;
+    return n;
+  }
+
+  // All of it is there from the start, so the decoder never waits.
+  void Mark() {}
+  void Rewind() {}
+  bool Waiting() const { return false; }
+};
+
+// Mean microseconds per call of |call| over |repeats| calls.
+inline double MicrosPerCall(size_t repeats, const std::function<void()>& call) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < repeats; i++) call();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() /
+         repeats;
+}
+
+#endif  // HOST_BENCH_UTIL_H_
@@ -0,0 +1,441 @@
+#include "pad_link.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace padlink {
+
+namespace {
+
+// epoll_event.data holds the pad and whether the event is for its port or
+// its stream timer.
+const uint64_t kTimerBit = 1ull << 32;
+
+// The slowest an upload is assumed to go, 100KB/s, on top of the reply
+// timeout. The pad decodes a GIF as it arrives, so this covers that too.
+const size_t kMinUploadBytesPerMs = 100;
+
+// What the firmware prints when it turns an upload down, see LedPanel.h.
+// Anything else it prints while taking one in ("GIF longer than the frame
+// store, keeping 12 frames", "Animation too large to cache") is only news.
+const char* const kUploadRejections[] = {
+  "GIF incorrect size",
+  "GIF corrupt",
+  "Asset does not match this panel layout",
+  "Asset frame corrupt",
+};
+
+bool IsUploadRejection(const std::string& line) {
+  for (const char* rejection : kUploadRejections) {
+    if (line.compare(0, strlen(rejection), rejection) == 0) return true;
+  }
+  return false;
+}
+
+int64_t NowMillis() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (int64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+}  // namespace
+
+std::vector<int> ParseNumbers(const std::string& line) {
+  std::vector<int> numbers;
+  const char* p = line.c_str() + 1;
+  while (*p != '\0') {
+    char* end;
+    long value = strtol(p, &end, 10);
+    if (end == p) break;
+    numbers.push_back((int)value);
+    p = end;
+  }
+  return numbers;
+}
+
+PadLink::PadLink() : epoll_fd_(epoll_create1(EPOLL_CLOEXEC)) {}
+
+PadLink::~PadLink() {
+  while (!pads_.empty()) Close(pads_.begin()->first);
+  if (epoll_fd_ >= 0) close(epoll_fd_);
+}
+
+int PadLink::Open(const std::string& path) {
+  if (epoll_fd_ < 0) return -1;
+  int fd = open(path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+  if (fd < 0) return -1;
+  // Raw bytes both ways: no echo, no line editing, no CR/LF translation.
+  // The baud rate doesn't matter over USB.
+  termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+
+  int pad = next_pad_++;
+  std::unique_ptr<Pad> state(new Pad);
+  state->fd = fd;
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.u64 = (uint64_t)pad;
+  if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+    close(fd);
+    return -1;
+  }
+  pads_[pad] = std::move(state);
+  return pad;
+}
+
+void PadLink::Close(int pad) {
+  Pad* state = Find(pad);
+  if (state == nullptr) return;
+  StopStream(pad);
+  epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, state->fd, nullptr);
+  close(state->fd);
+  pads_.erase(pad);
+}
+
+void PadLink::GetValues(int pad, ValuesCallback done) {
+  Expect(pad, 'v', [done](const std::string* line) {
+    done(line != nullptr ? ParseNumbers(*line) : std::vector<int>());
+  });
+  Send(pad, "v\n");
+}
+
+void PadLink::GetThresholds(int pad, ValuesCallback done) {
+  Expect(pad, 't', [done](const std::string* line) {
+    done(line != nullptr ? ParseNumbers(*line) : std::vector<int>());
+  });
+  Send(pad, "t\n");
+}
+
+void PadLink::SetThreshold(int pad, size_t sensor, int value,
+                           ValuesCallback done) {
+  Pad* state = Find(pad);
+  if (state == nullptr) return;
+  if (value < 0 || (state->max_value >= 0 && value > state->max_value) ||
+      (state->sensors > 0 && sensor >= state->sensors)) {
+    done(std::vector<int>());
+    return;
+  }
+  // Without the range yet, an "i" goes first. Its reply comes in before the
+  // pad would have answered this, and fails it then if it is out of range.
+  if (state->max_value < 0) {
+    Expect(pad, 'i', [](const std::string*) {});
+    Send(pad, "i\n");
+  }
+  Expect(pad, 't', [done](const std::string* line) {
+    done(line != nullptr ? ParseNumbers(*line) : std::vector<int>());
+  }, 0, value);
+  Send(pad, std::to_string(sensor) + " " + std::to_string(value) + "\n");
+}
+
+void PadLink::ResetOffsets(int pad) {
+  Send(pad, "o\n");
+}
+
+void PadLink::GetInfo(int pad, InfoCallback done) {
+  Expect(pad, 'i', [done](const std::string* line) {
+    std::vector<int> numbers;
+    if (line != nullptr) numbers = ParseNumbers(*line);
+    if (numbers.size() >= 2) {
+      done(numbers[0], numbers[1]);
+    } else {
+      done(0, 0);
+    }
+  });
+  Send(pad, "i\n");
+}
+
+void PadLink::UploadGif(int pad, const std::vector<uint8_t>& data,
+                        UploadCallback done) {
+  Upload(pad, 'g', data, done);
+}
+
+void PadLink::UploadAsset(int pad, const std::vector<uint8_t>& data,
+                          UploadCallback done) {
+  Upload(pad, 'a', data, done);
+}
+
+void PadLink::Upload(int pad, char command, const std::vector<uint8_t>& data,
+                     UploadCallback done) {
+  Pad* state = Find(pad);
+  if (state == nullptr) return;
+  std::string bytes = std::string(1, command) + " " +
+                      std::to_string(data.size()) + "\n";
+  bytes.append(data.begin(), data.end());
+  Send(pad, bytes);
+  // The pad has no reply of its own for an upload, so an "i" sent right
+  // behind it tells when it is done. A rejection line printed before that
+  // reply is the upload being turned down.
+  Expect(pad, 'i', [this, pad, done](const std::string* line) {
+    Pad* state = Find(pad);
+    std::string error = state != nullptr ? state->upload_error : "closed";
+    if (state != nullptr) {
+      state->upload_error.clear();
+      state->in_upload = false;
+    }
+    if (line == nullptr && error.empty()) error = "No reply from the pad";
+    done(error.empty(), error);
+  }, reply_timeout_ms_ + (int)(data.size() / kMinUploadBytesPerMs));
+  state->in_upload = true;
+  Send(pad, "i\n");
+}
+
+void PadLink::StreamValues(int pad, int interval_ms,
+                           ValuesCallback on_values) {
+  Pad* state = Find(pad);
+  if (state == nullptr || interval_ms <= 0) return;
+  StopStream(pad);
+  int timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (timer_fd < 0) return;
+  itimerspec spec = {};
+  spec.it_interval.tv_sec = interval_ms / 1000;
+  spec.it_interval.tv_nsec = (long)(interval_ms % 1000) * 1000000;
+  spec.it_value = spec.it_interval;
+  timerfd_settime(timer_fd, 0, &spec, nullptr);
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.u64 = (uint64_t)pad | kTimerBit;
+  epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, timer_fd, &event);
+  state->stream.timer_fd = timer_fd;
+  state->stream.on_values = on_values;
+  state->stream.waiting = false;
+}
+
+void PadLink::StopStream(int pad) {
+  Pad* state = Find(pad);
+  if (state == nullptr || state->stream.timer_fd < 0) return;
+  epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, state->stream.timer_fd, nullptr);
+  close(state->stream.timer_fd);
+  state->stream = Stream();
+}
+
+size_t PadLink::Outstanding(int pad) const {
+  const Pad* state = Find(pad);
+  return state == nullptr ? 0 : state->pending.size();
+}
+
+bool PadLink::Poll(int timeout_ms) {
+  // Wake up for the next reply deadline too.
+  int until_deadline = NextDeadline();
+  if (until_deadline >= 0 && (timeout_ms < 0 || until_deadline < timeout_ms)) {
+    timeout_ms = until_deadline;
+  }
+  epoll_event events[16];
+  int count = epoll_wait(epoll_fd_, events, 16, timeout_ms);
+  if (count < 0) return errno == EINTR;
+  for (int i = 0; i < count; i++) {
+    int pad = (int)(events[i].data.u64 & 0xffffffff);
+    if (Find(pad) == nullptr) continue;
+    if (events[i].data.u64 & kTimerBit) {
+      Tick(pad);
+      continue;
+    }
+    if (events[i].events & EPOLLOUT) Flush(pad);
+    if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) Read(pad);
+  }
+  std::vector<int> pads;
+  for (const auto& entry : pads_) pads.push_back(entry.first);
+  for (int pad : pads) Expire(pad);
+  return true;
+}
+
+bool PadLink::RunUntil(const std::function<bool()>& done, int timeout_ms) {
+  int64_t deadline = NowMillis() + timeout_ms;
+  while (!done()) {
+    int64_t left = deadline - NowMillis();
+    if (left <= 0 || !Poll((int)left)) return done();
+  }
+  return true;
+}
+
+PadLink::Pad* PadLink::Find(int pad) {
+  auto it = pads_.find(pad);
+  return it == pads_.end() ? nullptr : it->second.get();
+}
+
+const PadLink::Pad* PadLink::Find(int pad) const {
+  auto it = pads_.find(pad);
+  return it == pads_.end() ? nullptr : it->second.get();
+}
+
+void PadLink::Send(int pad, const std::string& bytes) {
+  Pad* state = Find(pad);
+  if (state == nullptr) return;
+  state->out += bytes;
+  Flush(pad);
+}
+
+void PadLink::Expect(int pad, char reply, Handler handle, int timeout_ms,
+                     int max_needed) {
+  Pad* state = Find(pad);
+  if (state == nullptr) return;
+  if (timeout_ms <= 0) timeout_ms = reply_timeout_ms_;
+  state->pending.push_back({ reply, handle, timeout_ms, 0, max_needed });
+  Arm(state);
+}
+
+// Fails the requests the pad won't answer now that |max| is known.
+void PadLink::SetMaxValue(int pad, int max) {
+  Pad* state = Find(pad);
+  state->max_value = max;
+  std::vector<Handler> failed;
+  for (auto it = state->pending.begin(); it != state->pending.end();) {
+    if (it->max_needed > max) {
+      failed.push_back(it->handle);
+      it = state->pending.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  Arm(state);
+  for (const Handler& handle : failed) handle(nullptr);
+}
+
+// Starts the clock of the oldest request if it isn't running yet.
+void PadLink::Arm(Pad* state) {
+  if (state->pending.empty() || state->pending.front().deadline != 0) return;
+  state->pending.front().deadline =
+      NowMillis() + state->pending.front().timeout_ms;
+}
+
+// Fails the oldest requests for as long as they are past their deadline.
+void PadLink::Expire(int pad) {
+  while (true) {
+    Pad* state = Find(pad);
+    if (state == nullptr || state->pending.empty() ||
+        state->pending.front().deadline > NowMillis()) {
+      return;
+    }
+    Handler handle = state->pending.front().handle;
+    state->pending.pop_front();
+    Arm(state);
+    handle(nullptr);
+  }
+}
+
+// Milliseconds to the earliest deadline of any pad, or -1 if none is set.
+int PadLink::NextDeadline() {
+  int64_t earliest = -1;
+  for (const auto& entry : pads_) {
+    const Pad& state = *entry.second;
+    if (state.pending.empty()) continue;
+    int64_t deadline = state.pending.front().deadline;
+    if (earliest < 0 || deadline < earliest) earliest = deadline;
+  }
+  if (earliest < 0) return -1;
+  int64_t left = earliest - NowMillis();
+  return left > 0 ? (int)left : 0;
+}
+
+// Writes as much of the output as the port takes without blocking, and
+// waits for EPOLLOUT while anything is left.
+void PadLink::Flush(int pad) {
+  Pad* state = Find(pad);
+  while (!state->out.empty()) {
+    ssize_t written = write(state->fd, state->out.data(), state->out.size());
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    state->out.erase(0, written);
+  }
+  UpdateEvents(pad);
+}
+
+void PadLink::UpdateEvents(int pad) {
+  Pad* state = Find(pad);
+  bool want_write = !state->out.empty();
+  if (want_write == state->want_write) return;
+  state->want_write = want_write;
+  epoll_event event = {};
+  event.events = want_write ? EPOLLIN | EPOLLOUT : EPOLLIN;
+  event.data.u64 = (uint64_t)pad;
+  epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, state->fd, &event);
+}
+
+void PadLink::Read(int pad) {
+  char buffer[4096];
+  while (true) {
+    Pad* state = Find(pad);
+    if (state == nullptr) return;
+    ssize_t count = read(state->fd, buffer, sizeof(buffer));
+    if (count <= 0) {
+      if (count < 0 && errno == EINTR) continue;
+      return;
+    }
+    state->in.append(buffer, count);
+    size_t start = 0, end;
+    while ((end = state->in.find('\n', start)) != std::string::npos) {
+      std::string line = state->in.substr(start, end - start);
+      if (!line.empty() && line.back() == '\r') line.pop_back();
+      start = end + 1;
+      HandleLine(pad, line);
+      // A callback may have closed the pad.
+      state = Find(pad);
+      if (state == nullptr) return;
+    }
+    state->in.erase(0, start);
+  }
+}
+
+void PadLink::HandleLine(int pad, const std::string& line) {
+  Pad* state = Find(pad);
+  if (line.empty()) return;
+  for (auto it = state->pending.begin(); it != state->pending.end(); ++it) {
+    if (it->reply != line[0]) continue;
+    // The pad answers in order, so whatever was asked before this will never
+    // be answered now.
+    std::vector<Handler> lost;
+    for (auto older = state->pending.begin(); older != it; ++older) {
+      lost.push_back(older->handle);
+    }
+    Handler handle = it->handle;
+    state->pending.erase(state->pending.begin(), it + 1);
+    Arm(state);
+    for (const Handler& fail : lost) fail(nullptr);
+    if (Find(pad) == nullptr) return;
+    if (line[0] == 't' || line[0] == 'v') {
+      state->sensors = ParseNumbers(line).size();
+    }
+    handle(&line);
+    if (line[0] == 'i' && Find(pad) != nullptr) {
+      std::vector<int> numbers = ParseNumbers(line);
+      if (numbers.size() >= 2) SetMaxValue(pad, numbers[1]);
+    }
+    return;
+  }
+  if (state->in_upload && state->upload_error.empty() &&
+      IsUploadRejection(line)) {
+    state->upload_error = line;
+  }
+  if (on_message_) on_message_(pad, line);
+}
+
+void PadLink::Tick(int pad) {
+  Pad* state = Find(pad);
+  uint64_t expirations;
+  while (read(state->stream.timer_fd, &expirations, sizeof(expirations)) > 0) {
+  }
+  if (state->stream.waiting) return;
+  state->stream.waiting = true;
+  Expect(pad, 'v', [this, pad](const std::string* line) {
+    Pad* state = Find(pad);
+    if (state == nullptr || !state->stream.on_values) return;
+    // A lost reply only skips a tick.
+    state->stream.waiting = false;
+    if (line != nullptr) state->stream.on_values(ParseNumbers(*line));
+  });
+  Send(pad, "v\n");
+}
+
+}  // namespace padlink
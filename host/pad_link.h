@@ -0,0 +1,164 @@
+// Host-side client for the firmware's serial protocol, see SerialProcessor.h.
+//
+// One PadLink talks to any number of pads at once. Every port is opened
+// non-blocking and driven from a single epoll loop, Poll(), so a slow or
+// silent pad never holds up the others. Calls queue a request and return at
+// once; their callback runs from Poll() when the pad's reply comes in.
+//
+// The firmware answers requests in the order it got them, so replies are
+// matched to the oldest outstanding request expecting that reply's letter.
+// Lines that don't answer anything ("GIF incorrect size, skipping" and the
+// like) go to the message callback.
+//
+// A request the pad never answers fails as soon as a reply to a later
+// request comes in, or else once it has been the oldest outstanding one for
+// the reply timeout, so a lost line can't leave a callback waiting for ever.
+// A lost reply can only be told apart from the next one with the same
+// letter by that timeout.
+//
+// Linux only.
+
+#ifndef PAD_LINK_H_
+#define PAD_LINK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace padlink {
+
+// The values are empty if the request was invalid or timed out.
+typedef std::function<void(const std::vector<int>&)> ValuesCallback;
+// |bits| and |max| are 0 if the request timed out.
+typedef std::function<void(int bits, int max)> InfoCallback;
+// |ok| is false if the pad rejected the upload or didn't answer; |message| is
+// then the rejection line, or says that the pad went quiet.
+typedef std::function<void(bool ok, const std::string& message)>
+    UploadCallback;
+typedef std::function<void(int pad, const std::string& line)> MessageCallback;
+
+class PadLink {
+ public:
+  PadLink();
+  ~PadLink();
+
+  PadLink(const PadLink&) = delete;
+  PadLink& operator=(const PadLink&) = delete;
+
+  // Opens the serial port (or pseudo-terminal) at |path| in raw mode. Returns
+  // the pad's handle for the calls below, or -1.
+  int Open(const std::string& path);
+  void Close(int pad);
+
+  // "v": the current value of every sensor.
+  void GetValues(int pad, ValuesCallback done);
+  // "t": every sensor's threshold.
+  void GetThresholds(int pad, ValuesCallback done);
+  // "<sensor> <value>": sets one threshold, |done| gets all of them back.
+  // The firmware ignores a sensor or value out of range without answering,
+  // so those fail here instead, against the last "i" and "t" or "v" replies.
+  // An "i" goes first if the pad wasn't asked yet.
+  void SetThreshold(int pad, size_t sensor, int value, ValuesCallback done);
+  // "o": re-zeroes every sensor's offset. The pad doesn't answer.
+  void ResetOffsets(int pad);
+  // "i": the width of values and thresholds.
+  void GetInfo(int pad, InfoCallback done);
+  // "g <size>" / "a <size>" followed by the file. |done| runs once the pad
+  // has taken the whole file in and answered a request sent after it.
+  void UploadGif(int pad, const std::vector<uint8_t>& data,
+                 UploadCallback done);
+  void UploadAsset(int pad, const std::vector<uint8_t>& data,
+                   UploadCallback done);
+
+  // Asks for values every |interval_ms| and passes each reply to
+  // |on_values|. A request is only sent once the previous one was answered,
+  // so a busy pad is never flooded.
+  void StreamValues(int pad, int interval_ms, ValuesCallback on_values);
+  void StopStream(int pad);
+
+  void SetMessageCallback(MessageCallback on_message) {
+    on_message_ = on_message;
+  }
+
+  // Requests sent to |pad| that are still waiting for their reply.
+  size_t Outstanding(int pad) const;
+
+  // How long the oldest request waits for its reply before it fails. An
+  // upload gets longer, in proportion to its size.
+  void SetReplyTimeout(int timeout_ms) { reply_timeout_ms_ = timeout_ms; }
+
+  // Waits up to |timeout_ms| (-1 for ever) for I/O and runs the callbacks of
+  // everything that completed or timed out. Returns false if epoll failed.
+  bool Poll(int timeout_ms);
+  // Polls until |done| returns true or |timeout_ms| passes. Returns |done|.
+  bool RunUntil(const std::function<bool()>& done, int timeout_ms);
+
+ private:
+  // |handle| gets the reply, or nullptr if it failed. The deadline is only
+  // set once the request is the oldest, as the pad answers in order. A
+  // request the pad only answers for values up to |max_needed| fails when an
+  // "i" reply says the range is smaller.
+  typedef std::function<void(const std::string* line)> Handler;
+  struct Pending {
+    char reply;
+    Handler handle;
+    int timeout_ms;
+    int64_t deadline;
+    int max_needed;
+  };
+  struct Stream {
+    int timer_fd = -1;
+    ValuesCallback on_values;
+    bool waiting = false;
+  };
+  struct Pad {
+    int fd = -1;
+    std::string in;
+    std::string out;
+    bool want_write = false;
+    std::deque<Pending> pending;
+    // Set between the end of an upload and its barrier reply.
+    std::string upload_error;
+    bool in_upload = false;
+    // From the last "i" and "t" or "v" replies, -1 and 0 until then.
+    int max_value = -1;
+    size_t sensors = 0;
+    Stream stream;
+  };
+
+  Pad* Find(int pad);
+  const Pad* Find(int pad) const;
+  void Send(int pad, const std::string& bytes);
+  void Expect(int pad, char reply, Handler handle, int timeout_ms = 0,
+              int max_needed = -1);
+  void SetMaxValue(int pad, int max);
+  void Arm(Pad* state);
+  void Expire(int pad);
+  int NextDeadline();
+  void Upload(int pad, char command, const std::vector<uint8_t>& data,
+              UploadCallback done);
+  void Flush(int pad);
+  void UpdateEvents(int pad);
+  void Read(int pad);
+  void HandleLine(int pad, const std::string& line);
+  void Tick(int pad);
+
+  int epoll_fd_ = -1;
+  int next_pad_ = 0;
+  int reply_timeout_ms_ = 1000;
+  std::map<int, std::unique_ptr<Pad>> pads_;
+  MessageCallback on_message_;
+};
+
+// The numbers of a "v 1 2 3" or "t 1 2 3" line.
+std::vector<int> ParseNumbers(const std::string& line);
+
+}  // namespace padlink
+
+#endif  // PAD_LINK_H_
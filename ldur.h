@@ -1,2012 +0,0 @@
-const unsigned char ldur_gif[] PROGMEM = {
-  0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x00, 0x01, 0x40, 0x00, 0xe7, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x65, 0x1e, 0x36, 0x6a, 0x22, 0x32, 0x6e, 0x25,
-  0x30, 0x73, 0x28, 0x2f, 0x67, 0x2d, 0x40, 0x77, 0x2b, 0x2c, 0x79, 0x2c,
-  0x29, 0x6b, 0x30, 0x3e, 0x0b, 0x4b, 0x6b, 0x6f, 0x33, 0x3c, 0xaa, 0x25,
-  0x3e, 0x75, 0x36, 0x3a, 0x10, 0x53, 0x6d, 0x6e, 0x39, 0x49, 0x7a, 0x37,
-  0x38, 0x69, 0x3b, 0x48, 0x05, 0x5a, 0x73, 0x72, 0x3c, 0x46, 0x6e, 0x3e,
-  0x46, 0xc3, 0x23, 0x5a, 0xbe, 0x27, 0x48, 0xc5, 0x25, 0x56, 0x77, 0x40,
-  0x46, 0x28, 0x56, 0x6f, 0x23, 0x59, 0x6e, 0xc9, 0x28, 0x53, 0x7b, 0x42,
-  0x43, 0x15, 0x5e, 0x72, 0x6f, 0x47, 0x57, 0xc6, 0x2e, 0x43, 0x0f, 0x63,
-  0x77, 0xcc, 0x2c, 0x51, 0x73, 0x4a, 0x55, 0xd7, 0x2c, 0x4b, 0xca, 0x31,
-  0x40, 0x20, 0x62, 0x76, 0xd0, 0x2f, 0x4e, 0xd9, 0x2e, 0x4d, 0x30, 0x60,
-  0x70, 0xcd, 0x34, 0x3d, 0xd2, 0x31, 0x4f, 0xdb, 0x2f, 0x48, 0x78, 0x4d,
-  0x52, 0xd4, 0x34, 0x3a, 0xdc, 0x31, 0x49, 0xd8, 0x34, 0x37, 0xc8, 0x35,
-  0x66, 0x20, 0x68, 0x76, 0xde, 0x32, 0x4a, 0x7c, 0x50, 0x50, 0xdf, 0x33,
-  0x45, 0xd6, 0x36, 0x52, 0xd3, 0x37, 0x56, 0xe1, 0x35, 0x47, 0x3d, 0x64,
-  0x76, 0xd8, 0x38, 0x4e, 0x2f, 0x69, 0x78, 0x74, 0x56, 0x5d, 0xe2, 0x36,
-  0x47, 0x42, 0x65, 0x72, 0xe4, 0x38, 0x43, 0xcb, 0x3d, 0x65, 0x2e, 0x6d,
-  0x76, 0xd2, 0x3d, 0x5d, 0xda, 0x3b, 0x5b, 0xe5, 0x3a, 0x4a, 0xdd, 0x3c,
-  0x51, 0xc9, 0x40, 0x70, 0xe7, 0x3b, 0x40, 0xca, 0x41, 0x6b, 0xdd, 0x3d,
-  0x57, 0x7b, 0x5c, 0x5d, 0x4e, 0x68, 0x77, 0x41, 0x6c, 0x78, 0xeb, 0x3e,
-  0x3d, 0xea, 0x3e, 0x42, 0xe1, 0x40, 0x4f, 0xea, 0x3e, 0x47, 0xd8, 0x42,
-  0x5c, 0x4a, 0x6c, 0x77, 0xcf, 0x44, 0x69, 0x3d, 0x71, 0x7c, 0xd9, 0x43,
-  0x62, 0xed, 0x40, 0x44, 0x73, 0x64, 0x6b, 0xd3, 0x47, 0x67, 0xee, 0x44,
-  0x45, 0xcd, 0x4b, 0x70, 0x7d, 0x65, 0x69, 0x52, 0x71, 0x79, 0x13, 0x80,
-  0xb0, 0xdf, 0x48, 0x5c, 0xde, 0x48, 0x61, 0x78, 0x67, 0x69, 0x4d, 0x74,
-  0x7b, 0xd8, 0x4b, 0x64, 0x5f, 0x6f, 0x7a, 0xce, 0x4d, 0x77, 0xea, 0x48,
-  0x50, 0x5a, 0x72, 0x7b, 0x80, 0x69, 0x67, 0xdc, 0x4e, 0x62, 0xee, 0x4b,
-  0x4d, 0xe6, 0x4e, 0x5b, 0x00, 0x8c, 0xd3, 0xda, 0x51, 0x6e, 0x61, 0x76,
-  0x7a, 0xe5, 0x50, 0x61, 0x00, 0x8f, 0xc3, 0xe9, 0x50, 0x58, 0x7a, 0x71,
-  0x77, 0xe2, 0x54, 0x67, 0x72, 0x76, 0x79, 0x00, 0x92, 0xd4, 0x12, 0x8d,
-  0xcf, 0x7f, 0x73, 0x74, 0xee, 0x54, 0x56, 0xdf, 0x57, 0x6c, 0x6e, 0x79,
-  0x7a, 0x00, 0x96, 0xca, 0xdd, 0x59, 0x72, 0xd2, 0x5b, 0x84, 0xd4, 0x5b,
-  0x80, 0x00, 0x96, 0xd7, 0xe7, 0x58, 0x65, 0x6e, 0x7c, 0x82, 0x71, 0x7c,
-  0x7d, 0x00, 0x98, 0xd9, 0xeb, 0x5a, 0x61, 0x00, 0x9b, 0xd6, 0xda, 0x5f,
-  0x7f, 0x0c, 0x9a, 0xc8, 0xdd, 0x60, 0x7b, 0xef, 0x5d, 0x5f, 0x7d, 0x7f,
-  0x7c, 0xf1, 0x5e, 0x5a, 0xe6, 0x60, 0x6d, 0x00, 0xa0, 0xcd, 0x07, 0x9d,
-  0xd8, 0xe1, 0x63, 0x78, 0x80, 0x82, 0x7f, 0xec, 0x63, 0x6b, 0x00, 0xa3,
-  0xdd, 0xe5, 0x65, 0x75, 0x10, 0x9f, 0xda, 0x25, 0x99, 0xd5, 0x00, 0xa4,
-  0xdf, 0xdd, 0x68, 0x7e, 0xef, 0x65, 0x67, 0x00, 0xa7, 0xce, 0xe1, 0x6a,
-  0x7b, 0x00, 0xa8, 0xdb, 0xeb, 0x69, 0x73, 0x00, 0xaa, 0xd1, 0x00, 0xaa,
-  0xdd, 0x00, 0xab, 0xdf, 0x00, 0xad, 0xe1, 0xef, 0x6d, 0x71, 0x1a, 0xa7,
-  0xdb, 0x00, 0xaf, 0xe3, 0xf2, 0x6f, 0x6d, 0x2e, 0xa3, 0xd9, 0xd0, 0x78,
-  0x8c, 0xe4, 0x73, 0x80, 0xd2, 0x79, 0x88, 0x00, 0xb3, 0xe0, 0xda, 0x76,
-  0x95, 0x00, 0xb3, 0xe5, 0x21, 0xaa, 0xde, 0x00, 0xb5, 0xe2, 0xde, 0x78,
-  0x92, 0xd7, 0x7c, 0x86, 0x37, 0xa8, 0xdf, 0xe2, 0x7b, 0x8f, 0x0d, 0xb7,
-  0xe4, 0xdc, 0x7f, 0x83, 0x00, 0xbb, 0xe7, 0x24, 0xb1, 0xdf, 0xe7, 0x7d,
-  0x8d, 0x00, 0xbd, 0xe9, 0x15, 0xb9, 0xe6, 0x39, 0xaf, 0xde, 0x46, 0xac,
-  0xdc, 0x2b, 0xb4, 0xe2, 0xeb, 0x80, 0x8a, 0x1c, 0xbc, 0xe9, 0xef, 0x83,
-  0x87, 0x31, 0xb7, 0xe6, 0x3f, 0xb3, 0xe2, 0xf3, 0x85, 0x84, 0x1a, 0xc1,
-  0xe7, 0x4b, 0xb5, 0xdf, 0x3f, 0xb9, 0xe2, 0x62, 0xb2, 0xd2, 0x34, 0xbf,
-  0xe6, 0x43, 0xbb, 0xe4, 0x22, 0xc5, 0xeb, 0xe9, 0x8e, 0x9c, 0x59, 0xb6,
-  0xe1, 0x5b, 0xb7, 0xd5, 0xe1, 0x91, 0xae, 0xe5, 0x93, 0xaa, 0x5d, 0xb9,
-  0xe4, 0x3c, 0xc3, 0xeb, 0x5f, 0xba, 0xd9, 0xe9, 0x96, 0xa7, 0x66, 0xbc,
-  0xd5, 0x3a, 0xc8, 0xe9, 0x48, 0xc5, 0xe7, 0xed, 0x98, 0xa4, 0x5f, 0xc0,
-  0xe5, 0x60, 0xc1, 0xd8, 0x57, 0xc5, 0xe8, 0x40, 0xcc, 0xed, 0xf2, 0x9c,
-  0xa2, 0xf6, 0x9e, 0x9f, 0x5c, 0xc8, 0xec, 0x5d, 0xcf, 0xec, 0x81, 0xc6,
-  0xe8, 0xe8, 0xac, 0xc1, 0x55, 0xd6, 0xf1, 0x7d, 0xcc, 0xed, 0xec, 0xae,
-  0xbe, 0x7e, 0xce, 0xef, 0xf0, 0xb0, 0xba, 0x84, 0xcf, 0xea, 0x7f, 0xd3,
-  0xed, 0xf5, 0xb3, 0xb8, 0xf9, 0xb6, 0xb4, 0x7d, 0xdc, 0xf4, 0xa0, 0xd3,
-  0xec, 0x9d, 0xda, 0xf1, 0x99, 0xe0, 0xf5, 0xf0, 0xc9, 0xd8, 0xf3, 0xc9,
-  0xd2, 0xf5, 0xcb, 0xd4, 0xa0, 0xe3, 0xf2, 0xf6, 0xcc, 0xd5, 0x9b, 0xe7,
-  0xf5, 0xf9, 0xcd, 0xd0, 0xf3, 0xd0, 0xd7, 0xfb, 0xcf, 0xd1, 0xbe, 0xe3,
-  0xf2, 0xc0, 0xe5, 0xf4, 0xc1, 0xe6, 0xf5, 0xbc, 0xe9, 0xf7, 0xb6, 0xec,
-  0xf9, 0xbe, 0xeb, 0xf8, 0xbf, 0xec, 0xfa, 0xf6, 0xe4, 0xed, 0xfa, 0xe6,
-  0xe9, 0xe3, 0xf2, 0xf9, 0xdf, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x21, 0xff, 0x0b, 0x4e, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45,
-  0x32, 0x2e, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x21, 0xfe, 0x11, 0x43,
-  0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-  0x47, 0x49, 0x4d, 0x50, 0x00, 0x21, 0xf9, 0x04, 0x01, 0x14, 0x00, 0xff,
-  0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x08,
-  0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13,
-  0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x4a, 0x9c, 0x48,
-  0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3, 0xc7,
-  0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28, 0x53,
-  0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0xc5, 0x46, 0xfe, 0x62, 0xca, 0x3c, 0xe4,
-  0x12, 0xe1, 0x21, 0x99, 0xfe, 0x68, 0xd6, 0x64, 0xd8, 0xa8, 0xd1, 0x4e,
-  0x9b, 0x38, 0x63, 0xfa, 0xfc, 0xb9, 0x10, 0x66, 0xd0, 0x98, 0x3a, 0x89,
-  0xde, 0x0c, 0x9a, 0x94, 0x68, 0x41, 0xa3, 0x43, 0x9d, 0x02, 0x58, 0x7a,
-  0x34, 0xaa, 0x54, 0x82, 0x46, 0x89, 0x3d, 0x7a, 0x14, 0x69, 0x51, 0x30,
-  0xa4, 0x4a, 0x63, 0xea, 0xa1, 0x40, 0x41, 0x0f, 0xd8, 0xab, 0x02, 0x8d,
-  0x0a, 0x95, 0xba, 0x34, 0xd8, 0xa2, 0x48, 0x5b, 0x89, 0xad, 0x45, 0x9b,
-  0x36, 0xa6, 0xd6, 0xad, 0x5d, 0x05, 0xf5, 0x3a, 0xeb, 0x72, 0xe9, 0x58,
-  0xb2, 0x65, 0xf9, 0x3a, 0x35, 0x1a, 0x2a, 0xd4, 0xdc, 0x9d, 0x4b, 0x7b,
-  0x09, 0x7a, 0xbb, 0xf5, 0x91, 0x5c, 0x7f, 0x56, 0x07, 0xdb, 0x6d, 0xcc,
-  0x75, 0x91, 0x20, 0x41, 0xc0, 0x62, 0xd6, 0xf4, 0x0b, 0x18, 0xb0, 0xd9,
-  0x9c, 0x52, 0x8d, 0x7a, 0x5a, 0xb2, 0xc4, 0xd3, 0x61, 0x97, 0x31, 0x81,
-  0x5d, 0x66, 0xdc, 0xf8, 0x71, 0xe4, 0x9d, 0x46, 0x87, 0x4d, 0xa2, 0x9c,
-  0xf7, 0xb2, 0xe6, 0x96, 0x4b, 0xf7, 0x74, 0xee, 0xbc, 0x47, 0xb0, 0x4b,
-  0xd1, 0xa4, 0x49, 0x9b, 0x86, 0xbc, 0x33, 0xe6, 0xe5, 0xc5, 0x70, 0x1b,
-  0x4f, 0x1a, 0x76, 0xba, 0x66, 0xec, 0x4f, 0xb3, 0x1b, 0xd7, 0x16, 0x74,
-  0x9b, 0x65, 0xcc, 0x3d, 0x16, 0xb2, 0x6b, 0xdf, 0xde, 0xdb, 0xdf, 0x4f,
-  0xe0, 0xc1, 0x85, 0xfe, 0x37, 0x57, 0x69, 0x7c, 0x75, 0xf2, 0xad, 0x93,
-  0x3e, 0x31, 0x27, 0x0e, 0x3b, 0xe6, 0x30, 0x4c, 0xd0, 0x69, 0x5b, 0xb6,
-  0xed, 0xbd, 0x65, 0xcc, 0xed, 0xf8, 0xb5, 0x57, 0x6f, 0x29, 0x9a, 0x89,
-  0xff, 0xff, 0xfe, 0x0d, 0xf7, 0x1a, 0x4a, 0xe5, 0x21, 0x47, 0x59, 0x7a,
-  0x98, 0xac, 0x37, 0x20, 0x4a, 0xb1, 0x6d, 0x02, 0x5f, 0x74, 0x78, 0xcd,
-  0x47, 0x5d, 0x7d, 0xd6, 0xf9, 0x93, 0x5f, 0x7e, 0xfb, 0xad, 0xd4, 0x1f,
-  0x80, 0x1c, 0x0a, 0x68, 0x9f, 0x3f, 0xc7, 0xb1, 0x86, 0xde, 0x27, 0x98,
-  0x6c, 0xa2, 0x20, 0x7f, 0x31, 0x31, 0xb3, 0x89, 0x83, 0xf1, 0x49, 0x37,
-  0x5f, 0x66, 0x14, 0xae, 0x74, 0xdf, 0x85, 0xdb, 0x65, 0x98, 0x92, 0x68,
-  0x45, 0xe4, 0xa8, 0xe3, 0x8e, 0x39, 0x7a, 0x28, 0xa3, 0x3f, 0xaa, 0x19,
-  0xa8, 0x1c, 0x89, 0x2b, 0x32, 0x33, 0x5e, 0x49, 0x46, 0xa9, 0xb8, 0xe2,
-  0x83, 0xf2, 0xe9, 0xe5, 0x5b, 0x4a, 0x33, 0xd2, 0x98, 0x9d, 0x8d, 0x27,
-  0xe1, 0xc8, 0xe3, 0x95, 0x3d, 0x1e, 0x49, 0x52, 0x62, 0x42, 0x8e, 0x58,
-  0x62, 0x91, 0x5a, 0x86, 0x94, 0x64, 0x27, 0x2b, 0xb2, 0x08, 0x61, 0x65,
-  0x5f, 0x81, 0x86, 0x9a, 0x3f, 0x1a, 0xb4, 0xe9, 0xe6, 0x9b, 0x6d, 0x52,
-  0x89, 0x64, 0x4c, 0x9e, 0x60, 0x69, 0x67, 0x11, 0x3e, 0xa6, 0xd4, 0x96,
-  0x88, 0x8f, 0x20, 0x58, 0x66, 0x27, 0x46, 0xb2, 0x37, 0xa7, 0x3f, 0xd1,
-  0x74, 0x42, 0xe6, 0x92, 0x2d, 0xe2, 0x95, 0x66, 0x53, 0x15, 0xc2, 0xe9,
-  0xa8, 0x06, 0x72, 0x8e, 0x64, 0xe5, 0x9d, 0x58, 0xe6, 0x89, 0x52, 0x5b,
-  0xe7, 0xf5, 0x49, 0xe4, 0x8a, 0x86, 0x46, 0x13, 0x26, 0x47, 0x63, 0x1a,
-  0x5a, 0x26, 0x93, 0x8d, 0x2d, 0xfa, 0x53, 0x4c, 0x8f, 0xc2, 0x19, 0xa9,
-  0x98, 0x31, 0x65, 0xd2, 0xc3, 0xab, 0xfe, 0xb0, 0xc6, 0x2a, 0xab, 0xac,
-  0x99, 0x7c, 0x1a, 0x52, 0x5b, 0x07, 0x6e, 0xba, 0x89, 0xa1, 0x80, 0xda,
-  0x8a, 0x91, 0x51, 0x85, 0xf2, 0x3a, 0x6a, 0xa2, 0xa6, 0x9e, 0xca, 0x66,
-  0xaa, 0x6e, 0xae, 0xfa, 0x91, 0x51, 0xae, 0xce, 0xea, 0xec, 0xb3, 0xb5,
-  0x0a, 0x7a, 0x69, 0x4c, 0xc1, 0x0c, 0xf9, 0xe5, 0xae, 0xbc, 0x7a, 0x2a,
-  0x6d, 0x47, 0x49, 0xa2, 0xc2, 0xeb, 0xa1, 0x66, 0xc6, 0xf5, 0xe4, 0x87,
-  0xc8, 0x26, 0x1b, 0x23, 0x49, 0xcc, 0x3e, 0xab, 0xae, 0xb3, 0xd1, 0x2e,
-  0x38, 0xd2, 0x52, 0x77, 0xf9, 0xc9, 0x29, 0xaf, 0xa8, 0x04, 0xea, 0xae,
-  0x45, 0xc0, 0xa2, 0xe2, 0xad, 0xb0, 0x88, 0xce, 0xf6, 0x18, 0xa3, 0x35,
-  0xc5, 0x04, 0xc2, 0xc0, 0x04, 0x17, 0x3c, 0xb0, 0xb2, 0xa0, 0xb6, 0xba,
-  0xee, 0xc2, 0xb4, 0xfa, 0xfa, 0x11, 0xbc, 0x9a, 0x5e, 0xfb, 0xad, 0xbe,
-  0xda, 0xde, 0x3b, 0x11, 0xb0, 0xa6, 0xe8, 0xfb, 0xed, 0xb0, 0x93, 0xfc,
-  0x7b, 0x95, 0xc0, 0x06, 0x87, 0x8c, 0xb0, 0x46, 0xe9, 0x32, 0x6c, 0xf2,
-  0xab, 0xed, 0xae, 0x04, 0xaf, 0xbc, 0xd8, 0x1a, 0xaa, 0xaf, 0x29, 0x15,
-  0x6f, 0x64, 0x14, 0x34, 0xa6, 0x64, 0xbc, 0xaf, 0xa8, 0x88, 0x7a, 0xbc,
-  0xe5, 0x51, 0x00, 0x0f, 0x04, 0x72, 0xc8, 0x05, 0x47, 0x4a, 0xd5, 0x4c,
-  0x2f, 0xb5, 0xba, 0xc3, 0xd1, 0x48, 0x27, 0xad, 0xf4, 0xd2, 0x4c, 0x1f,
-  0x9d, 0xb2, 0x4a, 0xf0, 0xea, 0x3a, 0x31, 0x2a, 0x35, 0x43, 0xe3, 0x30,
-  0x4f, 0x31, 0x41, 0xa3, 0x4a, 0xcd, 0x1a, 0xf3, 0xcb, 0xe2, 0x38, 0x6a,
-  0xbe, 0x7b, 0xd4, 0xb8, 0x00, 0xfc, 0x0c, 0xf4, 0xc1, 0xe7, 0x0e, 0x34,
-  0x34, 0x4e, 0x3d, 0x17, 0xd5, 0xaa, 0x0d, 0x70, 0xc7, 0x2d, 0xf7, 0xdc,
-  0x74, 0xd7, 0x2d, 0xf7, 0xd3, 0x7a, 0xfa, 0x33, 0x8e, 0xfe, 0xd4, 0xf4,
-  0x52, 0x6d, 0x8a, 0x2a, 0x56, 0x6f, 0x2b, 0x91, 0x51, 0xd6, 0xa8, 0xb2,
-  0xb5, 0xcd, 0x1b, 0xe7, 0x3c, 0xf6, 0xe2, 0x8b, 0xb7, 0x6d, 0xd0, 0x52,
-  0x94, 0x94, 0x20, 0x79, 0x09, 0x94, 0x8c, 0x1b, 0xd3, 0xe4, 0x98, 0x67,
-  0x4e, 0x25, 0xe4, 0x98, 0x57, 0x1e, 0x76, 0x43, 0x46, 0x41, 0x62, 0xf7,
-  0xe8, 0xa4, 0xd7, 0x0d, 0xc9, 0xd5, 0x8f, 0x33, 0xae, 0x3a, 0x4e, 0xc4,
-  0xf0, 0xed, 0xb2, 0xdf, 0x86, 0x5b, 0x83, 0xba, 0x41, 0x84, 0xbf, 0x62,
-  0x38, 0xd7, 0x37, 0x83, 0xfb, 0x20, 0x31, 0xf5, 0xac, 0xbe, 0xba, 0xe3,
-  0x6a, 0xc7, 0x14, 0x79, 0xe6, 0x9e, 0x03, 0x7c, 0x79, 0xe6, 0xc8, 0xdb,
-  0xc8, 0x39, 0xf1, 0x64, 0xd3, 0x1e, 0x13, 0x24, 0x33, 0x44, 0x2f, 0xfd,
-  0xf4, 0xd4, 0x57, 0x6f, 0xfd, 0xf5, 0xa7, 0x0b, 0xce, 0xd0, 0xda, 0xbe,
-  0x07, 0x55, 0x0f, 0x31, 0x2c, 0x4f, 0x5d, 0xb3, 0xe1, 0xaf, 0xc8, 0xae,
-  0x3d, 0xd6, 0xfe, 0x58, 0xf3, 0x8a, 0xed, 0x87, 0x77, 0x8d, 0x73, 0xb8,
-  0x2e, 0x1e, 0x27, 0x08, 0x20, 0x80, 0xf0, 0xc1, 0x87, 0x1c, 0xf8, 0xe3,
-  0x3f, 0xc7, 0xfe, 0xb7, 0x34, 0x2f, 0x90, 0xf0, 0xc8, 0x93, 0x5c, 0xf1,
-  0x0a, 0x72, 0xbc, 0x00, 0x4e, 0x2e, 0x43, 0xcb, 0x43, 0x9e, 0xe7, 0x40,
-  0xf7, 0xbc, 0xeb, 0x39, 0xf0, 0x81, 0x10, 0xcc, 0x9e, 0xc5, 0x0a, 0xb2,
-  0x94, 0x5b, 0xec, 0x6f, 0x0e, 0xf9, 0xc3, 0x9f, 0xfd, 0xe8, 0x27, 0x3f,
-  0x3e, 0x85, 0xaf, 0x6f, 0xe3, 0x53, 0xc5, 0xfa, 0xcc, 0x37, 0xc1, 0xa7,
-  0xc4, 0x44, 0x7d, 0xeb, 0xbb, 0x1d, 0xe2, 0xbc, 0x46, 0xaa, 0x08, 0xc9,
-  0x8f, 0x7e, 0xf6, 0xcb, 0xa0, 0x1c, 0x2e, 0x38, 0x87, 0xfe, 0x7d, 0xce,
-  0x20, 0x31, 0x49, 0x81, 0x0e, 0x77, 0xc8, 0xc3, 0x01, 0xfa, 0xcc, 0x1f,
-  0xfe, 0x3c, 0x0c, 0xe2, 0x0e, 0xf7, 0x03, 0x39, 0x21, 0xf2, 0x10, 0x61,
-  0xa1, 0x6b, 0x81, 0x12, 0x97, 0xc8, 0xc4, 0x26, 0x3a, 0xf1, 0x89, 0x50,
-  0x64, 0xa2, 0x04, 0x1d, 0x52, 0x41, 0x1a, 0xca, 0x70, 0x83, 0x80, 0xe8,
-  0x60, 0xa6, 0x3e, 0xf8, 0xba, 0x10, 0xae, 0xaf, 0x7c, 0xa8, 0x23, 0x5c,
-  0x2c, 0xbe, 0xa8, 0x42, 0xf7, 0xe9, 0x2e, 0x51, 0x95, 0x79, 0x61, 0xfd,
-  0xee, 0x97, 0x41, 0x1a, 0xd6, 0xb0, 0x79, 0x39, 0x34, 0xe2, 0x0e, 0x7d,
-  0x58, 0x36, 0x20, 0xca, 0x71, 0x88, 0x14, 0x2a, 0xe2, 0x1d, 0x53, 0xa0,
-  0xac, 0x24, 0x46, 0xf1, 0x8f, 0x80, 0x04, 0xe4, 0x14, 0x17, 0x52, 0x45,
-  0x2b, 0x66, 0x10, 0x8b, 0x5a, 0xcc, 0x95, 0xc4, 0x40, 0xf8, 0x37, 0x11,
-  0xae, 0x2f, 0x16, 0x24, 0x64, 0x60, 0xfa, 0x62, 0x31, 0xc6, 0x14, 0xb6,
-  0x2f, 0x77, 0x1c, 0x6b, 0xd2, 0x71, 0x60, 0xc8, 0xc6, 0xfc, 0xb9, 0x31,
-  0x0d, 0x36, 0x6c, 0x5b, 0x4c, 0x44, 0x40, 0xca, 0x52, 0x9a, 0x92, 0x94,
-  0x3e, 0x1c, 0xe5, 0x29, 0x57, 0x79, 0x1b, 0xc8, 0xad, 0x92, 0x95, 0x69,
-  0xc3, 0x4a, 0x4c, 0x18, 0x11, 0xc8, 0x5a, 0xda, 0xb2, 0x89, 0x8c, 0xf8,
-  0x54, 0x05, 0xd3, 0xe0, 0xc6, 0x2b, 0xf2, 0x81, 0x83, 0x21, 0xda, 0xa2,
-  0xeb, 0x3a, 0xf1, 0xb2, 0x46, 0x7e, 0x91, 0x92, 0x91, 0x54, 0x88, 0x18,
-  0x29, 0x49, 0xc6, 0x4b, 0x26, 0x0e, 0x7e, 0x2e, 0xdc, 0xe4, 0x1a, 0x65,
-  0xf8, 0x49, 0x50, 0xca, 0x49, 0x95, 0xaf, 0x34, 0xe5, 0x25, 0xc0, 0x82,
-  0xcd, 0x6c, 0x8a, 0x40, 0x33, 0x4b, 0xb9, 0x84, 0x37, 0x4d, 0x19, 0x29,
-  0xa3, 0xd0, 0x32, 0x90, 0x97, 0x90, 0xc6, 0x25, 0x6c, 0x99, 0xce, 0x75,
-  0x06, 0x32, 0x97, 0xe7, 0xab, 0xe3, 0x2d, 0xd2, 0xc0, 0x4b, 0x43, 0xe6,
-  0x0f, 0x91, 0xc1, 0xfe, 0x54, 0xe4, 0x9f, 0x18, 0x49, 0xbe, 0x47, 0x22,
-  0x33, 0x4c, 0xcb, 0x64, 0xa6, 0x25, 0x71, 0xf7, 0xcc, 0x16, 0xa6, 0x51,
-  0x9a, 0x31, 0x6c, 0x23, 0x0d, 0xe9, 0x99, 0x86, 0x6b, 0xfa, 0x83, 0x11,
-  0xe3, 0x2c, 0xe5, 0x36, 0x73, 0xe2, 0x8f, 0x78, 0x44, 0x54, 0x04, 0xf1,
-  0xa0, 0xa8, 0x3f, 0xc4, 0x79, 0x51, 0x78, 0x22, 0xc4, 0x9c, 0x26, 0x08,
-  0xa9, 0x48, 0x47, 0x2a, 0xd2, 0x89, 0x6e, 0x94, 0xa4, 0x28, 0x35, 0x81,
-  0x49, 0x2f, 0x91, 0x52, 0x94, 0xc2, 0x73, 0x41, 0x31, 0x61, 0x68, 0x2f,
-  0x0f, 0xf9, 0xcb, 0x2c, 0xe6, 0xd3, 0x5a, 0xfb, 0xec, 0xa2, 0x31, 0xfd,
-  0xf9, 0xcf, 0xf3, 0x05, 0xb4, 0x92, 0xec, 0x23, 0x28, 0x0b, 0xd1, 0x38,
-  0x9d, 0xf9, 0x4d, 0x53, 0xa1, 0x17, 0x64, 0xa8, 0x9c, 0x40, 0xda, 0xd2,
-  0x91, 0xae, 0xb4, 0xa9, 0x25, 0x95, 0x09, 0x4b, 0xa1, 0x1a, 0xd2, 0x97,
-  0x22, 0x64, 0x96, 0x17, 0x15, 0xc1, 0x44, 0x6f, 0x62, 0xd1, 0x88, 0x66,
-  0x34, 0x9c, 0x59, 0xf5, 0xe8, 0x41, 0x62, 0x4a, 0xcf, 0x99, 0xde, 0xb3,
-  0xa6, 0x89, 0xc4, 0xe9, 0xbc, 0x74, 0xda, 0xcf, 0x57, 0x50, 0xb2, 0xa7,
-  0xee, 0x0a, 0x68, 0x33, 0x85, 0xfa, 0x3e, 0x83, 0x16, 0x95, 0x93, 0xd4,
-  0x5c, 0xa8, 0x35, 0x63, 0x59, 0x97, 0x87, 0xd6, 0xb2, 0x9d, 0xec, 0x54,
-  0x67, 0x2d, 0xad, 0x7a, 0x55, 0x7f, 0x64, 0x75, 0xab, 0x75, 0xbc, 0x28,
-  0x38, 0x63, 0xc2, 0xd1, 0x88, 0x3a, 0x74, 0x9e, 0xf5, 0xbc, 0xa0, 0x2f,
-  0x81, 0x69, 0x1e, 0x7d, 0xae, 0x95, 0x98, 0xb0, 0x73, 0xa4, 0x5b, 0xe1,
-  0xea, 0xb6, 0x49, 0x02, 0xb5, 0x8c, 0x98, 0xec, 0x97, 0x26, 0x2f, 0x83,
-  0x57, 0xa4, 0xee, 0x6f, 0xaf, 0xc0, 0x33, 0xe7, 0x2d, 0x57, 0x3b, 0xd8,
-  0x4f, 0x75, 0x33, 0x9b, 0xa9, 0x34, 0xfe, 0xac, 0x63, 0xeb, 0xe3, 0xca,
-  0xd9, 0x02, 0xc5, 0x1f, 0xf3, 0x34, 0xab, 0x06, 0xd1, 0x7a, 0x53, 0x2f,
-  0xe5, 0x14, 0xb3, 0x5e, 0xf4, 0x67, 0x32, 0x3b, 0x6b, 0x8d, 0xcf, 0x3a,
-  0x73, 0xa8, 0x67, 0xba, 0xeb, 0x51, 0x3d, 0x49, 0xc3, 0x50, 0xa2, 0x0f,
-  0x12, 0xac, 0x8d, 0xee, 0x13, 0x07, 0x99, 0x90, 0x38, 0xde, 0x91, 0x8e,
-  0xd6, 0xbd, 0x63, 0x75, 0xf4, 0xa8, 0x5d, 0xbe, 0x4e, 0x25, 0x26, 0x16,
-  0xb4, 0xe7, 0x6e, 0x29, 0xdb, 0xa5, 0x88, 0xfd, 0xb6, 0x98, 0x6d, 0x85,
-  0x64, 0x18, 0x4f, 0x38, 0xd7, 0x15, 0xd6, 0x95, 0xa8, 0x12, 0x32, 0x6a,
-  0x42, 0x99, 0xcb, 0x3f, 0xff, 0xc9, 0xd2, 0x1f, 0xd0, 0x95, 0xae, 0x7e,
-  0xa9, 0x5b, 0x5d, 0x3b, 0xca, 0x91, 0x8e, 0x75, 0xdc, 0xa3, 0x0e, 0x89,
-  0x28, 0xbc, 0x3d, 0xae, 0xaa, 0x90, 0xfb, 0x9b, 0xac, 0x4d, 0x2b, 0xab,
-  0xd6, 0x96, 0x01, 0x77, 0xa7, 0x60, 0x8c, 0xe7, 0x47, 0xd9, 0x1b, 0x54,
-  0xf7, 0x9e, 0x31, 0xb9, 0xf1, 0x2d, 0x2d, 0x7d, 0x9d, 0xfb, 0x90, 0xd0,
-  0x41, 0xf0, 0xc3, 0x20, 0x8e, 0x1e, 0x7f, 0xfb, 0x3b, 0x3c, 0x05, 0xfa,
-  0xa6, 0x80, 0x06, 0x2c, 0x01, 0x02, 0x01, 0x18, 0xc0, 0x05, 0x2a, 0x04,
-  0xc1, 0x0a, 0x4e, 0xab, 0x6f, 0x2f, 0x8b, 0x5e, 0x47, 0x0e, 0x17, 0x22,
-  0xb5, 0x03, 0x6d, 0x41, 0xa1, 0xc3, 0xbb, 0xee, 0x31, 0x0e, 0x78, 0x13,
-  0xc6, 0x6f, 0x88, 0x87, 0x6c, 0xbd, 0x11, 0x27, 0x24, 0x81, 0x93, 0x03,
-  0xf0, 0xff, 0xfc, 0x91, 0xe2, 0x03, 0xa6, 0x0d, 0xc9, 0x02, 0xb4, 0xef,
-  0x77, 0x7d, 0x3c, 0xb6, 0xef, 0x71, 0xf1, 0xc1, 0xe4, 0xbb, 0x71, 0x44,
-  0x08, 0xa7, 0xe3, 0xa1, 0x3e, 0x86, 0xca, 0x3c, 0x2b, 0x1a, 0x7e, 0x4b,
-  0x47, 0xe6, 0xd2, 0x19, 0xf9, 0xc5, 0x2c, 0x8e, 0xf2, 0xfe, 0x0d, 0x97,
-  0xdc, 0x64, 0xc9, 0x6d, 0x2e, 0xcd, 0x94, 0x93, 0xb2, 0x40, 0xb8, 0x07,
-  0x66, 0x7f, 0xb4, 0x6e, 0x91, 0x6c, 0x55, 0x85, 0x96, 0x07, 0x97, 0xb5,
-  0xe3, 0xbe, 0x17, 0x6c, 0x40, 0x06, 0x09, 0xb3, 0xca, 0x4c, 0xe8, 0xb9,
-  0xe1, 0xed, 0x21, 0x74, 0x5e, 0xf3, 0x92, 0xcf, 0x16, 0x34, 0xbe, 0x26,
-  0x3a, 0xd0, 0x19, 0xb9, 0xc9, 0xde, 0xf0, 0x8c, 0xe5, 0xc0, 0x95, 0x10,
-  0x7d, 0x34, 0xb3, 0xf0, 0xb0, 0x74, 0x76, 0x23, 0xa3, 0x35, 0xed, 0xd3,
-  0xa0, 0x76, 0xda, 0xec, 0x08, 0xc2, 0x3d, 0xc7, 0x99, 0xed, 0x6c, 0x42,
-  0x0b, 0xf3, 0xce, 0xec, 0x3c, 0xcc, 0x62, 0x5a, 0x5a, 0x66, 0x31, 0x89,
-  0x86, 0xa6, 0xfb, 0xc5, 0x69, 0x06, 0x29, 0xec, 0x64, 0x26, 0x3b, 0xb4,
-  0x48, 0x4e, 0x0d, 0xb4, 0x91, 0x4d, 0xcb, 0xce, 0x57, 0x7e, 0x59, 0xcc,
-  0x12, 0x46, 0x28, 0x33, 0x66, 0xb2, 0xd6, 0x55, 0xba, 0x35, 0xae, 0xd5,
-  0xa5, 0xeb, 0x5d, 0xfb, 0x83, 0xd1, 0x04, 0xf3, 0xb5, 0x49, 0x20, 0x16,
-  0x6c, 0x54, 0x0c, 0x9b, 0x5b, 0x29, 0x0a, 0x2d, 0xfc, 0x90, 0x6d, 0x92,
-  0x92, 0x2d, 0x7b, 0x56, 0xcd, 0x76, 0x76, 0xb9, 0xe2, 0xe4, 0x5d, 0xa8,
-  0x4d, 0xc6, 0xbc, 0x34, 0xb6, 0x17, 0xab, 0x08, 0xb5, 0x63, 0x08, 0x15,
-  0xab, 0xd3, 0xfe, 0x68, 0xd6, 0xb7, 0x61, 0x15, 0x6e, 0x71, 0x8f, 0x5b,
-  0xda, 0x62, 0xf3, 0x47, 0xb5, 0x66, 0xec, 0xe0, 0x6b, 0x0b, 0x3a, 0x45,
-  0xc8, 0xa5, 0xcc, 0xbb, 0x6d, 0x1d, 0xef, 0x79, 0xa3, 0x6c, 0xd4, 0x19,
-  0x41, 0xd5, 0xbd, 0xcb, 0x7d, 0x12, 0x5c, 0x35, 0x98, 0x57, 0xea, 0x46,
-  0x57, 0xac, 0xdf, 0x9b, 0xdc, 0x81, 0x27, 0xdb, 0x1f, 0x75, 0xa2, 0x54,
-  0xa5, 0x10, 0x9e, 0xf0, 0x63, 0x95, 0x0b, 0xdf, 0x20, 0xc1, 0x94, 0x65,
-  0xfe, 0xb1, 0xe5, 0x6f, 0x49, 0x01, 0x3c, 0x93, 0x2e, 0xb2, 0x78, 0xb7,
-  0xe9, 0xa4, 0x71, 0x1e, 0x59, 0x8a, 0x40, 0x1e, 0x47, 0x16, 0xc8, 0x3d,
-  0xb2, 0x27, 0x61, 0x4a, 0x2c, 0xe2, 0x17, 0x57, 0x12, 0x34, 0xd3, 0xb8,
-  0x17, 0x45, 0x4b, 0x1c, 0xe3, 0x2d, 0xcf, 0x92, 0x84, 0x47, 0x12, 0x25,
-  0x29, 0xcd, 0x9c, 0x23, 0x5c, 0xf2, 0xa0, 0xae, 0x70, 0x4e, 0x70, 0x25,
-  0xd9, 0xf5, 0x45, 0x47, 0xcf, 0xc8, 0xa4, 0xee, 0xf4, 0x72, 0x28, 0x59,
-  0x48, 0x4a, 0x53, 0x62, 0x38, 0xd1, 0x81, 0xc4, 0xe0, 0x19, 0x33, 0x1d,
-  0xde, 0xc3, 0xd8, 0xf9, 0x74, 0xa2, 0x2e, 0x75, 0x3a, 0x71, 0xa8, 0x43,
-  0x1c, 0xe7, 0x48, 0xd1, 0x69, 0x44, 0xf6, 0x8e, 0xf7, 0xd6, 0xbc, 0x27,
-  0xfa, 0x8d, 0x7b, 0x9e, 0x7e, 0x9c, 0xb6, 0xff, 0xca, 0xec, 0x67, 0x67,
-  0x42, 0xd5, 0xc9, 0x73, 0x75, 0xac, 0xdb, 0xfd, 0x22, 0x05, 0x52, 0x7a,
-  0x82, 0xd2, 0x8e, 0x6d, 0x7f, 0x0c, 0x03, 0xbe, 0x75, 0xd7, 0xba, 0xc9,
-  0x31, 0x1e, 0x1e, 0xf1, 0x0c, 0xdd, 0x24, 0xd7, 0xc1, 0x7a, 0x77, 0xd6,
-  0xf4, 0xf6, 0xf4, 0xc4, 0xfd, 0x3b, 0xee, 0xc1, 0x70, 0xe2, 0xdb, 0xc3,
-  0xf8, 0xe0, 0xec, 0x5d, 0x65, 0xd7, 0xd9, 0x0d, 0x60, 0xba, 0x03, 0xe9,
-  0x90, 0x04, 0x7e, 0x8b, 0x97, 0x27, 0x4a, 0x56, 0x34, 0x09, 0x23, 0xcc,
-  0x77, 0xfe, 0xf3, 0x2c, 0xe1, 0xcc, 0x6e, 0x3e, 0x53, 0x7a, 0xd3, 0x73,
-  0xbd, 0xbc, 0xae, 0xa1, 0xcb, 0xea, 0x5d, 0xd8, 0xf3, 0xda, 0x2f, 0xbe,
-  0x30, 0x84, 0xbf, 0x95, 0x58, 0x3a, 0x43, 0x7b, 0xc4, 0xc4, 0x44, 0x31,
-  0x22, 0xca, 0x3d, 0x5d, 0x00, 0xb0, 0xfb, 0xae, 0xa8, 0x5c, 0xee, 0x32,
-  0xb9, 0xb4, 0xb9, 0xfd, 0xf1, 0x97, 0xe2, 0xff, 0xa4, 0xe6, 0xe2, 0x7a,
-  0xbc, 0x73, 0x1a, 0x31, 0x87, 0x16, 0xa8, 0x2c, 0x7f, 0xce, 0xaa, 0x0e,
-  0xcb, 0xd8, 0xa4, 0x0f, 0x7d, 0xb6, 0x2d, 0xbf, 0x27, 0xdf, 0x0f, 0x1e,
-  0xd1, 0xae, 0xc2, 0x3d, 0xf2, 0xa7, 0xff, 0xfd, 0xf0, 0x8f, 0xbf, 0xfc,
-  0xe7, 0x4f, 0xff, 0xfa, 0xdb, 0xff, 0xfe, 0xf8, 0xcf, 0xbf, 0xfe, 0xf7,
-  0xcf, 0x7f, 0xfa, 0x07, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x01, 0x14, 0x00,
-  0xff, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-  0x08, 0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08,
-  0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x4a, 0x9c,
-  0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3,
-  0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28,
-  0x53, 0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0x45, 0x3f, 0xfd, 0x62, 0xf2, 0x9b,
-  0x79, 0xc7, 0x25, 0xc2, 0x37, 0xfa, 0x72, 0xea, 0x7b, 0x63, 0xb3, 0x21,
-  0x1d, 0x3a, 0x3d, 0x11, 0xde, 0x99, 0xc9, 0x2f, 0x66, 0x3f, 0x3f, 0x41,
-  0x19, 0xc2, 0x34, 0x4a, 0x94, 0x5f, 0xcd, 0xa4, 0x00, 0x70, 0xea, 0xcc,
-  0xc9, 0x13, 0xaa, 0x41, 0x3a, 0xfb, 0xf6, 0x01, 0xb5, 0x0a, 0x60, 0x28,
-  0x51, 0xa3, 0x47, 0xb9, 0x1a, 0x5c, 0xca, 0xeb, 0xd1, 0xa3, 0x48, 0x8b,
-  0x70, 0xd1, 0x4c, 0x2a, 0x55, 0x0f, 0x05, 0x0a, 0x7a, 0xa8, 0x8a, 0x15,
-  0x88, 0x35, 0xab, 0x56, 0xab, 0x5e, 0x71, 0x2d, 0x8a, 0x64, 0x96, 0x57,
-  0x4c, 0xa4, 0x73, 0x01, 0x2c, 0x0d, 0x66, 0xf6, 0xec, 0x22, 0x41, 0x6a,
-  0x9d, 0xf6, 0x94, 0xba, 0xe7, 0xed, 0xdb, 0x3d, 0x72, 0xb9, 0xd6, 0xad,
-  0x54, 0x29, 0xeb, 0xd6, 0x9e, 0x79, 0x05, 0xed, 0x2d, 0x1c, 0xec, 0xef,
-  0xdc, 0x3f, 0x31, 0xcb, 0x16, 0x46, 0x2b, 0x48, 0x50, 0xaf, 0x99, 0x36,
-  0x19, 0x3b, 0x76, 0x0c, 0x79, 0xa7, 0xd5, 0xc9, 0x4b, 0x96, 0x54, 0xbe,
-  0xdb, 0x73, 0x66, 0xaf, 0xd2, 0x9b, 0x0b, 0xfb, 0xed, 0xf7, 0x87, 0x2b,
-  0xe8, 0x7e, 0xc1, 0x26, 0x15, 0x36, 0x5c, 0x5a, 0x10, 0xea, 0x96, 0x74,
-  0x72, 0x36, 0x5e, 0xcd, 0x3a, 0xe7, 0x65, 0x9b, 0xb0, 0x63, 0xcb, 0xb6,
-  0x5c, 0x9b, 0x5f, 0xf1, 0xdc, 0x66, 0x27, 0x75, 0xe6, 0x0d, 0xf5, 0xf7,
-  0xb0, 0x4f, 0xc2, 0x47, 0xfe, 0x1f, 0x2e, 0x7d, 0x9c, 0xa5, 0x72, 0x0b,
-  0xe8, 0xd3, 0xab, 0x6f, 0x1d, 0x34, 0xba, 0xf4, 0xe9, 0xb4, 0x5b, 0xce,
-  0xbc, 0xce, 0xb7, 0xf0, 0xa4, 0x4f, 0xc3, 0x62, 0xf6, 0xee, 0xe9, 0x1d,
-  0x13, 0xf8, 0xe1, 0xa4, 0x91, 0xc7, 0x8f, 0x4b, 0x39, 0xa5, 0x77, 0x8a,
-  0x3a, 0x08, 0xaa, 0x73, 0x4a, 0x7a, 0x39, 0xf5, 0x34, 0x19, 0x13, 0x10,
-  0x46, 0x08, 0xe1, 0x6c, 0xcf, 0xa9, 0x34, 0x1f, 0x6e, 0xf5, 0x65, 0xf7,
-  0x09, 0x26, 0xf9, 0x71, 0xe7, 0x92, 0x77, 0x9b, 0xf8, 0x17, 0x9e, 0x59,
-  0x01, 0x1a, 0x37, 0x60, 0x4b, 0x59, 0xa1, 0x77, 0x60, 0x82, 0x08, 0x2e,
-  0x68, 0x41, 0x56, 0xd0, 0x65, 0x55, 0x89, 0x84, 0x34, 0x32, 0x41, 0xa1,
-  0x7c, 0xd6, 0x61, 0x38, 0xdc, 0x7d, 0x98, 0x6c, 0xd2, 0xe1, 0x7e, 0x2b,
-  0x81, 0x18, 0xe2, 0x7f, 0xe2, 0x95, 0x76, 0xda, 0x89, 0x2c, 0xa5, 0x68,
-  0x01, 0x8b, 0x2c, 0xa2, 0x07, 0x23, 0x72, 0x59, 0x39, 0x52, 0xc4, 0x94,
-  0x54, 0x56, 0x39, 0xa5, 0x23, 0xd4, 0xad, 0x64, 0x9b, 0x8e, 0xf6, 0x6d,
-  0xb8, 0x89, 0x8f, 0xfa, 0x05, 0x19, 0xd3, 0x30, 0x5f, 0x0e, 0x39, 0x22,
-  0x71, 0x89, 0x3d, 0x95, 0xe4, 0x3e, 0xe8, 0x31, 0x99, 0xa0, 0x93, 0xfb,
-  0x40, 0xb9, 0x8f, 0x94, 0x56, 0xd6, 0x79, 0x65, 0x96, 0x29, 0x65, 0x86,
-  0xdd, 0x23, 0x3c, 0x96, 0xf9, 0x63, 0x4a, 0xde, 0x75, 0x52, 0xa6, 0x88,
-  0x00, 0xa6, 0xb5, 0x96, 0x4b, 0x59, 0x69, 0xa0, 0xc1, 0x3a, 0x8c, 0x36,
-  0xca, 0xa8, 0xa2, 0x4f, 0xaa, 0x54, 0x17, 0x9d, 0x76, 0xda, 0x89, 0x65,
-  0x7c, 0x28, 0xe5, 0xb5, 0x67, 0x9f, 0x5f, 0x76, 0xf2, 0xa7, 0x49, 0x81,
-  0x0a, 0xfa, 0x25, 0xa1, 0xa3, 0xf1, 0x72, 0x28, 0xa2, 0xfb, 0x28, 0xea,
-  0xa8, 0xa3, 0x90, 0xc6, 0x29, 0x69, 0x94, 0xfe, 0x95, 0xc6, 0x5a, 0xc4,
-  0xa5, 0x15, 0x9a, 0xe4, 0x15, 0x2f, 0x19, 0xf2, 0xe9, 0x65, 0xa7, 0x9e,
-  0x86, 0x49, 0xd2, 0x6f, 0xcc, 0x74, 0x22, 0xec, 0xa0, 0x44, 0xf6, 0x75,
-  0x2a, 0xaa, 0xaa, 0xae, 0xfa, 0xa8, 0x06, 0x91, 0x9e, 0x34, 0x69, 0x0f,
-  0xd0, 0x46, 0x2b, 0xed, 0xb4, 0xd3, 0xd2, 0xba, 0xd2, 0xad, 0x3b, 0xee,
-  0xba, 0x89, 0xb0, 0x9d, 0x30, 0xe3, 0x6b, 0x48, 0xc0, 0x72, 0x2b, 0xaa,
-  0x99, 0xba, 0x1d, 0x8b, 0xec, 0xa2, 0xca, 0xae, 0xd3, 0x6a, 0x4a, 0xcf,
-  0x52, 0xeb, 0xee, 0xbb, 0xd6, 0xaa, 0x84, 0xad, 0x86, 0x3d, 0xf2, 0x2a,
-  0xac, 0xb7, 0x1e, 0x7e, 0x04, 0x2c, 0x2a, 0xe2, 0x12, 0x1b, 0x5e, 0x67,
-  0x8a, 0x25, 0x95, 0x28, 0xba, 0xca, 0xae, 0xeb, 0x6c, 0x94, 0xef, 0x26,
-  0xec, 0x6e, 0xbc, 0x79, 0x16, 0x45, 0x98, 0xae, 0xf5, 0x6e, 0xcb, 0x2d,
-  0x2a, 0xf8, 0x02, 0xc9, 0xd1, 0xbe, 0xfc, 0x72, 0xeb, 0xef, 0x23, 0xdb,
-  0xa9, 0x19, 0x54, 0x56, 0x20, 0x80, 0x90, 0xee, 0x3a, 0x21, 0x37, 0x3b,
-  0x52, 0x5d, 0x99, 0x28, 0xac, 0xf2, 0xb4, 0x99, 0xe0, 0x99, 0x69, 0x4c,
-  0x84, 0x71, 0x2a, 0xb1, 0xb0, 0xa8, 0x50, 0xfc, 0xad, 0x46, 0xbf, 0x15,
-  0x63, 0x4a, 0xcd, 0xfd, 0x8e, 0x0a, 0x5e, 0xc7, 0x5c, 0x81, 0x2c, 0x72,
-  0xba, 0x25, 0xbb, 0x4a, 0x52, 0x5d, 0x89, 0xac, 0xac, 0x74, 0xb4, 0x89,
-  0xb8, 0x7c, 0xd2, 0x1d, 0x30, 0xcb, 0x2c, 0x6e, 0xcd, 0xa6, 0x14, 0x73,
-  0xf3, 0x45, 0xbf, 0x41, 0x63, 0xca, 0xce, 0x19, 0x0f, 0xeb, 0x33, 0x31,
-  0x31, 0x79, 0x1c, 0x52, 0x5d, 0x76, 0x61, 0x5a, 0x90, 0xd0, 0x23, 0x17,
-  0x9d, 0x10, 0xd9, 0x76, 0xd5, 0xea, 0x10, 0xd2, 0x3b, 0xc4, 0x2d, 0xf7,
-  0xdc, 0x74, 0xd7, 0x6d, 0x77, 0xdc, 0x4d, 0x9b, 0x6d, 0x6b, 0xfe, 0x4c,
-  0xc4, 0x68, 0x3b, 0x35, 0x2a, 0x5b, 0x43, 0x73, 0x35, 0x45, 0x59, 0xab,
-  0xb2, 0x35, 0xcf, 0x1a, 0xfb, 0xec, 0x4d, 0x3f, 0x62, 0x83, 0xc4, 0x76,
-  0xd9, 0x6e, 0x03, 0x20, 0xf4, 0x28, 0xca, 0x8e, 0xa2, 0xf6, 0x41, 0x8f,
-  0xb7, 0x2d, 0x11, 0xd2, 0x36, 0x74, 0xee, 0xf9, 0xe7, 0xa0, 0x87, 0x2e,
-  0xfa, 0xe7, 0x79, 0x47, 0x3e, 0x12, 0xd4, 0xde, 0xf8, 0x3d, 0x31, 0xe0,
-  0xa6, 0xa8, 0x22, 0x78, 0xbe, 0x84, 0xc7, 0x04, 0x8d, 0x2a, 0x86, 0x73,
-  0xdd, 0xf3, 0x90, 0x60, 0x33, 0xd5, 0xd4, 0xee, 0xbc, 0x13, 0x15, 0xc7,
-  0xdb, 0x59, 0x15, 0x52, 0xc2, 0xf0, 0x25, 0x14, 0xe2, 0xb4, 0x40, 0x59,
-  0x0d, 0x5f, 0x01, 0xe5, 0x8d, 0x8e, 0x52, 0xc1, 0xf0, 0x26, 0xd3, 0x15,
-  0x3c, 0xf1, 0xc5, 0x1f, 0xaf, 0x10, 0xca, 0xa3, 0x67, 0xaf, 0xbd, 0xe8,
-  0x2d, 0xeb, 0xed, 0x50, 0x1c, 0xbd, 0x87, 0xdf, 0x14, 0x58, 0x7d, 0x47,
-  0xfc, 0xf7, 0xd6, 0xb4, 0xbf, 0x6e, 0x71, 0x44, 0x59, 0xbf, 0x42, 0xfb,
-  0xe1, 0x5d, 0x8f, 0x2b, 0x62, 0x30, 0xed, 0xc8, 0x24, 0xfe, 0xfd, 0xbf,
-  0x2f, 0x54, 0x97, 0xf0, 0xd4, 0x57, 0xaf, 0x77, 0xf2, 0xca, 0x2b, 0x05,
-  0x3b, 0xd8, 0x51, 0x8a, 0xe7, 0x41, 0xcf, 0x68, 0x03, 0xd9, 0x5f, 0xff,
-  0xfc, 0x67, 0xba, 0x82, 0xa0, 0x6c, 0x06, 0x10, 0x8c, 0xa0, 0x04, 0x27,
-  0x48, 0xc1, 0x0a, 0x5a, 0xb0, 0x7b, 0x0d, 0x44, 0x08, 0xf8, 0xee, 0x27,
-  0xbe, 0x98, 0xb4, 0x23, 0x38, 0xaa, 0xa3, 0x19, 0xeb, 0x68, 0xf7, 0x0a,
-  0xf5, 0x4d, 0xa4, 0x7d, 0xee, 0xab, 0x1d, 0xe2, 0xbc, 0x46, 0xae, 0x22,
-  0x15, 0x07, 0x10, 0x80, 0xe0, 0x03, 0x1f, 0xe4, 0x40, 0x43, 0x1a, 0xce,
-  0xe1, 0x86, 0xad, 0x98, 0x49, 0xfe, 0x12, 0x32, 0xbd, 0x05, 0x32, 0xf0,
-  0x6c, 0xfe, 0xfb, 0xa0, 0x5e, 0x05, 0x16, 0xb0, 0x00, 0x03, 0x1e, 0xd0,
-  0x81, 0x3d, 0x5c, 0xa0, 0xf1, 0x10, 0xb8, 0xb6, 0xac, 0x40, 0xc2, 0x82,
-  0x50, 0x8c, 0xa2, 0x14, 0x21, 0x61, 0xbd, 0x84, 0x6c, 0xb0, 0x15, 0x37,
-  0x9c, 0x43, 0x0d, 0x69, 0x28, 0x43, 0x18, 0x16, 0x47, 0x33, 0xb9, 0x92,
-  0xda, 0xea, 0xd0, 0xa7, 0x8a, 0x57, 0x94, 0x70, 0x70, 0x0b, 0x41, 0x61,
-  0x0a, 0xe1, 0x77, 0x3b, 0x52, 0x91, 0x68, 0x3c, 0xa5, 0x81, 0xa1, 0x0c,
-  0xb7, 0x28, 0x87, 0x2c, 0xce, 0x21, 0x87, 0xfc, 0xd8, 0xe1, 0x41, 0xb2,
-  0x92, 0x82, 0x3e, 0xfa, 0xf1, 0x8f, 0x8c, 0x70, 0x19, 0x1f, 0xff, 0x48,
-  0xc8, 0x3e, 0x36, 0xab, 0x2e, 0x8c, 0x28, 0xe4, 0x1f, 0xa3, 0x77, 0x15,
-  0x27, 0xb6, 0xe0, 0x91, 0x90, 0x8c, 0xa4, 0x24, 0x27, 0x49, 0xc9, 0x4a,
-  0x46, 0x92, 0x8a, 0xde, 0x3b, 0xc8, 0x15, 0xed, 0x48, 0xc7, 0x2e, 0x02,
-  0xe2, 0x8b, 0x9b, 0x0a, 0x61, 0x27, 0xa8, 0xd6, 0xba, 0x32, 0x9a, 0xd1,
-  0x84, 0x0e, 0xc9, 0x5a, 0x2c, 0xcc, 0xb8, 0x46, 0xdb, 0x25, 0xae, 0x85,
-  0x6f, 0x2c, 0x4d, 0x1b, 0x84, 0x41, 0x8f, 0x5a, 0xce, 0xe3, 0x96, 0xb8,
-  0x9c, 0xc7, 0x32, 0xb2, 0x88, 0x47, 0x3d, 0x02, 0x51, 0x91, 0x80, 0xc4,
-  0xd3, 0x20, 0x81, 0x69, 0x48, 0xa3, 0x21, 0x92, 0x98, 0xc5, 0xd4, 0x9f,
-  0x23, 0x2d, 0xc9, 0xcc, 0x66, 0x36, 0x13, 0x93, 0x19, 0x04, 0xc0, 0x26,
-  0x6f, 0xb8, 0x8c, 0x5c, 0xe2, 0xb2, 0x96, 0xf4, 0x10, 0x46, 0x1b, 0xb8,
-  0x44, 0xaf, 0x32, 0x9d, 0xaf, 0x94, 0xac, 0x8c, 0x05, 0x2a, 0xd3, 0x18,
-  0x13, 0x6b, 0xc4, 0x62, 0x95, 0x66, 0x7c, 0x9f, 0x2b, 0x59, 0xe8, 0x46,
-  0xe2, 0xcc, 0x12, 0x9b, 0xf4, 0xb0, 0x26, 0x2e, 0x77, 0x39, 0x87, 0x34,
-  0xf4, 0x12, 0x21, 0x59, 0xfe, 0x11, 0x81, 0x3e, 0xf7, 0xc9, 0x4f, 0x7d,
-  0x06, 0x92, 0x36, 0xf9, 0xec, 0xa7, 0x40, 0x9f, 0x84, 0x48, 0x81, 0x0e,
-  0x94, 0x89, 0x48, 0xdc, 0x07, 0x24, 0x9c, 0xc9, 0xd0, 0x86, 0x4a, 0x12,
-  0x9a, 0x0a, 0xb9, 0x62, 0x1a, 0xa8, 0x29, 0xcf, 0x5b, 0xc2, 0x53, 0x9b,
-  0x60, 0xcc, 0x96, 0xf9, 0xc6, 0x08, 0x4e, 0x33, 0x9e, 0xd3, 0x1a, 0x68,
-  0x24, 0xc8, 0x6f, 0xcc, 0x79, 0x4e, 0x56, 0xaa, 0x73, 0x85, 0xf2, 0x2b,
-  0x96, 0x61, 0x66, 0x59, 0x0f, 0x78, 0x56, 0xf4, 0x96, 0x37, 0x4c, 0x83,
-  0x3d, 0xcb, 0x03, 0x44, 0x83, 0x0a, 0xf4, 0x9f, 0x40, 0x09, 0xa8, 0x4d,
-  0xf5, 0x09, 0xa3, 0x82, 0xee, 0x74, 0x9f, 0x8c, 0x94, 0x9e, 0x42, 0x19,
-  0x0a, 0x09, 0x63, 0x2c, 0x94, 0xa8, 0x46, 0x25, 0x6a, 0x15, 0x01, 0x30,
-  0x93, 0x56, 0xc8, 0xf4, 0x86, 0x2f, 0x9d, 0x07, 0x3c, 0xeb, 0xa1, 0xcd,
-  0x50, 0x6e, 0x54, 0x84, 0x64, 0x0c, 0xe7, 0x47, 0x43, 0x0a, 0x80, 0x91,
-  0x9e, 0xb3, 0xa4, 0xe9, 0x54, 0x61, 0xfc, 0x36, 0x26, 0x9e, 0x2d, 0xd4,
-  0xa3, 0xa5, 0xd8, 0x8c, 0x6a, 0x4c, 0x65, 0x4a, 0x53, 0x82, 0x64, 0x85,
-  0x11, 0x3f, 0xdd, 0x27, 0x4e, 0xf7, 0x41, 0x8e, 0xb8, 0x8a, 0x80, 0x1c,
-  0x5a, 0x79, 0xab, 0x5d, 0x45, 0xf0, 0x4f, 0x84, 0xd4, 0x05, 0x12, 0x26,
-  0x08, 0xac, 0x60, 0x07, 0x2b, 0xd8, 0x7f, 0xee, 0x83, 0x11, 0x84, 0x4d,
-  0xac, 0x09, 0x0c, 0x8b, 0x58, 0xc5, 0x12, 0x16, 0xa2, 0x07, 0x99, 0x89,
-  0x4c, 0x27, 0x3a, 0x87, 0xa8, 0x4e, 0xb5, 0x1e, 0x5b, 0xb0, 0xaa, 0x37,
-  0x39, 0x4a, 0x42, 0x8f, 0x7e, 0x15, 0xa4, 0xb0, 0x13, 0x69, 0x39, 0xbf,
-  0x8a, 0xce, 0x56, 0xa2, 0x94, 0xac, 0x6f, 0x34, 0x2b, 0x5a, 0x6d, 0xf9,
-  0xd2, 0xb5, 0xa6, 0xa1, 0xad, 0x09, 0x74, 0xfe, 0xa2, 0x63, 0x09, 0xcb,
-  0xd8, 0xd9, 0x16, 0xd6, 0x2e, 0x8d, 0xb5, 0xad, 0x09, 0x20, 0x6b, 0x10,
-  0xbd, 0xda, 0x75, 0xae, 0x75, 0x8d, 0x2b, 0x5e, 0x7d, 0x1a, 0xd7, 0xbe,
-  0x46, 0x96, 0x1f, 0x93, 0x85, 0xea, 0x4b, 0x2f, 0x9b, 0xd9, 0x30, 0x8a,
-  0x92, 0x94, 0x9d, 0x7d, 0x05, 0x69, 0x41, 0xbb, 0x3e, 0xd1, 0xf6, 0x83,
-  0xa4, 0xa5, 0x3d, 0xe9, 0x58, 0x7d, 0x76, 0x26, 0xb4, 0xb0, 0xd4, 0xa5,
-  0xad, 0xad, 0xe7, 0x4c, 0x91, 0xd4, 0xc8, 0xa1, 0x3a, 0xb3, 0xa8, 0x47,
-  0x3d, 0x6f, 0x52, 0xcf, 0xbb, 0x54, 0x9d, 0xfe, 0x14, 0xa7, 0x92, 0xdb,
-  0x87, 0x5d, 0x7b, 0xea, 0xdb, 0xb8, 0x06, 0xb5, 0xa9, 0x4f, 0xad, 0xec,
-  0x72, 0xb1, 0x49, 0xd5, 0x36, 0x68, 0xd6, 0x5e, 0xa3, 0x1c, 0xa1, 0x29,
-  0xa5, 0xbb, 0xd5, 0xd0, 0x1a, 0xc4, 0xab, 0xd9, 0x15, 0x6b, 0x1b, 0x55,
-  0x4a, 0x9a, 0x77, 0xa6, 0xb5, 0xa2, 0xf4, 0x1c, 0xaf, 0x2f, 0x13, 0x9a,
-  0x5e, 0x87, 0x5a, 0x98, 0x99, 0xbc, 0xdd, 0xa3, 0x7c, 0x8b, 0x9b, 0x25,
-  0xf7, 0xda, 0x94, 0xa0, 0xf5, 0xdd, 0x69, 0x50, 0x25, 0x4a, 0xd1, 0x8a,
-  0x5e, 0x74, 0x9b, 0xff, 0x9d, 0x59, 0x80, 0xb3, 0xea, 0x59, 0xea, 0x36,
-  0x44, 0x95, 0x26, 0x55, 0xf0, 0x2b, 0xdb, 0x19, 0x20, 0x07, 0xc7, 0x53,
-  0x9e, 0xf4, 0xbc, 0xa3, 0x0e, 0x19, 0xf2, 0xd7, 0x0b, 0xfb, 0x98, 0x92,
-  0x19, 0xd6, 0x30, 0x32, 0x53, 0x00, 0x5f, 0xe4, 0xed, 0x63, 0xc8, 0x29,
-  0x88, 0xd4, 0x31, 0x91, 0x19, 0x54, 0x69, 0x36, 0x35, 0x8b, 0xd5, 0x94,
-  0x27, 0x36, 0x31, 0x9a, 0xd1, 0x2e, 0x5d, 0x75, 0xc5, 0x1d, 0x95, 0xee,
-  0x38, 0x19, 0xa2, 0x46, 0xed, 0x2e, 0xb8, 0xbb, 0x70, 0x14, 0x84, 0x1c,
-  0x67, 0xb8, 0x45, 0x3b, 0xde, 0xd3, 0x27, 0xcb, 0xfc, 0xf1, 0xfe, 0x8f,
-  0x83, 0x2c, 0x64, 0x62, 0x16, 0xd9, 0xc8, 0x48, 0x3e, 0xe4, 0x5b, 0x99,
-  0x8c, 0x50, 0x82, 0x4c, 0xf3, 0x86, 0x9d, 0xe4, 0x83, 0x17, 0xe9, 0xa3,
-  0xd1, 0xcd, 0x62, 0x35, 0xcb, 0x5b, 0x7e, 0xb1, 0xec, 0xc2, 0xca, 0xc6,
-  0x19, 0x33, 0x38, 0xcc, 0x63, 0xa6, 0x23, 0x2f, 0x77, 0xfc, 0x90, 0xbf,
-  0x4a, 0xf1, 0xd1, 0x90, 0x86, 0x20, 0x9b, 0x35, 0xcc, 0x3f, 0x25, 0x3a,
-  0x0d, 0x80, 0xca, 0x23, 0xa2, 0x11, 0x4b, 0x60, 0x32, 0x05, 0xfa, 0x70,
-  0x89, 0x0b, 0xb9, 0x73, 0x9e, 0xf7, 0xcc, 0x4d, 0x88, 0xf9, 0x19, 0xcb,
-  0x9d, 0x0d, 0x74, 0x2a, 0x07, 0xed, 0x65, 0x43, 0x6b, 0xa7, 0x7e, 0xfd,
-  0xe0, 0xa0, 0xf8, 0x26, 0xcc, 0xe3, 0xac, 0x64, 0x22, 0xd2, 0xb8, 0xae,
-  0x20, 0x06, 0x81, 0xb7, 0x8f, 0x4a, 0x13, 0x6f, 0x89, 0xb5, 0xc2, 0x74,
-  0x05, 0x04, 0x48, 0x40, 0x23, 0x46, 0xcf, 0xd3, 0xd4, 0x03, 0x36, 0x43,
-  0x36, 0x28, 0x6b, 0xde, 0x79, 0x10, 0x84, 0x57, 0x86, 0x6e, 0x19, 0x55,
-  0xfd, 0x90, 0xc2, 0xc9, 0x98, 0x9d, 0x9f, 0xc8, 0x9d, 0xfd, 0x9a, 0xdd,
-  0x14, 0x5a, 0xa3, 0x79, 0x1f, 0x99, 0xd8, 0x9e, 0xb8, 0xb7, 0xb7, 0xeb,
-  0x46, 0x27, 0xf1, 0x87, 0xbd, 0x0d, 0x62, 0x09, 0x96, 0xe7, 0x28, 0xe7,
-  0x1d, 0xb1, 0xbc, 0xbe, 0x56, 0x76, 0x43, 0x98, 0xcd, 0xed, 0x99, 0x90,
-  0xef, 0xb9, 0x02, 0xa6, 0x36, 0x44, 0x0a, 0x57, 0x68, 0x6c, 0x2f, 0xae,
-  0x71, 0x25, 0xe1, 0xdc, 0xb8, 0x07, 0x4e, 0xba, 0xa5, 0x36, 0xb1, 0x6c,
-  0x9a, 0xd3, 0x70, 0xc8, 0x98, 0xd7, 0xee, 0xcb, 0x95, 0x17, 0xe1, 0x99,
-  0xec, 0x08, 0xea, 0xf0, 0x8d, 0x3e, 0x7d, 0xb3, 0x4f, 0x76, 0xfd, 0x4e,
-  0x69, 0xee, 0x00, 0x7e, 0xb4, 0xac, 0x24, 0xe2, 0x6e, 0x20, 0x0f, 0xb9,
-  0xdc, 0xfe, 0x4a, 0x47, 0x91, 0xcc, 0x99, 0x0e, 0x6d, 0x44, 0x03, 0x41,
-  0x93, 0x4d, 0x5e, 0x12, 0xa8, 0xf5, 0xa3, 0x7c, 0xa7, 0x26, 0xa5, 0xc5,
-  0x25, 0x92, 0xb3, 0x75, 0xa6, 0x54, 0x3b, 0x61, 0x5b, 0x09, 0xd2, 0x96,
-  0xb6, 0x34, 0x92, 0x97, 0x04, 0xe5, 0xca, 0x72, 0x78, 0x52, 0x5c, 0x0e,
-  0xed, 0x98, 0x03, 0xce, 0x6a, 0x06, 0xc6, 0x5a, 0x4c, 0x98, 0x71, 0x5a,
-  0xee, 0x72, 0x2c, 0xe7, 0xaf, 0x02, 0x37, 0xcf, 0x55, 0x56, 0xee, 0x9f,
-  0xef, 0x23, 0x64, 0x69, 0x53, 0x79, 0x9d, 0x5b, 0x42, 0x74, 0x53, 0x03,
-  0xb8, 0x66, 0x15, 0xd3, 0xd7, 0xd2, 0xb7, 0xdb, 0x42, 0x80, 0x71, 0xfc,
-  0x64, 0x08, 0x9b, 0xfa, 0xc2, 0x0c, 0xee, 0x91, 0x81, 0x8d, 0xcc, 0x60,
-  0x41, 0x19, 0x0a, 0x70, 0xba, 0xf9, 0xf5, 0xb0, 0x83, 0x24, 0x5c, 0xae,
-  0x2e, 0x57, 0xc0, 0xd8, 0x95, 0x76, 0xb5, 0x47, 0x8b, 0x61, 0x26, 0x71,
-  0x7b, 0xba, 0xe0, 0x6e, 0x93, 0x79, 0x79, 0x5d, 0xc5, 0x76, 0x07, 0xd7,
-  0xd2, 0xf3, 0xae, 0xf7, 0xb3, 0x8b, 0xa4, 0x5d, 0x7e, 0x07, 0x7c, 0xe0,
-  0x53, 0x45, 0xb0, 0x55, 0x11, 0x9e, 0xeb, 0x33, 0x11, 0x0d, 0xdd, 0x67,
-  0x96, 0x78, 0x91, 0x84, 0x0a, 0xb5, 0x67, 0x31, 0xd5, 0xde, 0x51, 0x32,
-  0x29, 0x59, 0x55, 0x4a, 0xf2, 0x93, 0x4f, 0x56, 0xc1, 0x98, 0xb5, 0xf5,
-  0x4c, 0x65, 0xde, 0xb9, 0x1b, 0xfd, 0x54, 0x49, 0x02, 0x05, 0x7a, 0xb4,
-  0xa4, 0x49, 0xe7, 0xb0, 0x32, 0x7d, 0x95, 0x50, 0x9f, 0xfa, 0xca, 0xb3,
-  0x8a, 0xf5, 0x85, 0x9f, 0x89, 0x5e, 0x60, 0xef, 0x4d, 0xd9, 0x83, 0x6a,
-  0x4c, 0xb5, 0x3f, 0xcc, 0xed, 0xa3, 0x4e, 0x29, 0xd3, 0xf3, 0x7e, 0xf2,
-  0x6d, 0x72, 0x93, 0x3a, 0xe0, 0xe4, 0x12, 0x3d, 0x11, 0xff, 0x4b, 0xc6,
-  0x3f, 0x89, 0x90, 0x68, 0xfe, 0x3c, 0x9e, 0x23, 0xb1, 0xa4, 0xf4, 0xce,
-  0x67, 0xfb, 0x48, 0x94, 0x24, 0xfd, 0xe9, 0xbf, 0xa8, 0xf5, 0x25, 0xd9,
-  0x52, 0x95, 0xe9, 0x9e, 0x7d, 0x94, 0x80, 0x88, 0xfb, 0xc5, 0x81, 0xed,
-  0xc1, 0xf6, 0x31, 0xa3, 0x1a, 0x45, 0xe8, 0x46, 0xa8, 0x52, 0x91, 0x9b,
-  0x5c, 0xd4, 0xe4, 0xf4, 0xe7, 0x68, 0xfd, 0xa6, 0xd6, 0x7e, 0x80, 0x32,
-  0x26, 0xf0, 0x27, 0x20, 0x2e, 0xf1, 0x20, 0xf6, 0x87, 0x7f, 0x04, 0xa2,
-  0x0f, 0x06, 0xc2, 0x22, 0x2e, 0x62, 0x01, 0x0d, 0x82, 0x23, 0x7c, 0x66,
-  0x65, 0x02, 0xa8, 0x12, 0xde, 0x71, 0x68, 0xf1, 0x47, 0x5e, 0xb8, 0x47,
-  0x7f, 0xef, 0x11, 0x1b, 0x0a, 0xb8, 0x80, 0x7b, 0xa0, 0x1e, 0x22, 0x68,
-  0x01, 0xec, 0x21, 0x81, 0xa5, 0x76, 0x1f, 0x15, 0x28, 0x26, 0xc0, 0x01,
-  0x66, 0x19, 0xe8, 0x20, 0x32, 0xf2, 0x1e, 0x1f, 0x78, 0x80, 0xca, 0xc1,
-  0x1c, 0xcd, 0xa1, 0x0f, 0xd1, 0x24, 0x12, 0x17, 0x02, 0x80, 0x38, 0x97,
-  0x74, 0x1f, 0x12, 0x1a, 0x85, 0x62, 0x24, 0xf2, 0x17, 0x75, 0x95, 0xe0,
-  0x81, 0xe2, 0x87, 0x12, 0xaa, 0xc1, 0x1c, 0xad, 0x51, 0x15, 0x38, 0x72,
-  0x1b, 0x00, 0xb8, 0x1b, 0xd5, 0x15, 0x14, 0x83, 0x51, 0x24, 0xcb, 0xe7,
-  0x82, 0xf4, 0x17, 0x83, 0x41, 0x71, 0x84, 0x8f, 0x11, 0x19, 0xd5, 0x27,
-  0x7c, 0xeb, 0xb7, 0x1d, 0x80, 0x31, 0x17, 0x64, 0xf1, 0x46, 0x53, 0xd8,
-  0x1e, 0x90, 0x13, 0x18, 0x6d, 0xf1, 0x16, 0x71, 0xe1, 0x1a, 0x71, 0x27,
-  0x7c, 0xb9, 0xb1, 0x1b, 0x5f, 0x18, 0x18, 0x4b, 0xb1, 0x6d, 0xa3, 0x97,
-  0x14, 0x75, 0x71, 0x83, 0x2d, 0x21, 0x15, 0x53, 0xa1, 0x84, 0x6b, 0xf8,
-  0x15, 0x46, 0xf1, 0x86, 0x81, 0x21, 0x18, 0xba, 0x33, 0x87, 0x50, 0xf1,
-  0x13, 0x7f, 0x38, 0x10, 0x78, 0xa8, 0x86, 0x20, 0x78, 0xc1, 0x87, 0x61,
-  0x51, 0x88, 0x8c, 0xd8, 0x88, 0x8e, 0xf8, 0x88, 0x90, 0x18, 0x89, 0x92,
-  0x38, 0x89, 0x94, 0x58, 0x89, 0x96, 0x78, 0x89, 0x98, 0x98, 0x89, 0x9a,
-  0x68, 0x10, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x01, 0x14, 0x00, 0xff,
-  0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x08,
-  0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13,
-  0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x4a, 0x9c, 0x48,
-  0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3, 0xc7,
-  0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28, 0x53,
-  0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0xc5, 0x35, 0xf6, 0xec, 0xd5, 0x9b, 0x59,
-  0x6f, 0x8d, 0x4b, 0x84, 0x55, 0xd4, 0xe9, 0x54, 0x57, 0xe5, 0x66, 0xc3,
-  0x32, 0x65, 0x7c, 0x22, 0x5c, 0x43, 0xb3, 0x5e, 0x4c, 0x9b, 0x42, 0x17,
-  0xc2, 0x8c, 0x59, 0xb4, 0x66, 0x52, 0x81, 0x39, 0x77, 0xea, 0xec, 0xf9,
-  0xd4, 0x60, 0x19, 0x79, 0xf2, 0x82, 0x56, 0x05, 0x40, 0xb4, 0x68, 0x4c,
-  0x7b, 0x48, 0xb7, 0x12, 0x5c, 0x8a, 0xeb, 0xd1, 0xa3, 0x48, 0x8b, 0x64,
-  0xcd, 0x24, 0x93, 0x34, 0xaa, 0x18, 0x0a, 0x14, 0xc4, 0x4c, 0x15, 0x2b,
-  0xf0, 0x2a, 0xd6, 0xac, 0x55, 0xc9, 0xcc, 0x94, 0xb5, 0x28, 0x92, 0x59,
-  0x5c, 0x47, 0xe9, 0x0a, 0x5c, 0x83, 0xcf, 0x5e, 0x59, 0xb3, 0x68, 0x05,
-  0xd9, 0xaa, 0x47, 0x8f, 0xed, 0x4d, 0xb7, 0x70, 0xe1, 0xca, 0xe5, 0x29,
-  0xd6, 0x6e, 0xa5, 0x4a, 0x58, 0xb5, 0xfa, 0x24, 0x43, 0xaf, 0x9e, 0x2d,
-  0x41, 0x7d, 0xcd, 0x3e, 0x02, 0x8c, 0x2f, 0x6c, 0x55, 0xc2, 0xf8, 0x78,
-  0x89, 0x3e, 0xbb, 0x48, 0x90, 0x62, 0x7a, 0xf4, 0x1e, 0xeb, 0x7c, 0x1b,
-  0x59, 0xf2, 0xdc, 0xa7, 0x76, 0x0d, 0x2d, 0x59, 0x62, 0x28, 0xb3, 0x50,
-  0xd8, 0x9f, 0x41, 0xfb, 0x15, 0xcd, 0x0b, 0x5f, 0xe9, 0xad, 0xa8, 0x79,
-  0x4d, 0x5a, 0x9d, 0xd8, 0x35, 0x6c, 0x97, 0x59, 0x66, 0xd7, 0xae, 0x3d,
-  0x39, 0x4b, 0xd2, 0xdc, 0xbb, 0x77, 0xf7, 0xc6, 0x7b, 0x13, 0xb6, 0x6b,
-  0xe1, 0xab, 0x27, 0xfe, 0x15, 0x3f, 0x9e, 0x14, 0x75, 0xad, 0x4f, 0xcb,
-  0x45, 0x37, 0x17, 0xf4, 0xbc, 0xe5, 0x6c, 0x0b, 0xf0, 0xe3, 0xcb, 0x9f,
-  0x2c, 0x14, 0x7b, 0x76, 0xed, 0xbe, 0x5d, 0x7a, 0x77, 0x1d, 0x5a, 0xf4,
-  0xa4, 0x4f, 0xb5, 0x18, 0x67, 0x5a, 0x4b, 0xa8, 0x0d, 0x83, 0x09, 0x7a,
-  0xcc, 0xb5, 0xe6, 0x5c, 0x6c, 0xee, 0xa9, 0x13, 0xdf, 0x29, 0x52, 0x9d,
-  0x12, 0x9f, 0x4e, 0x3e, 0x95, 0x01, 0x0f, 0x3c, 0x95, 0x30, 0xa1, 0xe1,
-  0x86, 0x1a, 0x56, 0x72, 0xa1, 0x66, 0x2b, 0xed, 0x07, 0x9e, 0x7f, 0x9f,
-  0x60, 0x32, 0x8c, 0x80, 0x37, 0x15, 0xb8, 0xc9, 0x81, 0xe9, 0x21, 0xa6,
-  0x20, 0x7b, 0x0c, 0xb2, 0xa4, 0x13, 0x7c, 0x10, 0x4a, 0xa5, 0x8e, 0x84,
-  0x16, 0x50, 0xe8, 0x92, 0x85, 0x18, 0x72, 0xe8, 0x23, 0x13, 0x1e, 0xc2,
-  0x03, 0x62, 0x4a, 0x22, 0xf6, 0x67, 0xd6, 0x7f, 0x98, 0x6c, 0x72, 0x22,
-  0x79, 0x2b, 0xa9, 0xb8, 0x22, 0x82, 0xea, 0x29, 0x68, 0x4b, 0x7b, 0x32,
-  0x3a, 0x98, 0xa3, 0x8d, 0x33, 0x5e, 0xb9, 0xe3, 0x85, 0x81, 0x14, 0xe1,
-  0xe5, 0x97, 0x60, 0x7a, 0x19, 0xc8, 0x87, 0x2c, 0x01, 0xc7, 0xdf, 0x70,
-  0x47, 0x96, 0xb8, 0x89, 0x92, 0x28, 0xaa, 0xe4, 0xe4, 0x93, 0x2d, 0xb2,
-  0xa6, 0x18, 0x63, 0x8e, 0x55, 0x09, 0x1f, 0x96, 0x59, 0xea, 0xb8, 0x12,
-  0x8f, 0x95, 0x84, 0xe9, 0xe7, 0x97, 0x41, 0x0e, 0x69, 0x12, 0x67, 0x9e,
-  0x8d, 0x98, 0x66, 0x92, 0x6b, 0x2e, 0x39, 0x20, 0x49, 0x05, 0x76, 0xb2,
-  0x26, 0x9c, 0x09, 0xaa, 0x55, 0x4f, 0x9d, 0x2c, 0xad, 0xb3, 0x8e, 0x06,
-  0x1a, 0x58, 0xaa, 0xa9, 0xa6, 0x98, 0x5a, 0xca, 0x12, 0x9f, 0x7f, 0x86,
-  0x5a, 0x44, 0xa0, 0x2b, 0xe9, 0x55, 0x0f, 0x5f, 0x68, 0x3e, 0x82, 0xe4,
-  0xa3, 0x9d, 0x28, 0x7a, 0x52, 0xa3, 0xfe, 0x8e, 0xae, 0xc9, 0x22, 0x73,
-  0xb8, 0xcc, 0xb4, 0xa8, 0x4a, 0x96, 0x76, 0xba, 0x29, 0xa7, 0x99, 0xae,
-  0xb3, 0xe7, 0x85, 0x7d, 0x8a, 0x1a, 0x2a, 0xa9, 0x6e, 0xce, 0x84, 0x4b,
-  0xaa, 0xab, 0xae, 0xd9, 0x49, 0xab, 0x6d, 0x8e, 0xb4, 0x46, 0x3e, 0xf8,
-  0x0c, 0xb3, 0x6c, 0xac, 0x90, 0x8a, 0x56, 0xab, 0x53, 0x3e, 0xe5, 0xda,
-  0xeb, 0xae, 0x97, 0xf6, 0xaa, 0x92, 0x17, 0x17, 0x3a, 0xd2, 0xc3, 0xb8,
-  0xe4, 0x96, 0x6b, 0xae, 0xb9, 0x8e, 0x5c, 0xe8, 0x45, 0x93, 0xc6, 0x86,
-  0xa7, 0xa6, 0xb2, 0xcb, 0x9e, 0x98, 0xcf, 0xad, 0x1c, 0x3d, 0x9b, 0x8f,
-  0xb4, 0xd3, 0x3e, 0x3a, 0xeb, 0x5f, 0xb6, 0x26, 0xa5, 0x2d, 0xb7, 0xff,
-  0xfa, 0x8a, 0x12, 0xb8, 0xf0, 0x88, 0x7b, 0xee, 0xc1, 0x08, 0xa7, 0x0b,
-  0xcf, 0xba, 0xc5, 0xd6, 0x73, 0x98, 0xaa, 0xef, 0x6e, 0x32, 0x6d, 0xab,
-  0xf9, 0xcc, 0x1b, 0x92, 0xbd, 0xc3, 0xa0, 0x32, 0xb1, 0xbe, 0x50, 0x5e,
-  0x4b, 0xef, 0x4a, 0x01, 0x73, 0xab, 0xeb, 0xc0, 0xe1, 0x22, 0x6c, 0xf2,
-  0xc1, 0x0a, 0x33, 0x9c, 0x52, 0x57, 0x87, 0x25, 0x2b, 0xf1, 0xb4, 0xa8,
-  0x0c, 0x53, 0xf1, 0xc7, 0x16, 0xd9, 0xfb, 0x0b, 0x2a, 0x1a, 0xe7, 0x2b,
-  0x2b, 0x82, 0xbc, 0xc8, 0x44, 0x33, 0xae, 0xeb, 0x80, 0x00, 0x02, 0xc0,
-  0x41, 0x0f, 0x2d, 0x70, 0x49, 0x04, 0x1b, 0x7c, 0xf2, 0xd2, 0xe4, 0xa6,
-  0xcc, 0xae, 0x3d, 0xaa, 0xb9, 0x3c, 0x31, 0xce, 0xbf, 0xcc, 0xdc, 0x91,
-  0xcd, 0xa6, 0xe0, 0xbc, 0xf1, 0xce, 0xe2, 0xc5, 0x44, 0xa9, 0x50, 0x96,
-  0x0a, 0x4d, 0xb4, 0xd8, 0x47, 0x8f, 0x94, 0x34, 0xd3, 0x68, 0x37, 0xad,
-  0x6e, 0xa9, 0x31, 0x29, 0x17, 0xf1, 0xd4, 0xa8, 0x98, 0x52, 0xb5, 0xc5,
-  0x1a, 0x61, 0x9d, 0x75, 0xce, 0xcb, 0x72, 0xdc, 0x33, 0xfe, 0x58, 0x48,
-  0x73, 0xab, 0xb2, 0x41, 0x61, 0x1b, 0xcd, 0x2d, 0xd9, 0x09, 0x79, 0xe1,
-  0x37, 0x45, 0x49, 0xef, 0xa0, 0xf8, 0xe2, 0x8c, 0x33, 0x8e, 0x02, 0x0a,
-  0x8d, 0x47, 0xbe, 0xb8, 0xd3, 0x6e, 0xb6, 0xfd, 0x36, 0xcc, 0x71, 0xcb,
-  0x6d, 0x35, 0x46, 0xf6, 0x16, 0xa3, 0x8a, 0x29, 0x77, 0x6f, 0xfd, 0x64,
-  0x36, 0x7c, 0x93, 0x64, 0x38, 0xc0, 0x7f, 0x13, 0x14, 0xf8, 0x28, 0xdc,
-  0x8e, 0x42, 0xf8, 0x41, 0xa7, 0x1f, 0x1e, 0x11, 0xc1, 0x89, 0xd8, 0x60,
-  0xfb, 0xed, 0xb8, 0xe3, 0x3e, 0x02, 0x2b, 0xac, 0x8c, 0x90, 0xfb, 0xef,
-  0xb7, 0x27, 0xb2, 0x76, 0xe5, 0xd9, 0x5c, 0xbe, 0x2c, 0xce, 0xa0, 0xab,
-  0x52, 0xcc, 0xe6, 0x15, 0x75, 0xae, 0xca, 0xe7, 0xa1, 0xeb, 0xfc, 0xe4,
-  0xde, 0x32, 0x35, 0x05, 0x1b, 0x6c, 0xf3, 0x64, 0xaf, 0xfd, 0xf6, 0x61,
-  0x38, 0x74, 0x7a, 0x1e, 0x25, 0x84, 0x5f, 0x42, 0x1e, 0x96, 0xa6, 0x2e,
-  0x90, 0xa5, 0xe1, 0x57, 0xc0, 0xba, 0xa6, 0xa3, 0x54, 0x10, 0xbe, 0xa7,
-  0x06, 0x7d, 0x2f, 0xfe, 0xf8, 0xe5, 0x43, 0x44, 0x3b, 0xf0, 0xc0, 0xef,
-  0x7e, 0x61, 0xef, 0xf8, 0xff, 0x2e, 0xfc, 0xc2, 0x14, 0x09, 0xc3, 0xf6,
-  0x06, 0x38, 0x8f, 0xeb, 0x75, 0xa6, 0x29, 0x5f, 0xe1, 0x85, 0xf1, 0x3a,
-  0x81, 0x3c, 0x53, 0x3c, 0x6f, 0x79, 0x74, 0x9b, 0x48, 0xe7, 0x5e, 0xf1,
-  0x3c, 0xd0, 0x69, 0x4d, 0x7a, 0x2c, 0xe2, 0x05, 0x3a, 0xaa, 0x57, 0x14,
-  0x03, 0x12, 0x70, 0x80, 0xdd, 0x5b, 0x88, 0x17, 0xd8, 0xc1, 0x0e, 0xf0,
-  0xcd, 0x6f, 0x7c, 0x24, 0x34, 0x1f, 0x09, 0xc5, 0x57, 0x81, 0x52, 0x90,
-  0xb0, 0x14, 0xee, 0x0b, 0x1f, 0x09, 0xe3, 0x47, 0x42, 0x13, 0xce, 0x2f,
-  0x0f, 0x29, 0xf4, 0xde, 0x85, 0x12, 0x31, 0x83, 0x1e, 0xfa, 0xf0, 0x87,
-  0xfe, 0x3f, 0xd4, 0xdf, 0x85, 0xe0, 0xd1, 0x3b, 0x20, 0x1a, 0xd1, 0x87,
-  0xff, 0x33, 0x1f, 0x43, 0x04, 0xf8, 0x41, 0xed, 0x19, 0xb0, 0x29, 0x46,
-  0x41, 0x87, 0xdb, 0x10, 0xf5, 0xb2, 0xe3, 0x65, 0xee, 0x79, 0xaf, 0x80,
-  0xe0, 0xcf, 0x86, 0x52, 0xb1, 0x62, 0xbc, 0x82, 0x82, 0xd0, 0xbb, 0x60,
-  0xde, 0xb8, 0x96, 0xa0, 0xef, 0x08, 0x02, 0x10, 0x80, 0xe0, 0x03, 0x1f,
-  0xe4, 0xc0, 0x46, 0x36, 0xce, 0xe1, 0x8d, 0xa2, 0xc8, 0x5e, 0x08, 0x13,
-  0x52, 0xc3, 0x13, 0x8a, 0x0f, 0x87, 0xec, 0x48, 0xdd, 0x0a, 0x4b, 0xc0,
-  0x0e, 0x57, 0x54, 0x60, 0x01, 0x0b, 0xa8, 0x80, 0x2b, 0xd8, 0x21, 0x43,
-  0x76, 0x14, 0x64, 0x84, 0x25, 0xb4, 0x63, 0xf8, 0xf0, 0xd8, 0x90, 0x2c,
-  0xec, 0xf0, 0x88, 0x90, 0x64, 0xc5, 0x10, 0x87, 0xc8, 0x0a, 0x48, 0x1e,
-  0xf1, 0x7f, 0xd6, 0x79, 0x08, 0x13, 0x45, 0xf1, 0xc6, 0x39, 0xb4, 0x91,
-  0x8d, 0x6a, 0x44, 0xa3, 0x19, 0x8d, 0x04, 0x31, 0x2a, 0xc2, 0x2d, 0x79,
-  0xaa, 0xf8, 0xa2, 0x16, 0x23, 0x32, 0xc1, 0x2f, 0x56, 0x30, 0x7a, 0x63,
-  0xac, 0x96, 0x8b, 0xcc, 0x88, 0x46, 0x35, 0x7e, 0x52, 0x0e, 0x9d, 0x9c,
-  0x43, 0x1c, 0xe7, 0x31, 0xc7, 0x83, 0x90, 0x30, 0x05, 0xc0, 0x0c, 0xa6,
-  0x30, 0xf1, 0x98, 0x49, 0x81, 0xfc, 0x32, 0x05, 0x24, 0x74, 0x05, 0x30,
-  0x07, 0xc9, 0x0e, 0x60, 0xce, 0x70, 0x20, 0x59, 0xa8, 0xa1, 0x30, 0xa7,
-  0x89, 0x4c, 0x43, 0x2e, 0xc4, 0x91, 0xf0, 0x48, 0x44, 0x0b, 0xb6, 0xc9,
-  0xcd, 0x6e, 0x7a, 0xb3, 0x05, 0x93, 0x9c, 0xe4, 0x37, 0xc7, 0xc9, 0x4d,
-  0x4c, 0x3a, 0x64, 0x93, 0xb9, 0xbc, 0x65, 0x28, 0x01, 0x31, 0x4a, 0x64,
-  0x2d, 0xb0, 0x81, 0x58, 0x54, 0x25, 0xf3, 0x18, 0xd2, 0xb9, 0x58, 0x7c,
-  0x11, 0x8c, 0x16, 0xfe, 0xc4, 0x5b, 0x27, 0x08, 0xd1, 0x0c, 0xe3, 0x14,
-  0xe6, 0x2b, 0x45, 0x11, 0x44, 0x1b, 0x84, 0x71, 0xbd, 0x0f, 0x2e, 0xa3,
-  0x93, 0xbb, 0xec, 0x65, 0x41, 0x8e, 0x49, 0xcd, 0x60, 0x12, 0x73, 0x20,
-  0xc7, 0x24, 0xa1, 0x44, 0x25, 0xea, 0x4c, 0x6b, 0x02, 0x20, 0x9a, 0x25,
-  0x6c, 0xa8, 0x30, 0x9f, 0x99, 0x10, 0x6c, 0x6a, 0x93, 0x9c, 0xe4, 0x0c,
-  0xe7, 0x10, 0x41, 0x4a, 0x4e, 0x73, 0x2e, 0x04, 0x9d, 0x6f, 0x5c, 0xc6,
-  0x07, 0xaf, 0x27, 0x8c, 0x36, 0x08, 0xc2, 0x2b, 0x5f, 0xf1, 0x67, 0x33,
-  0x08, 0x71, 0x4a, 0x07, 0xa6, 0xf2, 0x8b, 0xb1, 0x58, 0x25, 0x3d, 0x2b,
-  0x06, 0x8d, 0x58, 0xd8, 0xd3, 0x95, 0x61, 0xc4, 0x9b, 0x22, 0xfa, 0xe9,
-  0xcf, 0xaf, 0x70, 0x70, 0x1a, 0x03, 0xf5, 0xa0, 0x41, 0xdf, 0x98, 0x86,
-  0x84, 0x22, 0x84, 0x84, 0x22, 0x88, 0xaa, 0x54, 0xa7, 0x1a, 0xd5, 0x87,
-  0x02, 0x00, 0xaa, 0x22, 0x98, 0xe8, 0x44, 0xa3, 0xfa, 0x4c, 0x8c, 0xe6,
-  0x81, 0xaa, 0x60, 0xcd, 0xaa, 0x45, 0x0f, 0x92, 0x05, 0x77, 0xb8, 0xc3,
-  0x0e, 0x24, 0x25, 0xa7, 0x59, 0xd7, 0xba, 0xd6, 0xb4, 0x8e, 0xd3, 0x0e,
-  0x66, 0x2d, 0xe6, 0x41, 0x36, 0x99, 0x86, 0x94, 0x36, 0xd1, 0x80, 0x2d,
-  0x9d, 0x06, 0x4d, 0x8c, 0xea, 0x4f, 0x7c, 0x34, 0x43, 0x11, 0x98, 0x43,
-  0xe5, 0x3d, 0x7d, 0x0a, 0x8d, 0x79, 0x1e, 0x64, 0x0d, 0xf7, 0xc8, 0x47,
-  0x4f, 0x7d, 0x7a, 0xcf, 0x57, 0x5e, 0x50, 0x11, 0xcf, 0xe8, 0xeb, 0x3f,
-  0x99, 0x52, 0x0f, 0xa4, 0x0a, 0x83, 0x31, 0x05, 0x6d, 0x22, 0x53, 0x9b,
-  0x9a, 0xbd, 0xa7, 0xb2, 0x23, 0xac, 0x60, 0x7d, 0x28, 0x56, 0xb5, 0x2a,
-  0x51, 0xae, 0x1a, 0xd2, 0xab, 0xa0, 0xa5, 0x2a, 0x47, 0x0d, 0x52, 0xd6,
-  0xb3, 0xba, 0xb5, 0x05, 0x76, 0x98, 0xfe, 0x05, 0x5a, 0xb7, 0xc9, 0x56,
-  0xb6, 0x72, 0x33, 0xb6, 0xb3, 0x4d, 0x2b, 0x5c, 0xdd, 0x21, 0xd7, 0x82,
-  0x64, 0x4f, 0x14, 0x69, 0xa8, 0xeb, 0x1c, 0x9a, 0x58, 0xc0, 0xeb, 0xd5,
-  0x23, 0xaf, 0x33, 0xe1, 0x6b, 0x5f, 0x9f, 0x01, 0x58, 0x06, 0x5e, 0xf1,
-  0xa6, 0xaf, 0xf0, 0x69, 0x2c, 0x0a, 0x7b, 0x8f, 0x8f, 0x21, 0xf6, 0x1e,
-  0x8b, 0x65, 0x2c, 0x50, 0xf3, 0xd9, 0x09, 0xc8, 0x4a, 0x76, 0xb2, 0xd5,
-  0x5b, 0xc4, 0x16, 0x66, 0xa2, 0xd4, 0x0f, 0x6e, 0x36, 0x0d, 0x9d, 0xf5,
-  0x25, 0x3b, 0xec, 0x90, 0xda, 0xa9, 0x12, 0x93, 0x1d, 0xe1, 0x30, 0x2d,
-  0x69, 0xa3, 0x1a, 0x0e, 0x76, 0xa0, 0xb6, 0xbd, 0x51, 0xb5, 0xc3, 0x6a,
-  0x09, 0xd2, 0x5a, 0x3b, 0x98, 0xe0, 0xbf, 0x00, 0x0e, 0x30, 0x80, 0x77,
-  0x7b, 0xd6, 0xff, 0xd6, 0x76, 0xad, 0xff, 0x25, 0xb0, 0x7f, 0x05, 0xcc,
-  0x60, 0x13, 0xec, 0xb6, 0xb7, 0x03, 0xc9, 0x5e, 0x70, 0x85, 0x4b, 0xdc,
-  0x27, 0xd6, 0x63, 0x0b, 0x8b, 0x48, 0x6e, 0x4c, 0x25, 0xcb, 0x5c, 0xe7,
-  0x0a, 0x16, 0xa7, 0xd2, 0x85, 0xc6, 0x3d, 0xaa, 0x3b, 0x94, 0x11, 0x67,
-  0xf7, 0xa7, 0xf8, 0x0c, 0x9d, 0x77, 0x25, 0x6b, 0xd4, 0x99, 0x88, 0x97,
-  0xbc, 0x99, 0x35, 0xef, 0x1c, 0x26, 0x9c, 0x5e, 0xd6, 0x9a, 0x75, 0xc1,
-  0x0d, 0x0e, 0xb0, 0x82, 0x0d, 0x7c, 0x60, 0x77, 0x24, 0x78, 0xad, 0x38,
-  0xce, 0xf1, 0x8f, 0x79, 0xeb, 0x59, 0xf6, 0xe2, 0x57, 0x04, 0xef, 0x8d,
-  0xaf, 0x58, 0xe7, 0x2b, 0x82, 0xfa, 0xde, 0x17, 0xbf, 0xfa, 0x1d, 0x2b,
-  0x41, 0x24, 0x1c, 0xdc, 0x37, 0x56, 0xd8, 0xb8, 0x17, 0xce, 0xb0, 0x51,
-  0x36, 0xbc, 0x5c, 0xc0, 0xc2, 0x13, 0xba, 0xd2, 0x9d, 0xee, 0x88, 0xad,
-  0x9b, 0xd8, 0xec, 0x36, 0x36, 0xa8, 0xcb, 0x5a, 0x71, 0xfe, 0x51, 0x01,
-  0x5a, 0xd9, 0x81, 0x62, 0x16, 0x7b, 0x9a, 0x9d, 0x31, 0x67, 0xe7, 0xd1,
-  0xd1, 0x1b, 0xbf, 0x16, 0xb7, 0xdc, 0xec, 0xb1, 0x3b, 0x6e, 0x2b, 0xdb,
-  0x3b, 0xc7, 0x95, 0x8e, 0x9f, 0x3d, 0xb2, 0x68, 0x03, 0x4d, 0xda, 0xd1,
-  0x9e, 0xb6, 0x86, 0x47, 0x16, 0x2b, 0x42, 0x7e, 0x5b, 0xe5, 0xe1, 0xde,
-  0xd5, 0xb8, 0xc8, 0xdd, 0x72, 0x4c, 0x38, 0xdc, 0xdc, 0x2f, 0x0f, 0x96,
-  0xb0, 0xf9, 0x20, 0xb1, 0x42, 0xec, 0xb5, 0xd8, 0x33, 0x73, 0x37, 0xcd,
-  0x44, 0x35, 0x4e, 0x8b, 0x67, 0x62, 0xd9, 0xf2, 0x0e, 0xf0, 0xa0, 0x33,
-  0x76, 0x6a, 0x9d, 0x5d, 0xfb, 0xda, 0x6e, 0xea, 0xb9, 0xd5, 0xdd, 0x7c,
-  0xb0, 0x42, 0xb0, 0xda, 0x5e, 0xab, 0x1a, 0x9a, 0xc9, 0x5d, 0x45, 0x34,
-  0x7e, 0xf7, 0x3b, 0x10, 0xba, 0xda, 0x75, 0xa5, 0x2c, 0x6d, 0x83, 0x5e,
-  0x35, 0x3c, 0x69, 0x99, 0x36, 0xd7, 0xc3, 0x36, 0xbd, 0x74, 0x61, 0x23,
-  0xb8, 0xe9, 0x2e, 0xa2, 0xd8, 0xb1, 0xfa, 0xe4, 0xe7, 0x9a, 0x29, 0x3b,
-  0x13, 0x81, 0x12, 0x14, 0xce, 0xa7, 0x46, 0xa8, 0x1c, 0x19, 0xe2, 0x51,
-  0x58, 0x6f, 0x53, 0xa4, 0x17, 0xf2, 0x76, 0x0b, 0x4c, 0x0a, 0x68, 0x8d,
-  0x3a, 0x94, 0x84, 0xc5, 0x8c, 0x68, 0xa1, 0x2b, 0x0a, 0x4d, 0x69, 0x9a,
-  0xbb, 0x9a, 0x09, 0x41, 0xe9, 0x1c, 0x54, 0x4a, 0xc0, 0x60, 0xbf, 0x74,
-  0xaf, 0x5c, 0x9e, 0x69, 0x4d, 0xe3, 0x19, 0x5d, 0x9d, 0x36, 0xa4, 0x95,
-  0x29, 0x16, 0x23, 0xb5, 0xf6, 0x35, 0xcb, 0xef, 0xd4, 0x72, 0x8d, 0x9f,
-  0xcc, 0xa5, 0xaa, 0xb9, 0xbd, 0x43, 0x6f, 0x83, 0x1b, 0x1e, 0xde, 0x26,
-  0x77, 0xb9, 0xcd, 0x6d, 0x55, 0x63, 0x36, 0xb3, 0x9a, 0xca, 0x4c, 0x01,
-  0x33, 0xd9, 0xdd, 0xee, 0x8c, 0x9a, 0x9b, 0xd7, 0x04, 0x91, 0xb7, 0x27,
-  0xfe, 0x3f, 0xb9, 0xce, 0x76, 0xba, 0xcb, 0x94, 0x81, 0x4d, 0xb6, 0x3c,
-  0x99, 0xfd, 0xef, 0x2e, 0x6e, 0x17, 0x96, 0x03, 0x87, 0x52, 0xc1, 0x5d,
-  0x73, 0xf0, 0x5b, 0x6a, 0x9b, 0x97, 0x10, 0xf1, 0xa8, 0x25, 0x8d, 0x28,
-  0xc9, 0x70, 0x56, 0x72, 0xe7, 0x3f, 0x94, 0x38, 0xa0, 0x6d, 0x78, 0x42,
-  0x3c, 0xea, 0x91, 0x90, 0x7c, 0xf4, 0x23, 0x20, 0x05, 0x89, 0xf4, 0xfd,
-  0x22, 0x92, 0xe8, 0x37, 0x04, 0x79, 0xc8, 0x7f, 0xdb, 0x49, 0x75, 0xf2,
-  0x41, 0x94, 0xdf, 0x21, 0xa5, 0xd4, 0x52, 0x1e, 0x4f, 0x7f, 0x43, 0x64,
-  0x82, 0xd0, 0x16, 0x5d, 0x06, 0x37, 0x08, 0x45, 0x53, 0x7f, 0x50, 0xa1,
-  0x0d, 0xa1, 0x1d, 0xd0, 0x7d, 0x28, 0xc4, 0xfd, 0x8d, 0x60, 0xed, 0x3d,
-  0x4c, 0xa2, 0xf7, 0xea, 0x58, 0xf4, 0x1c, 0x2e, 0x14, 0xe9, 0x25, 0x68,
-  0xe1, 0x0b, 0x63, 0xc8, 0x47, 0x29, 0x03, 0xe0, 0xe9, 0x76, 0x34, 0xfa,
-  0x12, 0x89, 0x9b, 0x3d, 0x0b, 0x7b, 0x45, 0x8a, 0x5b, 0xb7, 0xa2, 0x60,
-  0xbd, 0xce, 0xca, 0x2e, 0x86, 0x1d, 0x83, 0x9f, 0xa0, 0x5e, 0xd9, 0x63,
-  0x7c, 0x76, 0xc4, 0xed, 0xb0, 0x7f, 0xb9, 0x13, 0x22, 0xff, 0x30, 0x1f,
-  0xbc, 0xe1, 0x79, 0xcf, 0x52, 0x44, 0x27, 0xdf, 0x3a, 0x94, 0x88, 0xbe,
-  0xbc, 0xaf, 0xcf, 0x52, 0xed, 0x7b, 0x5f, 0xd9, 0x06, 0x22, 0xbf, 0x3b,
-  0xd6, 0xaf, 0x21, 0x4c, 0x7c, 0x34, 0x6c, 0xa0, 0x98, 0xc0, 0x77, 0x3e,
-  0x97, 0xf1, 0x12, 0x71, 0xde, 0xa7, 0x63, 0x79, 0x20, 0xd2, 0x6d, 0xf1,
-  0x23, 0xf7, 0xe3, 0xbc, 0xed, 0x76, 0xb7, 0x79, 0xe1, 0xcb, 0x7d, 0x76,
-  0x44, 0x53, 0x22, 0x00, 0x56, 0xd7, 0xba, 0xd7, 0xc5, 0x2f, 0xf9, 0x25,
-  0x81, 0x49, 0xf1, 0x50, 0xae, 0x78, 0x07, 0xe2, 0x5e, 0x82, 0x15, 0xfb,
-  0xc5, 0xee, 0x63, 0xfe, 0xbe, 0xb7, 0xdf, 0x7b, 0x24, 0x71, 0x92, 0x8b,
-  0xdc, 0xe3, 0xc2, 0x1f, 0x39, 0xca, 0x49, 0x24, 0x76, 0x9a, 0x52, 0xfe,
-  0xf2, 0x8b, 0x36, 0x36, 0xa3, 0x15, 0x4e, 0x76, 0xce, 0xb2, 0x1c, 0xf5,
-  0x91, 0x3d, 0x37, 0xef, 0xb7, 0x3c, 0x1f, 0xda, 0x17, 0x38, 0xc7, 0xba,
-  0x66, 0x8f, 0xaf, 0x99, 0xe4, 0x6c, 0x69, 0x83, 0x36, 0xe6, 0x37, 0x12,
-  0x81, 0xd3, 0x7e, 0xf0, 0xf3, 0x14, 0x64, 0xd0, 0x36, 0x89, 0xe7, 0x61,
-  0xf5, 0x77, 0x35, 0xd9, 0xa7, 0x7f, 0x64, 0xd4, 0x33, 0xd8, 0x92, 0x12,
-  0x00, 0x18, 0x80, 0x26, 0x33, 0x80, 0x04, 0xc8, 0x7e, 0x00, 0xe3, 0x7c,
-  0x42, 0x41, 0x14, 0x50, 0x53, 0x4a, 0xac, 0x82, 0x39, 0x0d, 0xe8, 0x11,
-  0x18, 0xa3, 0x4f, 0xfb, 0xc7, 0x2f, 0x13, 0x48, 0x32, 0x05, 0x63, 0x81,
-  0x09, 0xe3, 0x79, 0x25, 0x11, 0x32, 0xbb, 0x32, 0x32, 0xe5, 0xd1, 0x2e,
-  0x20, 0x08, 0x2f, 0xc7, 0x23, 0x33, 0x2c, 0x57, 0x2f, 0x15, 0x83, 0x2f,
-  0xbc, 0x27, 0x73, 0x1e, 0xb3, 0x12, 0x15, 0xc8, 0x82, 0xe3, 0x82, 0x81,
-  0x24, 0x01, 0x83, 0x9b, 0x22, 0x83, 0x3e, 0xc1, 0x32, 0x24, 0x32, 0x7f,
-  0x38, 0x68, 0x7f, 0x2f, 0x01, 0x2d, 0x3c, 0x78, 0x82, 0xd6, 0xd2, 0x2f,
-  0xdf, 0x52, 0x32, 0x42, 0xd8, 0x03, 0x44, 0x58, 0x84, 0xdd, 0x42, 0x34,
-  0x48, 0xe8, 0x12, 0x4a, 0xb8, 0x84, 0x21, 0xc8, 0x2c, 0x39, 0xf8, 0x11,
-  0xb0, 0x22, 0x85, 0x88, 0xf1, 0x83, 0x2a, 0x01, 0x2a, 0xc2, 0xf2, 0x27,
-  0xc4, 0x92, 0x12, 0x46, 0xc8, 0x2b, 0x07, 0x48, 0x20, 0xc6, 0xe2, 0x4e,
-  0x28, 0xe7, 0x2a, 0x26, 0xd1, 0x28, 0x66, 0xc8, 0x1a, 0x92, 0xe2, 0x7f,
-  0x25, 0xa1, 0x86, 0x6b, 0x08, 0x28, 0x64, 0x02, 0x32, 0x5b, 0x08, 0x30,
-  0x5d, 0x58, 0x2a, 0x7b, 0xa1, 0x75, 0xfe, 0x6f, 0x63, 0x87, 0xaf, 0x62,
-  0x1c, 0xc3, 0x90, 0x87, 0x89, 0xb1, 0x18, 0x8d, 0xf1, 0x2b, 0x18, 0xf2,
-  0x87, 0x5e, 0xd2, 0x86, 0x2a, 0x91, 0x27, 0x78, 0x72, 0x27, 0xea, 0xe0,
-  0x12, 0x84, 0xf2, 0x19, 0x88, 0x48, 0x45, 0x8a, 0x88, 0x12, 0x4e, 0x42,
-  0x70, 0x72, 0xf2, 0x1a, 0x31, 0x92, 0x12, 0x3c, 0xd2, 0x25, 0x6b, 0x38,
-  0x26, 0x42, 0xe2, 0x12, 0x98, 0x88, 0x25, 0x9a, 0xa8, 0x1f, 0xf4, 0x10,
-  0x1c, 0x9f, 0x98, 0x28, 0xcd, 0xe2, 0x26, 0x8c, 0x28, 0x4b, 0xa5, 0x08,
-  0x23, 0x2d, 0xc1, 0x27, 0x3f, 0xc2, 0x21, 0x96, 0xb8, 0x12, 0x59, 0x52,
-  0x23, 0x11, 0x12, 0x8b, 0x2d, 0x51, 0x24, 0x74, 0xc8, 0x26, 0x4c, 0xc2,
-  0x12, 0x05, 0x42, 0x8a, 0xeb, 0x41, 0x25, 0x92, 0x98, 0x21, 0xbf, 0x18,
-  0x8c, 0xc2, 0x68, 0x25, 0x16, 0x40, 0x8c, 0x37, 0x32, 0x21, 0x9b, 0x78,
-  0x8c, 0xf4, 0x90, 0x75, 0x74, 0x18, 0x8a, 0x04, 0x62, 0x1c, 0xe7, 0x11,
-  0x27, 0xcf, 0x78, 0x8a, 0x7b, 0x82, 0x15, 0xba, 0x71, 0x1f, 0xbc, 0x91,
-  0x1f, 0x37, 0xf1, 0x1e, 0xf2, 0xf1, 0x8e, 0xf4, 0xc1, 0x8d, 0xde, 0xe8,
-  0x2e, 0x01, 0xb2, 0x8c, 0x29, 0x62, 0x1c, 0xca, 0x51, 0x46, 0x0b, 0x52,
-  0x21, 0xe8, 0x78, 0x1f, 0xdb, 0x21, 0x28, 0x2c, 0x11, 0x1d, 0xea, 0x40,
-  0x1b, 0xd3, 0x11, 0x17, 0x3a, 0x01, 0x61, 0x28, 0x81, 0x8c, 0xe1, 0x31,
-  0x1e, 0x4e, 0x18, 0x7d, 0xf8, 0xa8, 0x8f, 0x53, 0x62, 0x8e, 0x9f, 0xd2,
-  0x8f, 0xeb, 0xc8, 0x1d, 0x6d, 0x21, 0x1d, 0xd3, 0x31, 0x19, 0x54, 0xc1,
-  0x8d, 0xb4, 0x98, 0x2a, 0x0c, 0x49, 0x17, 0x84, 0x61, 0x18, 0x51, 0x32,
-  0x27, 0x91, 0x58, 0x1f, 0x58, 0x71, 0x19, 0xec, 0xf8, 0x14, 0x90, 0x11,
-  0x19, 0x1a, 0xb9, 0x19, 0x9d, 0xe1, 0x89, 0x68, 0x42, 0x5b, 0x1a, 0x0d,
-  0x29, 0x8a, 0x31, 0x71, 0x18, 0x68, 0xb1, 0x87, 0x55, 0x61, 0x17, 0x29,
-  0x59, 0x15, 0x2b, 0xd9, 0x92, 0x42, 0x61, 0x2a, 0xa8, 0xf2, 0x17, 0x81,
-  0x21, 0x18, 0x83, 0xc1, 0x66, 0x34, 0x31, 0x93, 0x24, 0x61, 0x17, 0x00,
-  0xa9, 0x92, 0x58, 0xb2, 0x91, 0x1d, 0x88, 0x40, 0x43, 0x49, 0x94, 0x45,
-  0xc9, 0x41, 0x29, 0x98, 0x93, 0x4b, 0xc9, 0x93, 0x52, 0xe1, 0x94, 0x33,
-  0x88, 0x6f, 0x48, 0x29, 0x95, 0x5e, 0xf9, 0x95, 0x60, 0x19, 0x96, 0x62,
-  0x39, 0x96, 0x64, 0x59, 0x96, 0x66, 0x79, 0x96, 0x68, 0x99, 0x96, 0x6a,
-  0xb9, 0x96, 0x60, 0x19, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x01, 0x14, 0x00,
-  0xff, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-  0x08, 0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08,
-  0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x4a, 0x9c,
-  0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3,
-  0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28,
-  0x53, 0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0x45, 0x28, 0xe8, 0x62, 0xca, 0x84,
-  0xe2, 0x12, 0xa1, 0x0e, 0x6e, 0x38, 0xb9, 0xe9, 0xa8, 0xd9, 0x10, 0x09,
-  0x12, 0x9e, 0x08, 0x61, 0xca, 0x8c, 0x49, 0x13, 0xe8, 0x42, 0x2d, 0x43,
-  0x87, 0x16, 0x35, 0x7a, 0x33, 0x27, 0xce, 0x9d, 0x46, 0x0f, 0x22, 0x29,
-  0x57, 0xee, 0x67, 0x54, 0x81, 0x42, 0x93, 0xa2, 0xd3, 0x72, 0xf5, 0x20,
-  0x52, 0x74, 0xb8, 0x1e, 0x3d, 0x8a, 0xb4, 0xc8, 0x56, 0x4c, 0xae, 0x40,
-  0x9b, 0x8a, 0xa1, 0x40, 0x41, 0xcc, 0xd3, 0xae, 0x03, 0xa7, 0x52, 0xad,
-  0x7a, 0xf5, 0xab, 0xad, 0x45, 0x91, 0xc4, 0xe2, 0x3a, 0x0b, 0x77, 0xa0,
-  0x96, 0x74, 0x60, 0xc5, 0x8e, 0x5d, 0x24, 0x28, 0x15, 0xdf, 0x9a, 0x6a,
-  0xd9, 0xb2, 0x75, 0xab, 0x13, 0xae, 0x5c, 0x44, 0x88, 0xa8, 0x5a, 0xe5,
-  0xf9, 0x35, 0x95, 0x20, 0xbc, 0x82, 0xf7, 0xa6, 0x43, 0xdb, 0xf5, 0x6f,
-  0xba, 0xb0, 0x82, 0xc9, 0x0a, 0x2a, 0x1c, 0x13, 0x31, 0xce, 0xb5, 0x8a,
-  0x17, 0xbf, 0x8d, 0x2a, 0xd7, 0xd0, 0x92, 0x25, 0x86, 0x24, 0x03, 0x8d,
-  0x69, 0xf9, 0x72, 0xde, 0xcc, 0xe9, 0x36, 0x77, 0xce, 0x8d, 0x6b, 0x12,
-  0x1e, 0x64, 0xf6, 0xea, 0xd5, 0x9b, 0x36, 0x5a, 0x50, 0xe9, 0x96, 0x89,
-  0x53, 0x2b, 0x66, 0x0c, 0x95, 0x67, 0xeb, 0x25, 0x2e, 0x5c, 0xc0, 0x96,
-  0x5d, 0x33, 0x66, 0xf1, 0x69, 0xc2, 0xed, 0x21, 0xc3, 0x33, 0x09, 0x57,
-  0x6e, 0xce, 0x94, 0x73, 0xfe, 0xbf, 0xfa, 0xf4, 0xdb, 0x5e, 0x70, 0xe1,
-  0xc5, 0x8f, 0xb3, 0xc4, 0x89, 0xc5, 0x82, 0xfb, 0xf7, 0xf0, 0xb1, 0xe0,
-  0x04, 0xfa, 0xdc, 0x05, 0x2c, 0x58, 0xd2, 0x63, 0xd3, 0x75, 0x69, 0x7d,
-  0xb4, 0xf0, 0x7a, 0xe6, 0x6d, 0xf7, 0xc9, 0x2b, 0xdf, 0x01, 0xe5, 0xd9,
-  0x2b, 0x98, 0x10, 0x02, 0x9c, 0x79, 0xff, 0xa5, 0x87, 0x8e, 0x4b, 0x38,
-  0xbd, 0x77, 0x8a, 0x3a, 0x14, 0xaa, 0x73, 0xca, 0x7b, 0xf3, 0xd5, 0xd4,
-  0x1a, 0x13, 0x2c, 0xc0, 0x02, 0x0f, 0x3c, 0xb0, 0xb0, 0xc0, 0x84, 0x7e,
-  0x93, 0xad, 0xd4, 0x9f, 0x20, 0xff, 0x99, 0xa7, 0x1d, 0x21, 0x98, 0x10,
-  0xa8, 0x9b, 0x4b, 0x07, 0x6e, 0xa2, 0xa0, 0x8a, 0xe7, 0xd5, 0xe3, 0xa0,
-  0x4b, 0xdf, 0x7c, 0xe3, 0xde, 0x84, 0x15, 0x52, 0x78, 0xa1, 0x05, 0x39,
-  0x6a, 0x48, 0x95, 0x21, 0x1c, 0x7a, 0xf8, 0x21, 0x88, 0x22, 0x92, 0xd8,
-  0xd2, 0x89, 0x29, 0xaa, 0x88, 0x0c, 0x21, 0x9b, 0xb8, 0x08, 0x5e, 0x4a,
-  0x9e, 0xd5, 0x22, 0x23, 0x32, 0xf8, 0xd0, 0x28, 0x1c, 0x71, 0xa4, 0x3d,
-  0xd8, 0x52, 0x8e, 0xee, 0xf5, 0xd8, 0xa3, 0x7b, 0x41, 0xb6, 0x84, 0x04,
-  0x39, 0xe4, 0x18, 0x52, 0x44, 0x87, 0x47, 0x1e, 0x19, 0x62, 0x11, 0x86,
-  0xa0, 0x59, 0x22, 0x4a, 0xb4, 0x8d, 0x86, 0x1d, 0x80, 0x2a, 0xe2, 0xf3,
-  0xe4, 0x26, 0xb5, 0x14, 0xa8, 0x92, 0x16, 0xed, 0xa4, 0x63, 0x25, 0x21,
-  0xcd, 0xe0, 0x93, 0xa5, 0x8a, 0xc3, 0x11, 0x66, 0xd8, 0x56, 0x38, 0xea,
-  0x68, 0x81, 0x98, 0x15, 0x92, 0xf9, 0x8d, 0x99, 0x68, 0xaa, 0xc9, 0x66,
-  0x9b, 0x6e, 0xb2, 0x00, 0xa7, 0x9c, 0x2b, 0x55, 0x76, 0x19, 0x76, 0x34,
-  0x1a, 0xda, 0x0c, 0x94, 0x7d, 0xb6, 0x33, 0x25, 0x49, 0x7f, 0xb5, 0xa3,
-  0x4b, 0x27, 0x84, 0x1a, 0x7a, 0xa8, 0x79, 0xfe, 0xd3, 0x90, 0x65, 0x16,
-  0xa3, 0x8d, 0x6a, 0xa0, 0xc1, 0x3a, 0xb8, 0xe6, 0x8a, 0xab, 0xad, 0x65,
-  0xaa, 0x74, 0x26, 0x39, 0x81, 0xac, 0x69, 0x24, 0xa6, 0x99, 0x16, 0x11,
-  0x08, 0xa7, 0x7f, 0xc6, 0x74, 0x57, 0x24, 0xd3, 0x84, 0x2a, 0x2a, 0x21,
-  0x9d, 0xe8, 0x12, 0xe8, 0xa9, 0x21, 0x79, 0x36, 0x4c, 0x27, 0x8a, 0x14,
-  0xea, 0xaa, 0x8a, 0xd5, 0x8c, 0x35, 0xeb, 0x52, 0x5f, 0x7e, 0x63, 0xab,
-  0xae, 0xba, 0xf2, 0x3a, 0xa9, 0xaf, 0x68, 0x06, 0x7b, 0x29, 0xb1, 0x6d,
-  0xbe, 0x79, 0x2c, 0x39, 0x73, 0x9a, 0x24, 0x94, 0x2d, 0x79, 0x55, 0x93,
-  0xa7, 0xab, 0xcd, 0x28, 0xd2, 0xc9, 0x30, 0x7e, 0x8e, 0x04, 0x68, 0x3a,
-  0xd7, 0x2a, 0xf2, 0x8c, 0xab, 0x86, 0x9a, 0xd7, 0xed, 0x23, 0xb2, 0x10,
-  0x05, 0x54, 0x8e, 0xe3, 0x92, 0xbb, 0xab, 0x06, 0xbd, 0x9e, 0xf4, 0x6b,
-  0x20, 0x3d, 0xa0, 0x30, 0x2c, 0xbb, 0xed, 0xa2, 0xd0, 0xc3, 0xbb, 0xf1,
-  0x96, 0x24, 0x94, 0x2c, 0x62, 0xd9, 0x6b, 0x0f, 0xc1, 0xf8, 0x3c, 0xa3,
-  0x2f, 0xbf, 0xa6, 0xfa, 0xdb, 0x4e, 0x3b, 0x01, 0x0f, 0x4c, 0xb2, 0x3d,
-  0xd9, 0x88, 0x95, 0x30, 0x3a, 0xe0, 0xd6, 0x7a, 0xab, 0xc3, 0xeb, 0x98,
-  0x9b, 0xd2, 0xc4, 0x15, 0x5f, 0x8c, 0x71, 0xc6, 0x1b, 0x23, 0x9b, 0xd2,
-  0xc7, 0x62, 0x65, 0x33, 0x32, 0xc9, 0x26, 0xef, 0xbb, 0x32, 0xb5, 0x1a,
-  0x7d, 0xb1, 0xf2, 0x30, 0xa8, 0x28, 0x42, 0x0d, 0xc9, 0x86, 0xc6, 0xfc,
-  0xc8, 0x5e, 0x34, 0x47, 0xc5, 0xf0, 0xcd, 0x0e, 0xeb, 0x2c, 0x71, 0xba,
-  0x3d, 0xff, 0xfc, 0x33, 0x2c, 0x1a, 0x73, 0xbc, 0x92, 0x50, 0xa0, 0x65,
-  0x43, 0x35, 0x3e, 0xd4, 0x28, 0x82, 0xca, 0x30, 0x2b, 0x7f, 0xf1, 0x11,
-  0xa0, 0x2c, 0x47, 0xed, 0x32, 0xc9, 0xd9, 0x4c, 0x72, 0xb5, 0xfe, 0xc2,
-  0x5a, 0x7f, 0x03, 0x02, 0x08, 0x38, 0xaf, 0xf3, 0x77, 0xc4, 0x23, 0xf1,
-  0x6c, 0xb1, 0xd8, 0x62, 0x93, 0x1d, 0x34, 0xbc, 0x67, 0xc7, 0x14, 0xd6,
-  0x24, 0x6a, 0x53, 0x6d, 0xf2, 0xdb, 0x4b, 0x77, 0x44, 0xf7, 0x2f, 0xa6,
-  0x48, 0xbd, 0x76, 0x36, 0x9f, 0x74, 0xc7, 0x77, 0xdf, 0x7f, 0x07, 0x3e,
-  0xf8, 0xb9, 0x24, 0xfd, 0xda, 0x47, 0xc5, 0xac, 0x20, 0x8e, 0x38, 0x2b,
-  0x1a, 0xf7, 0x21, 0x34, 0x4a, 0x68, 0x4f, 0xf2, 0x49, 0xe4, 0x24, 0xb7,
-  0x6d, 0xca, 0x2f, 0x95, 0x6b, 0x74, 0x79, 0xe6, 0x53, 0x53, 0x9d, 0x0d,
-  0x26, 0x9f, 0x60, 0xcd, 0x74, 0x47, 0x3a, 0xe4, 0x68, 0xfc, 0x37, 0xcd,
-  0x19, 0x94, 0x63, 0xe8, 0x38, 0x8f, 0x9e, 0x50, 0xf1, 0xc7, 0x23, 0x4f,
-  0x91, 0xe9, 0x3b, 0xa0, 0x90, 0xfa, 0xcf, 0xb9, 0xa0, 0x80, 0x42, 0x2e,
-  0x62, 0xb3, 0xbe, 0x83, 0xeb, 0x8c, 0x27, 0x0b, 0xd6, 0x27, 0x98, 0xd0,
-  0x4e, 0xb0, 0xed, 0xb8, 0xa7, 0x8c, 0xd1, 0xe5, 0xaa, 0x48, 0x9d, 0x8f,
-  0xef, 0x9b, 0x00, 0x4f, 0x0c, 0xad, 0x23, 0x41, 0x1f, 0xbd, 0xf4, 0x07,
-  0x2d, 0x0f, 0xc2, 0x28, 0x0e, 0x8f, 0xe2, 0xfc, 0x41, 0xf6, 0x8b, 0x5e,
-  0xf2, 0x1c, 0x62, 0x3a, 0x1b, 0x8c, 0xe0, 0x7a, 0x18, 0xcb, 0xc5, 0x01,
-  0x59, 0x31, 0x02, 0xee, 0xfd, 0x8c, 0x81, 0x36, 0x00, 0x5f, 0xc7, 0x50,
-  0x85, 0x0e, 0x62, 0x90, 0x6f, 0x13, 0xe6, 0x33, 0x54, 0x3e, 0xda, 0xa6,
-  0x8a, 0xf4, 0x0d, 0xcf, 0x21, 0x4e, 0x6b, 0xc7, 0x2f, 0xda, 0x47, 0x8d,
-  0x7c, 0xbc, 0x8f, 0x64, 0x9b, 0x88, 0x5f, 0xf0, 0xb4, 0xc2, 0x42, 0x74,
-  0x9c, 0xe3, 0x1c, 0x2e, 0x7c, 0xa1, 0x0c, 0x93, 0xe0, 0x10, 0xe8, 0xa9,
-  0xa1, 0x04, 0x38, 0x2c, 0x81, 0x1a, 0x72, 0x34, 0x40, 0x81, 0xe4, 0x08,
-  0x87, 0xfe, 0x15, 0xe0, 0x5f, 0xae, 0x46, 0x51, 0x01, 0x1c, 0x12, 0x4e,
-  0x20, 0x36, 0xcc, 0xa1, 0x0e, 0x79, 0x08, 0x91, 0x02, 0x1e, 0x50, 0x6c,
-  0x0a, 0xbc, 0x1e, 0x03, 0x1d, 0x88, 0x31, 0x08, 0x4a, 0x90, 0x22, 0x49,
-  0x90, 0xa1, 0x0c, 0x63, 0xd8, 0x42, 0xad, 0xe0, 0xe2, 0x82, 0x9b, 0xa0,
-  0x9a, 0x09, 0x39, 0x98, 0x3e, 0xb9, 0x51, 0xe4, 0x0b, 0xef, 0x10, 0xe1,
-  0x2b, 0x2c, 0x51, 0x42, 0x13, 0x52, 0x2d, 0x85, 0xc0, 0xeb, 0x0e, 0x38,
-  0xba, 0x28, 0x93, 0x17, 0xc6, 0x50, 0x8b, 0xe7, 0xa0, 0xe1, 0x42, 0x92,
-  0xa8, 0xc4, 0x25, 0xe2, 0x8f, 0x20, 0x3f, 0x04, 0x62, 0x29, 0xd8, 0xc1,
-  0x8e, 0x52, 0x14, 0xd1, 0x88, 0xa4, 0x1b, 0x08, 0x1f, 0x95, 0xb8, 0xc3,
-  0x3f, 0x2e, 0xc4, 0x74, 0x33, 0x78, 0x22, 0xf6, 0x24, 0xf9, 0xa1, 0x29,
-  0x76, 0x6f, 0x04, 0x33, 0xb8, 0x62, 0x44, 0xb2, 0x88, 0x47, 0x18, 0xda,
-  0x91, 0x8e, 0xe8, 0x00, 0x47, 0x6f, 0xc0, 0x28, 0xc6, 0x31, 0x5a, 0xe2,
-  0x15, 0xb8, 0x7b, 0x87, 0x19, 0x23, 0x82, 0xc6, 0x77, 0x14, 0x63, 0x8d,
-  0x6d, 0x74, 0x23, 0x0a, 0x55, 0xa8, 0xb7, 0xd0, 0x10, 0xa6, 0x38, 0x80,
-  0x00, 0x04, 0x1f, 0xf8, 0x20, 0x87, 0x5e, 0xf6, 0x72, 0x0e, 0xc0, 0x8c,
-  0xc4, 0x0b, 0xf5, 0x98, 0x90, 0x70, 0x84, 0xe3, 0x86, 0x7d, 0xc4, 0xa1,
-  0x1a, 0x8c, 0x39, 0x40, 0x63, 0xe2, 0x90, 0x1d, 0xae, 0xa8, 0xc0, 0x02,
-  0x16, 0x50, 0x01, 0x57, 0xb0, 0x03, 0x87, 0xc6, 0x2c, 0x88, 0x0e, 0x8c,
-  0x89, 0xcc, 0x64, 0x2e, 0x33, 0x1c, 0x3d, 0x41, 0x13, 0x1c, 0x22, 0x89,
-  0xc0, 0x36, 0xe5, 0x62, 0x06, 0xe8, 0x9c, 0x41, 0x39, 0x2b, 0x99, 0xce,
-  0x19, 0x50, 0xb1, 0x4d, 0x0c, 0x9c, 0x01, 0x1c, 0x5e, 0xc7, 0x10, 0x4e,
-  0x46, 0x02, 0x98, 0x73, 0xfe, 0xf0, 0x65, 0x2f, 0x77, 0x99, 0xcb, 0xe2,
-  0xd8, 0x46, 0x30, 0x8f, 0x90, 0x1d, 0x26, 0x52, 0x58, 0x4a, 0x53, 0xbe,
-  0xa2, 0x18, 0xef, 0x50, 0x25, 0x2b, 0x13, 0xfa, 0x4a, 0x36, 0x9a, 0xf0,
-  0xa1, 0x78, 0x83, 0x63, 0xe7, 0x00, 0x2a, 0x1a, 0x5c, 0xea, 0x92, 0x97,
-  0xfa, 0xc4, 0xe7, 0x1c, 0x84, 0x99, 0x47, 0x85, 0x18, 0x33, 0x05, 0x20,
-  0xb5, 0x26, 0x21, 0x5d, 0x01, 0xd2, 0x6f, 0x26, 0xef, 0xa3, 0x29, 0x18,
-  0x69, 0x48, 0x09, 0x09, 0xd2, 0x6c, 0x2a, 0x92, 0x9b, 0x2b, 0x55, 0x69,
-  0x4b, 0xc1, 0xf9, 0x48, 0x63, 0xc2, 0xa1, 0x05, 0x1e, 0x58, 0xe7, 0x87,
-  0x72, 0xd1, 0x82, 0x9e, 0xf6, 0x14, 0x63, 0x3e, 0xed, 0xe9, 0x3b, 0x8f,
-  0xc4, 0x0a, 0x0f, 0xb4, 0x00, 0x0e, 0xc6, 0x9c, 0xa0, 0x41, 0xec, 0xa9,
-  0x51, 0x7d, 0xca, 0x81, 0x9f, 0x80, 0xf0, 0x27, 0x66, 0x04, 0x23, 0xd0,
-  0x14, 0x66, 0xf0, 0xa1, 0x06, 0x45, 0xa8, 0x42, 0x41, 0xc8, 0xd0, 0x58,
-  0x38, 0x14, 0xab, 0x27, 0x34, 0x94, 0x36, 0x5a, 0x55, 0x30, 0x44, 0x35,
-  0xa8, 0x0d, 0xc2, 0xa0, 0x87, 0x5a, 0xe7, 0xc1, 0xd6, 0xb6, 0xce, 0x63,
-  0x19, 0xf8, 0xe4, 0x28, 0x31, 0x0d, 0x82, 0xd2, 0x94, 0x12, 0x52, 0xa6,
-  0x79, 0x60, 0xe6, 0x40, 0x50, 0x7a, 0xd7, 0xbe, 0xb2, 0x63, 0xa6, 0x2f,
-  0x0d, 0x47, 0x1e, 0x62, 0x7a, 0x57, 0x90, 0xa6, 0xc0, 0xa5, 0x09, 0x41,
-  0x82, 0x4d, 0x71, 0xaa, 0x53, 0x78, 0xcc, 0x22, 0xa8, 0x3f, 0x65, 0x17,
-  0x64, 0x5b, 0x30, 0x0b, 0x76, 0x15, 0xf5, 0xa8, 0x49, 0xad, 0xe7, 0x0b,
-  0xef, 0x09, 0xcc, 0x65, 0xb8, 0xb5, 0xad, 0x6a, 0xa5, 0x87, 0x30, 0xda,
-  0x80, 0xa2, 0x26, 0x99, 0x07, 0x5f, 0x84, 0xd0, 0x06, 0xc1, 0xc0, 0xba,
-  0x41, 0x4b, 0xc4, 0x42, 0xab, 0xab, 0x54, 0xfe, 0x48, 0x2b, 0x8b, 0xe1,
-  0xd5, 0x58, 0x62, 0xd5, 0x55, 0xda, 0xc8, 0x16, 0xc1, 0xb4, 0xb4, 0x25,
-  0xb4, 0x86, 0x96, 0x1e, 0x9f, 0x6d, 0x2b, 0x5c, 0xe7, 0x90, 0x06, 0xb9,
-  0x22, 0xc4, 0x98, 0x22, 0x48, 0xae, 0x5f, 0xa1, 0x99, 0x5c, 0x30, 0xe8,
-  0x15, 0x00, 0xc8, 0x15, 0xc1, 0x72, 0x09, 0x99, 0x5c, 0x97, 0x6e, 0x33,
-  0x1c, 0x60, 0x48, 0xae, 0x48, 0xfb, 0x9a, 0x5c, 0x11, 0x20, 0x56, 0x2a,
-  0x8b, 0xcd, 0xa9, 0x3b, 0xc6, 0x4b, 0x5e, 0x77, 0x3c, 0x76, 0xb2, 0xe5,
-  0x2d, 0xef, 0x64, 0x29, 0x9b, 0xde, 0xf1, 0x5e, 0x16, 0xa9, 0xe1, 0x50,
-  0x2a, 0x00, 0xec, 0x99, 0x86, 0xce, 0x06, 0x97, 0xad, 0xbf, 0x1d, 0xed,
-  0x9d, 0xf0, 0x74, 0x5a, 0x7c, 0x29, 0x42, 0xb5, 0x1a, 0x64, 0x2d, 0x35,
-  0x5c, 0x0b, 0xdb, 0x85, 0xcc, 0x36, 0x16, 0x9a, 0xb0, 0xed, 0x6d, 0xf1,
-  0x91, 0xdb, 0xbb, 0x95, 0x95, 0x41, 0xc3, 0x41, 0x6b, 0x3d, 0x7e, 0x7b,
-  0x5f, 0xb6, 0x02, 0x33, 0x0d, 0xc5, 0x7d, 0xe1, 0x71, 0xc3, 0xd1, 0xdd,
-  0xe9, 0xce, 0x22, 0xb9, 0x76, 0xd0, 0x6b, 0x74, 0xa7, 0xcb, 0x8e, 0xea,
-  0x82, 0xf3, 0xba, 0x76, 0x48, 0xee, 0x2c, 0xa6, 0xdb, 0xdd, 0xef, 0x16,
-  0x44, 0xb1, 0xe1, 0xb8, 0xa9, 0x78, 0xdb, 0x7b, 0x5e, 0x38, 0x90, 0xe2,
-  0xa6, 0x3d, 0x6d, 0xef, 0x78, 0x7d, 0x6a, 0x63, 0x1c, 0xcf, 0x42, 0xc7,
-  0xef, 0xcd, 0x2c, 0x42, 0x36, 0x8b, 0x61, 0x60, 0x56, 0x78, 0x1e, 0xbf,
-  0xad, 0x87, 0x7e, 0xb3, 0x73, 0x2f, 0x57, 0x99, 0x0c, 0xc0, 0xac, 0x1d,
-  0xa3, 0x26, 0x5e, 0x9b, 0xd0, 0xd8, 0x16, 0xe4, 0xc0, 0x09, 0x8e, 0xb2,
-  0x2c, 0x05, 0x46, 0x35, 0xde, 0x2e, 0x62, 0x0b, 0xc2, 0xa1, 0x70, 0x85,
-  0x2f, 0x8c, 0x61, 0x0d, 0x1f, 0xc4, 0x98, 0xd9, 0x15, 0xc1, 0xfe, 0x20,
-  0x97, 0xfb, 0x61, 0x11, 0x84, 0x38, 0x1c, 0xdb, 0x94, 0x86, 0x72, 0x59,
-  0x2c, 0x02, 0x69, 0xc0, 0xd9, 0x98, 0x29, 0x16, 0xc1, 0x8a, 0x97, 0x5b,
-  0x8a, 0xe6, 0xba, 0x38, 0xb0, 0x76, 0x30, 0x81, 0x07, 0x4a, 0xa1, 0xe3,
-  0x59, 0x98, 0xc0, 0x04, 0x6f, 0x0e, 0x47, 0xa0, 0x4d, 0xa0, 0x63, 0x77,
-  0x1c, 0x3a, 0xd1, 0x8b, 0xfe, 0x71, 0x7b, 0x4b, 0xe1, 0x01, 0x44, 0x3f,
-  0xd7, 0x20, 0x2f, 0xc4, 0x70, 0x7d, 0xe7, 0x70, 0xe4, 0x24, 0xd7, 0x63,
-  0x0b, 0x8b, 0x60, 0x72, 0x7f, 0x09, 0x66, 0xb2, 0x00, 0x47, 0x99, 0x1a,
-  0x53, 0x2e, 0xf0, 0x41, 0xb0, 0xac, 0xe0, 0x05, 0x73, 0xf9, 0x65, 0x66,
-  0xfd, 0x72, 0x98, 0x43, 0x7b, 0x64, 0x32, 0xa7, 0xc1, 0xcc, 0x06, 0x41,
-  0xb1, 0xa0, 0x09, 0x4d, 0xe3, 0x47, 0x1b, 0x53, 0xd1, 0x87, 0x6e, 0xb4,
-  0xaf, 0xf1, 0x7c, 0x68, 0x49, 0xa7, 0x97, 0xd2, 0x96, 0x86, 0xf3, 0x86,
-  0xd3, 0xbc, 0x66, 0xbf, 0xb6, 0xf9, 0xcd, 0x71, 0x9e, 0xf3, 0x72, 0x93,
-  0x6b, 0x67, 0x14, 0xab, 0x78, 0xba, 0x7d, 0x16, 0x81, 0x73, 0x69, 0x8a,
-  0xe9, 0x73, 0x68, 0xda, 0xc8, 0x15, 0xf6, 0x34, 0xa8, 0x45, 0x7d, 0x34,
-  0x52, 0x2b, 0xc2, 0xd4, 0x02, 0x4e, 0x75, 0x95, 0x13, 0xc2, 0x6a, 0x2d,
-  0x8b, 0xf5, 0xd5, 0xdb, 0x32, 0xeb, 0x34, 0x24, 0x2c, 0xe6, 0xfb, 0x92,
-  0x99, 0xa3, 0x89, 0x0d, 0x2f, 0x2b, 0x0a, 0xdd, 0xd3, 0x1e, 0xfb, 0xb4,
-  0xd1, 0x3c, 0xbe, 0x71, 0x4f, 0x8d, 0x5d, 0xde, 0x20, 0xc7, 0xb7, 0x98,
-  0x1c, 0x96, 0x76, 0x5f, 0x9f, 0x2d, 0xe2, 0x84, 0x93, 0xd8, 0xc4, 0x00,
-  0xb0, 0xb6, 0x9e, 0xe9, 0xec, 0x5d, 0x6e, 0x17, 0x84, 0xc8, 0x9b, 0xee,
-  0x74, 0x68, 0x95, 0xdc, 0x86, 0x3b, 0x39, 0xcb, 0xc9, 0xff, 0x45, 0x37,
-  0x56, 0xfe, 0x51, 0x4d, 0xe5, 0xad, 0xb2, 0xbb, 0xab, 0x5f, 0x05, 0x2b,
-  0x6e, 0x75, 0x1b, 0x6f, 0x08, 0x47, 0x38, 0xad, 0xb4, 0xbe, 0xef, 0x70,
-  0x33, 0xdc, 0xd1, 0x7c, 0xc7, 0x98, 0xb1, 0xfc, 0x46, 0xaf, 0x8e, 0xd7,
-  0x4b, 0x70, 0xf2, 0x1a, 0x5c, 0xbe, 0xd1, 0x95, 0xae, 0x5f, 0x5d, 0xe1,
-  0x67, 0x65, 0x43, 0xd7, 0xe1, 0x74, 0xb6, 0x2e, 0x9a, 0xb5, 0x3b, 0x6d,
-  0x88, 0x1f, 0x84, 0xbe, 0xf6, 0xbd, 0x6f, 0x7e, 0x3b, 0x6e, 0xda, 0x72,
-  0xe3, 0x23, 0x5f, 0x00, 0xc6, 0xc7, 0xa9, 0x09, 0xbc, 0x6e, 0x86, 0x1c,
-  0x38, 0xe5, 0x10, 0xc5, 0x2d, 0x59, 0x5f, 0x55, 0x23, 0x1b, 0xf9, 0x76,
-  0xad, 0xc1, 0x1d, 0xee, 0x46, 0x87, 0xc9, 0x10, 0x18, 0xcb, 0xb8, 0xb1,
-  0xe7, 0x0d, 0x2a, 0x50, 0x21, 0x5b, 0x59, 0x62, 0xfd, 0x7c, 0x21, 0x75,
-  0x1d, 0x3a, 0x48, 0xf3, 0x6a, 0xf4, 0xa3, 0x83, 0x94, 0xc4, 0x80, 0x45,
-  0xa2, 0x31, 0x07, 0x9b, 0x82, 0xed, 0xb2, 0x34, 0xf0, 0x4f, 0xdf, 0x2c,
-  0x3e, 0x3d, 0x1b, 0xdc, 0xd0, 0x8e, 0xb6, 0xb4, 0xe4, 0x46, 0x6d, 0xd6,
-  0xb5, 0x0e, 0xd6, 0x01, 0x97, 0xdc, 0xca, 0xb2, 0x65, 0x28, 0x2c, 0x55,
-  0x4e, 0xb0, 0x6c, 0x48, 0xb4, 0x96, 0x62, 0xa9, 0xe8, 0x68, 0x72, 0xb9,
-  0x4b, 0xa7, 0x6a, 0xd4, 0xb8, 0x3d, 0xd1, 0x37, 0xbb, 0x78, 0x2a, 0x77,
-  0xc9, 0x06, 0x75, 0xa8, 0x95, 0x34, 0x2a, 0x7c, 0xe5, 0x2b, 0x90, 0xba,
-  0x6e, 0x97, 0xa4, 0x29, 0x30, 0x29, 0x41, 0xf8, 0x0a, 0xcd, 0x98, 0x22,
-  0x3e, 0xe2, 0x30, 0x2d, 0xfc, 0x5d, 0x71, 0x7f, 0x58, 0x8b, 0x2f, 0x55,
-  0xf1, 0xf8, 0x74, 0x2a, 0x54, 0xa5, 0x7a, 0x1b, 0xb1, 0x54, 0x15, 0x83,
-  0x24, 0xab, 0xfc, 0x29, 0x55, 0xfd, 0x90, 0xd9, 0x6e, 0x3e, 0xec, 0x04,
-  0xfb, 0x3c, 0x45, 0x6f, 0xfe, 0x39, 0xfa, 0x8b, 0x9a, 0x3e, 0x98, 0x6c,
-  0x7f, 0xc8, 0xaf, 0xc6, 0x49, 0x49, 0x73, 0xb6, 0x53, 0xa7, 0xac, 0x68,
-  0x27, 0xec, 0xe1, 0x11, 0xcf, 0x79, 0x86, 0x0f, 0xef, 0xc7, 0x4c, 0xa6,
-  0x32, 0x2f, 0x5d, 0xfb, 0x70, 0x3c, 0x33, 0x9a, 0xd3, 0xac, 0xe6, 0x35,
-  0x4b, 0xe0, 0xe2, 0xeb, 0x76, 0xb3, 0x8f, 0xdf, 0xb4, 0x10, 0x4c, 0x05,
-  0x4c, 0xca, 0xc7, 0x07, 0xfd, 0x54, 0x1c, 0x53, 0xe5, 0x7c, 0xa4, 0x14,
-  0x7d, 0x0f, 0x35, 0x60, 0x07, 0xd5, 0x75, 0x0b, 0xa5, 0x46, 0x29, 0xf7,
-  0x46, 0xb4, 0x84, 0x0b, 0x73, 0x04, 0x4a, 0x76, 0xd4, 0x49, 0x35, 0xd7,
-  0x44, 0x68, 0xd2, 0x07, 0xe4, 0x04, 0x45, 0xe5, 0x67, 0x49, 0x0f, 0x84,
-  0x49, 0x9a, 0xc4, 0x10, 0x8b, 0x94, 0x43, 0x8d, 0xd4, 0x43, 0x81, 0x54,
-  0x02, 0x15, 0xb0, 0x66, 0x86, 0x94, 0x43, 0x47, 0x74, 0x82, 0xca, 0xc4,
-  0x44, 0x02, 0xa8, 0x81, 0x5c, 0x04, 0x4a, 0xa2, 0xf4, 0x7c, 0x05, 0xe5,
-  0x80, 0xa9, 0x84, 0x79, 0xd5, 0xb7, 0x32, 0x23, 0xe4, 0x3e, 0x61, 0xe5,
-  0x2a, 0x12, 0x85, 0x35, 0xa0, 0xc4, 0x45, 0x9d, 0x34, 0x57, 0x1c, 0x48,
-  0x0e, 0x7d, 0x60, 0x40, 0x8d, 0x75, 0x24, 0x51, 0x54, 0x49, 0x0d, 0x74,
-  0x49, 0x11, 0x44, 0x4f, 0x7b, 0x94, 0x23, 0xff, 0x97, 0x82, 0xf9, 0xf3,
-  0x0d, 0x40, 0x24, 0x44, 0xb8, 0x42, 0x44, 0x88, 0x04, 0x40, 0x58, 0xc8,
-  0x48, 0x34, 0xa8, 0x59, 0x78, 0x74, 0x83, 0x47, 0xf8, 0x45, 0x03, 0x15,
-  0x46, 0x0c, 0x48, 0x46, 0x71, 0x73, 0x11, 0xec, 0xe3, 0x3e, 0xf0, 0x23,
-  0x3f, 0xf4, 0x83, 0x12, 0x4e, 0xf4, 0x84, 0x3b, 0xb5, 0x40, 0x53, 0x38,
-  0x82, 0x55, 0xf8, 0x7e, 0x0f, 0x11, 0x40, 0xc7, 0xd3, 0x43, 0x3e, 0xe4,
-  0x37, 0xfb, 0xd3, 0x3f, 0xff, 0x93, 0x6b, 0xfe, 0xf7, 0x53, 0x86, 0x22,
-  0x81, 0x14, 0x16, 0x34, 0x50, 0x19, 0xa4, 0x75, 0x6e, 0xa8, 0x3e, 0x70,
-  0x08, 0x84, 0xbc, 0xb3, 0x39, 0xc0, 0x23, 0x3c, 0x2b, 0x41, 0x3d, 0xd6,
-  0x03, 0x45, 0xda, 0xb3, 0x7e, 0x44, 0x85, 0x02, 0xdf, 0x63, 0x85, 0x35,
-  0x74, 0x3f, 0x82, 0x38, 0x88, 0xcc, 0xe3, 0x30, 0x87, 0x88, 0x88, 0x02,
-  0x54, 0x12, 0x5f, 0xa1, 0x86, 0x8f, 0xc8, 0x36, 0x8a, 0x70, 0x3b, 0xb9,
-  0x93, 0x11, 0xbb, 0xa3, 0x39, 0xbe, 0xd3, 0x39, 0x58, 0x53, 0x33, 0x26,
-  0x61, 0x3a, 0xa8, 0xa3, 0x3a, 0xdd, 0xd3, 0x3a, 0xa2, 0xf8, 0x11, 0xfa,
-  0x23, 0x3a, 0x20, 0x70, 0x44, 0x35, 0x11, 0x3b, 0xb3, 0xb3, 0x36, 0xe8,
-  0x33, 0x8b, 0xba, 0xf3, 0x34, 0x76, 0xb3, 0x39, 0x7a, 0x93, 0x8b, 0x99,
-  0x08, 0x36, 0x87, 0xe3, 0x8b, 0xc4, 0xa2, 0x38, 0x66, 0x63, 0x12, 0xc3,
-  0xd8, 0x3c, 0xc5, 0x98, 0x48, 0x3c, 0x81, 0x36, 0x01, 0xf5, 0x8a, 0x93,
-  0x03, 0x37, 0x92, 0xc8, 0x11, 0x21, 0x04, 0x35, 0xb6, 0x88, 0x37, 0x7a,
-  0xf1, 0x39, 0x76, 0x48, 0x8d, 0x3e, 0xe3, 0x8b, 0xd8, 0x18, 0x8c, 0x20,
-  0xb1, 0x35, 0x81, 0xe3, 0x35, 0x40, 0x01, 0x8e, 0x8f, 0xf0, 0x8a, 0x6d,
-  0x43, 0x39, 0xed, 0xe0, 0x83, 0xcd, 0xc8, 0x32, 0xd8, 0xe2, 0x60, 0x05,
-  0x63, 0x35, 0x33, 0xa3, 0x8b, 0x25, 0x61, 0x38, 0xef, 0x98, 0x38, 0x65,
-  0x23, 0x8f, 0xf3, 0x28, 0x2e, 0x5c, 0x43, 0x2e, 0xf6, 0x78, 0x8c, 0x31,
-  0x01, 0x32, 0xf9, 0x68, 0x75, 0x86, 0x92, 0x34, 0xe4, 0xf8, 0x41, 0xb4,
-  0x18, 0x28, 0x2d, 0x03, 0x6b, 0x07, 0x53, 0x90, 0xd3, 0x08, 0x2c, 0x61,
-  0x03, 0x8f, 0x0b, 0xe9, 0x87, 0xda, 0xe8, 0x90, 0xf5, 0x08, 0x31, 0xde,
-  0xc8, 0x12, 0x44, 0xf3, 0x08, 0x22, 0x83, 0x34, 0x27, 0x93, 0xfe, 0x0e,
-  0xe5, 0x58, 0x2d, 0xb9, 0x11, 0x30, 0xda, 0xf2, 0x60, 0xdd, 0x12, 0x09,
-  0xdf, 0x12, 0x92, 0xea, 0x92, 0x90, 0x98, 0xe2, 0x2e, 0x0c, 0x19, 0x12,
-  0xf4, 0x88, 0x33, 0x11, 0xc9, 0x92, 0xca, 0x52, 0x2f, 0x4d, 0x76, 0x75,
-  0x31, 0xf9, 0x22, 0xac, 0x28, 0x93, 0xab, 0x32, 0x76, 0x34, 0x12, 0x2b,
-  0x65, 0x71, 0x18, 0x3b, 0x93, 0x2e, 0xc2, 0x92, 0x38, 0x9a, 0x92, 0x8d,
-  0x2a, 0x31, 0x94, 0x5d, 0xa3, 0x92, 0x35, 0x61, 0x17, 0x78, 0xd1, 0x2c,
-  0x4d, 0x36, 0x2a, 0xd1, 0x32, 0x2d, 0x54, 0x12, 0x28, 0x83, 0xa2, 0x2d,
-  0x5a, 0x32, 0x0d, 0x8a, 0x42, 0x95, 0xed, 0x98, 0x26, 0x57, 0xc9, 0x2e,
-  0x6f, 0x12, 0x27, 0x26, 0x89, 0x12, 0x60, 0xf2, 0x28, 0x90, 0xa2, 0x0e,
-  0x92, 0x02, 0x23, 0x75, 0xb2, 0x08, 0xa0, 0x72, 0x2f, 0xa3, 0xc2, 0x27,
-  0x32, 0xa9, 0x91, 0x20, 0x51, 0x25, 0x57, 0x42, 0x76, 0x5b, 0x32, 0x1a,
-  0x8b, 0xc2, 0x12, 0xbf, 0x62, 0x29, 0xef, 0x38, 0x97, 0x41, 0x39, 0x12,
-  0x77, 0x99, 0x97, 0x7a, 0x09, 0x24, 0x2b, 0x49, 0x27, 0xe8, 0x50, 0x1b,
-  0x1e, 0x97, 0x27, 0x7b, 0xd2, 0x27, 0x4c, 0xf9, 0x27, 0xe2, 0x71, 0x25,
-  0xbc, 0x65, 0x23, 0xa3, 0xa1, 0x1e, 0xbe, 0x32, 0x24, 0x45, 0xd2, 0x2e,
-  0x49, 0x42, 0x1d, 0xe1, 0xb2, 0x23, 0x90, 0xf2, 0x23, 0xc6, 0x78, 0x12,
-  0x4c, 0x42, 0x6e, 0x7b, 0x22, 0x25, 0x5f, 0x29, 0x1e, 0x09, 0xb2, 0x20,
-  0x35, 0x72, 0x23, 0x66, 0x82, 0x9a, 0x97, 0x12, 0x22, 0x23, 0xc2, 0x9a,
-  0x2d, 0x11, 0x21, 0xae, 0x59, 0x21, 0x3f, 0x62, 0x01, 0x19, 0xc2, 0x12,
-  0xb3, 0xc9, 0x5f, 0x4f, 0xd2, 0x22, 0xfd, 0x02, 0x23, 0xe2, 0x41, 0x1e,
-  0x0b, 0xd2, 0x20, 0xa5, 0xe9, 0x25, 0xbd, 0x59, 0x0e, 0xae, 0x61, 0x1f,
-  0xf8, 0xc7, 0x31, 0x1d, 0xfb, 0x51, 0x13, 0xec, 0x01, 0x1f, 0xe0, 0x69,
-  0x01, 0xf2, 0xc1, 0x0d, 0xfc, 0x81, 0x0e, 0xc5, 0xd1, 0x24, 0x02, 0x62,
-  0x9b, 0x46, 0xe1, 0x19, 0xbd, 0x51, 0x1e, 0x89, 0x59, 0x9d, 0xce, 0x31,
-  0x24, 0xd0, 0x91, 0x1f, 0xc2, 0xe9, 0x12, 0xc9, 0xa1, 0x1c, 0x6d, 0xb1,
-  0x1a, 0xca, 0x69, 0x9e, 0x76, 0x92, 0x1d, 0xdb, 0xd1, 0x1d, 0xcf, 0x69,
-  0x20, 0xbc, 0xb1, 0x7d, 0x8a, 0x69, 0x9a, 0xd7, 0xe9, 0x1a, 0xdc, 0x49,
-  0x7b, 0x29, 0x71, 0x9f, 0xcb, 0xa1, 0x9f, 0xfb, 0x59, 0x1b, 0x09, 0x78,
-  0x35, 0x01, 0xba, 0x9e, 0x80, 0x01, 0x1a, 0x83, 0xd1, 0x25, 0x84, 0xb9,
-  0x8b, 0x54, 0x01, 0x19, 0xf5, 0x99, 0x16, 0xa7, 0x91, 0x1a, 0xcc, 0x41,
-  0x19, 0x7d, 0xd9, 0x7c, 0x9a, 0x91, 0xa1, 0x2c, 0xd1, 0x8a, 0xa1, 0x37,
-  0x95, 0x75, 0x18, 0x9f, 0x73, 0xa1, 0xa0, 0x2c, 0x91, 0x1c, 0x21, 0x6a,
-  0x20, 0xca, 0x32, 0x55, 0x98, 0xd8, 0x17, 0x7e, 0xd1, 0x42, 0x06, 0x29,
-  0x24, 0xdd, 0xd9, 0x17, 0x4d, 0xe1, 0x14, 0xa5, 0x68, 0x94, 0x2c, 0x64,
-  0xa2, 0x12, 0x99, 0x14, 0x39, 0xea, 0x1c, 0x2e, 0x6a, 0x1a, 0x39, 0xf1,
-  0xa3, 0x2d, 0x91, 0x15, 0x33, 0x61, 0xa3, 0x4e, 0xfa, 0xa4, 0x50, 0x1a,
-  0xa5, 0x52, 0x3a, 0xa5, 0x54, 0x5a, 0xa5, 0x56, 0x7a, 0xa5, 0x58, 0x9a,
-  0xa5, 0x5a, 0xba, 0xa5, 0x5c, 0x7a, 0x12, 0x01, 0x01, 0x00, 0x21, 0xf9,
-  0x04, 0x01, 0x14, 0x00, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x40, 0x00, 0x00, 0x08, 0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0,
-  0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87,
-  0x10, 0x23, 0x4a, 0x9c, 0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a,
-  0xdc, 0xc8, 0xb1, 0xa3, 0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2,
-  0xa4, 0xc9, 0x93, 0x28, 0x53, 0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0x45, 0x25,
-  0xe3, 0xc6, 0x89, 0x9b, 0x09, 0xee, 0x86, 0x4b, 0x84, 0x1d, 0x92, 0xe9,
-  0x4c, 0xd6, 0xe1, 0x66, 0x43, 0x19, 0x32, 0x7c, 0x22, 0xbc, 0x01, 0x6e,
-  0xa6, 0xb8, 0x98, 0x4a, 0x84, 0x32, 0x84, 0x19, 0xd3, 0x28, 0x38, 0x70,
-  0x3c, 0x94, 0x0a, 0xcc, 0xb9, 0x53, 0x67, 0x4f, 0xa9, 0x06, 0x65, 0x60,
-  0xc3, 0x16, 0x14, 0x2b, 0x00, 0x1e, 0x4f, 0x8d, 0xc6, 0x1c, 0x97, 0xd4,
-  0x6b, 0x41, 0xa6, 0x9d, 0x1e, 0x3d, 0x8a, 0xb4, 0x28, 0x15, 0x38, 0x6f,
-  0x51, 0x85, 0x52, 0x25, 0x42, 0x81, 0x02, 0x11, 0xab, 0x66, 0x05, 0x6a,
-  0xdd, 0xca, 0x15, 0x2b, 0x0f, 0x6f, 0xe0, 0x52, 0x2d, 0x8a, 0xa4, 0xb6,
-  0x13, 0xd2, 0xbc, 0x02, 0x99, 0xca, 0x52, 0xbb, 0x76, 0x91, 0xa0, 0x54,
-  0xde, 0xe0, 0xfa, 0x9c, 0x5b, 0xb7, 0xee, 0x5d, 0x9e, 0x66, 0xf7, 0xd6,
-  0xa9, 0xb3, 0xb5, 0xab, 0xcf, 0xbf, 0xde, 0x52, 0x09, 0x1a, 0xcc, 0x58,
-  0xd6, 0x61, 0xb3, 0x8a, 0x19, 0x37, 0x16, 0xf4, 0x38, 0xf2, 0x4d, 0xca,
-  0x95, 0x2d, 0xe3, 0x95, 0xaa, 0x79, 0xc9, 0x12, 0xce, 0x7d, 0x7d, 0x46,
-  0x16, 0x3d, 0x9a, 0x70, 0xe9, 0xd3, 0x52, 0x15, 0x4f, 0x52, 0xcd, 0x96,
-  0xb5, 0x20, 0xd7, 0x2d, 0x43, 0x28, 0x53, 0x66, 0x24, 0x76, 0x6c, 0x23,
-  0xcb, 0x43, 0x28, 0xad, 0x6d, 0xfb, 0x76, 0x67, 0xdd, 0xde, 0x8c, 0x93,
-  0x66, 0x3c, 0xc9, 0x34, 0xd9, 0xe0, 0x31, 0x71, 0xfe, 0x7d, 0x1a, 0xce,
-  0xb8, 0x38, 0x6b, 0xe4, 0x2c, 0x97, 0x1b, 0xb1, 0xc0, 0xbe, 0xbd, 0x7b,
-  0xe8, 0xca, 0x84, 0x52, 0xaf, 0x6e, 0x3d, 0x77, 0xcb, 0xc8, 0xda, 0x7d,
-  0xab, 0x9d, 0xf4, 0x09, 0x17, 0x70, 0x97, 0x4c, 0xa9, 0x82, 0xc9, 0x78,
-  0xc4, 0x39, 0x76, 0x9e, 0x37, 0x2e, 0x2d, 0xe7, 0xde, 0x82, 0xed, 0x2d,
-  0xe7, 0x93, 0x66, 0x4c, 0x44, 0x28, 0x61, 0x84, 0xb8, 0x79, 0xb6, 0x12,
-  0x7e, 0xac, 0x6d, 0xb7, 0xdf, 0x27, 0x98, 0xa8, 0xf2, 0xdf, 0x4a, 0x01,
-  0x6e, 0x32, 0x20, 0x79, 0x6a, 0x99, 0x77, 0x1c, 0x82, 0x2d, 0x29, 0xc8,
-  0xe0, 0x82, 0x0e, 0xba, 0x04, 0xe1, 0x84, 0x30, 0x56, 0x78, 0x5f, 0x76,
-  0x19, 0xea, 0xf7, 0x08, 0x7f, 0x98, 0x6c, 0xe2, 0xe1, 0x77, 0x2c, 0x85,
-  0x28, 0x22, 0x81, 0xe5, 0x19, 0x08, 0x19, 0x8a, 0xe9, 0x29, 0xb3, 0x22,
-  0x8b, 0xf1, 0xb5, 0xb4, 0x97, 0x1b, 0x45, 0x34, 0xe9, 0xe4, 0x93, 0x4d,
-  0xba, 0x71, 0xdd, 0x85, 0xa1, 0xd5, 0xa8, 0x1a, 0x8e, 0x9b, 0xe8, 0xf8,
-  0xa1, 0x49, 0x4c, 0xbd, 0x92, 0xe5, 0x8f, 0x24, 0xae, 0x36, 0x64, 0x5c,
-  0x45, 0x1e, 0xe9, 0x5e, 0x8b, 0x2b, 0x2d, 0x09, 0xe5, 0x9a, 0x4e, 0x4a,
-  0x69, 0x1f, 0x4a, 0xa0, 0x89, 0xa6, 0xe1, 0x8d, 0x1c, 0x7e, 0xf9, 0xca,
-  0x96, 0x23, 0x29, 0x61, 0xce, 0x38, 0xaf, 0x74, 0xf2, 0xe5, 0x88, 0x05,
-  0xba, 0x25, 0x59, 0x82, 0xca, 0x68, 0x60, 0xe8, 0xa1, 0x88, 0x1a, 0x8a,
-  0x66, 0x4a, 0x32, 0x5c, 0x73, 0x0d, 0x93, 0x6c, 0x46, 0xea, 0x86, 0xa3,
-  0x16, 0x9e, 0xf4, 0x57, 0x60, 0x73, 0x62, 0x99, 0x65, 0x27, 0x77, 0x9a,
-  0x53, 0x56, 0x49, 0x7a, 0x9a, 0x53, 0x4b, 0x27, 0x7e, 0x66, 0x09, 0x68,
-  0x79, 0x6e, 0x41, 0xe5, 0xd3, 0x72, 0x89, 0xb6, 0xaa, 0xc1, 0xa2, 0xfe,
-  0x27, 0x35, 0xfa, 0x68, 0xa4, 0xb4, 0x16, 0x31, 0xe9, 0x35, 0x95, 0x9a,
-  0x04, 0x56, 0x60, 0x36, 0x6a, 0xba, 0x09, 0xa9, 0xb5, 0x98, 0xe3, 0x29,
-  0xa8, 0xc2, 0x8e, 0x4a, 0xea, 0x9f, 0x40, 0xaa, 0x95, 0x8a, 0x38, 0x35,
-  0x09, 0xc5, 0xaa, 0xab, 0x88, 0xc2, 0x5a, 0x92, 0xac, 0x6e, 0xf4, 0x60,
-  0xed, 0xb5, 0xd8, 0x66, 0x9b, 0xed, 0xad, 0xb9, 0x96, 0x44, 0x94, 0x38,
-  0xa9, 0x5c, 0x59, 0xe7, 0xa6, 0xc0, 0x0a, 0xfb, 0x29, 0x48, 0xa1, 0x1a,
-  0x7b, 0xac, 0xa9, 0xc9, 0x76, 0x32, 0x93, 0x4d, 0xce, 0x16, 0x0a, 0xed,
-  0xa1, 0xd2, 0x8e, 0x44, 0xad, 0xb6, 0xf8, 0xe6, 0xdb, 0x03, 0xb7, 0x2b,
-  0xdd, 0x30, 0x53, 0x5a, 0x1b, 0xe6, 0x48, 0x6e, 0xb9, 0xc3, 0xa2, 0x2b,
-  0xac, 0x2e, 0xa8, 0x90, 0xba, 0x2e, 0x98, 0x6a, 0xc9, 0xf2, 0xae, 0x54,
-  0xcf, 0xce, 0xfb, 0x6a, 0x92, 0x26, 0xc9, 0x8a, 0x86, 0xbe, 0x18, 0x67,
-  0x8b, 0x06, 0xa5, 0xfd, 0xce, 0xb4, 0x18, 0x9d, 0x02, 0xff, 0xaa, 0x30,
-  0x2a, 0xba, 0x98, 0xfb, 0x51, 0xa8, 0xc3, 0xa0, 0x92, 0xb0, 0xc2, 0xc8,
-  0x0e, 0x67, 0x9a, 0x38, 0xf0, 0x2a, 0xb5, 0x1c, 0x08, 0x34, 0xd7, 0x6c,
-  0x33, 0xcd, 0xf5, 0x82, 0x64, 0x71, 0xc6, 0x3c, 0x5f, 0xbb, 0x31, 0xae,
-  0x1d, 0x8f, 0xb3, 0x98, 0xaf, 0x0a, 0x77, 0xa2, 0xf2, 0x30, 0x26, 0x73,
-  0x14, 0xea, 0x2f, 0xa6, 0xa8, 0x5c, 0x74, 0xcb, 0xde, 0x9d, 0x2b, 0x94,
-  0x33, 0xce, 0xdc, 0x6c, 0x35, 0x08, 0x54, 0x57, 0xec, 0xe8, 0xc5, 0x3d,
-  0x77, 0xfd, 0x73, 0xb7, 0x24, 0x09, 0x37, 0xae, 0xc8, 0xa4, 0xaa, 0x6c,
-  0xca, 0x2f, 0x49, 0x67, 0xb4, 0xb4, 0x29, 0x4d, 0xaf, 0xbc, 0xf0, 0x80,
-  0x51, 0x97, 0x14, 0x02, 0xd5, 0x74, 0x3b, 0x23, 0x1d, 0x42, 0x54, 0x5f,
-  0x7d, 0x73, 0xfe, 0xd6, 0x08, 0xcd, 0x5d, 0xb7, 0xdd, 0x14, 0xad, 0xb0,
-  0xf5, 0x0e, 0x84, 0x17, 0x6e, 0xf8, 0xe1, 0x88, 0x27, 0x4e, 0xf8, 0xcf,
-  0x2b, 0x80, 0x18, 0x93, 0x2c, 0x63, 0x17, 0x6d, 0xf6, 0xd9, 0x69, 0x5b,
-  0xb4, 0xb4, 0x2a, 0x6c, 0x3b, 0xcd, 0x32, 0xbb, 0xc4, 0xf0, 0x38, 0x92,
-  0xdf, 0x7f, 0x03, 0x7e, 0x50, 0xde, 0x7a, 0xd7, 0xcc, 0xb7, 0x41, 0xa0,
-  0xff, 0x7d, 0x37, 0x44, 0x82, 0x5f, 0x83, 0x86, 0x0d, 0xb0, 0xc7, 0x2e,
-  0xfb, 0xec, 0xb4, 0xd7, 0x2e, 0x3b, 0xe3, 0x8e, 0x13, 0x13, 0xf9, 0xc8,
-  0xa8, 0xb0, 0xad, 0x0a, 0xda, 0x05, 0x57, 0x24, 0x85, 0xb0, 0xbf, 0xa8,
-  0x82, 0x79, 0xdb, 0x4f, 0xb3, 0xeb, 0x9d, 0x4c, 0x34, 0xbd, 0x15, 0xd9,
-  0xf3, 0xcf, 0x6f, 0x23, 0xfd, 0xf4, 0x31, 0x2f, 0xe4, 0xb7, 0x15, 0x25,
-  0x64, 0x5f, 0x82, 0x15, 0x54, 0xaf, 0x4e, 0x10, 0xd5, 0xda, 0x87, 0x2f,
-  0xfe, 0xe9, 0x04, 0x5d, 0x1f, 0x3e, 0xf7, 0xa2, 0x3b, 0xd4, 0x3a, 0x1b,
-  0xb6, 0xb7, 0xef, 0x7e, 0xed, 0x6c, 0x38, 0xda, 0xf8, 0x44, 0x37, 0x4c,
-  0x3f, 0x3d, 0xf4, 0xf8, 0x87, 0x35, 0xd3, 0x58, 0x90, 0x87, 0x2c, 0x79,
-  0xef, 0xa6, 0x30, 0x1e, 0xf0, 0xa4, 0x20, 0x3c, 0xe2, 0xbd, 0xc2, 0x78,
-  0x99, 0x73, 0x5b, 0xa9, 0xc0, 0x24, 0x8b, 0x6c, 0x30, 0x8f, 0x59, 0xce,
-  0xc3, 0x5f, 0x64, 0xec, 0x47, 0x3d, 0x86, 0x98, 0x4f, 0x7c, 0xe8, 0xf3,
-  0x9e, 0x40, 0xc0, 0x27, 0xbe, 0x0e, 0x92, 0x4f, 0x20, 0x17, 0x3c, 0x5f,
-  0xf7, 0xd4, 0xe7, 0x28, 0x36, 0xcc, 0xe0, 0x84, 0x28, 0x4c, 0xa1, 0x0a,
-  0x57, 0xc8, 0xc2, 0x16, 0xc6, 0xef, 0x1a, 0xf3, 0x83, 0x48, 0xfd, 0x28,
-  0xb8, 0x0d, 0x09, 0x3e, 0x4f, 0x7f, 0x47, 0xc9, 0x86, 0x2c, 0x88, 0xc6,
-  0x3b, 0xdf, 0xa9, 0xe2, 0x15, 0xfe, 0x03, 0x9c, 0xc8, 0xf0, 0xcc, 0xf1,
-  0x8b, 0x57, 0x1c, 0xf0, 0x78, 0x9a, 0x7b, 0x5b, 0xb2, 0x56, 0x63, 0x1c,
-  0x40, 0x00, 0x82, 0x0f, 0x7c, 0x90, 0x83, 0x14, 0xa5, 0x38, 0x87, 0x2a,
-  0x2e, 0x42, 0x7a, 0xd5, 0x1b, 0x9d, 0x33, 0xc0, 0xd0, 0xc1, 0xec, 0x81,
-  0x61, 0x84, 0xdf, 0x73, 0x46, 0x17, 0xc7, 0xe7, 0x8c, 0x82, 0xf8, 0x8d,
-  0x8b, 0x5d, 0xfc, 0x62, 0x19, 0x19, 0xb2, 0x02, 0x69, 0x48, 0xc3, 0x84,
-  0x2d, 0x8c, 0xa3, 0x1c, 0xe5, 0xc8, 0x06, 0x37, 0xc6, 0xb0, 0x21, 0x33,
-  0x5c, 0x44, 0x15, 0xe7, 0x30, 0x45, 0x29, 0x42, 0xd1, 0x89, 0xc6, 0xe9,
-  0x8d, 0xb8, 0xfc, 0xd7, 0xc3, 0x00, 0xfe, 0x10, 0x88, 0xc2, 0x22, 0x20,
-  0x44, 0x86, 0x58, 0x44, 0x23, 0x22, 0x10, 0x79, 0x9b, 0x63, 0x58, 0x90,
-  0x02, 0xe9, 0x44, 0x28, 0xf6, 0x51, 0x0e, 0x7b, 0x9c, 0x83, 0x20, 0xb0,
-  0xa8, 0x10, 0xaa, 0xa5, 0xe0, 0x93, 0xa0, 0x0c, 0xa5, 0x1a, 0xbd, 0xe7,
-  0xc9, 0x50, 0x9a, 0xf2, 0x93, 0xe4, 0x3b, 0xe3, 0x29, 0x43, 0xf9, 0xc1,
-  0x83, 0xb4, 0xf1, 0x8d, 0x2d, 0x88, 0xa5, 0x2c, 0x67, 0x49, 0xcb, 0x5a,
-  0xda, 0xf2, 0x96, 0xb3, 0xac, 0xa3, 0x34, 0xee, 0xa8, 0x90, 0x19, 0x0a,
-  0x22, 0x93, 0x97, 0xfc, 0x23, 0x20, 0x02, 0x99, 0xa9, 0xdd, 0x95, 0x0d,
-  0x80, 0xc6, 0x33, 0x22, 0x22, 0xcd, 0xa1, 0xc8, 0x86, 0x0c, 0xb1, 0x18,
-  0xb1, 0x50, 0xe6, 0x23, 0x93, 0xb8, 0xc0, 0x53, 0x95, 0xc8, 0x40, 0xac,
-  0xa9, 0x64, 0x14, 0xfb, 0x98, 0xc9, 0x39, 0x48, 0x82, 0x93, 0x78, 0x73,
-  0xc6, 0x2a, 0x45, 0x09, 0x46, 0x00, 0x94, 0x72, 0x9c, 0xa8, 0x5c, 0x23,
-  0x00, 0x54, 0x89, 0xce, 0x14, 0xb4, 0xb2, 0x20, 0xaf, 0xec, 0x02, 0x2e,
-  0xe7, 0x49, 0xcf, 0x7a, 0x76, 0xc1, 0x8e, 0x0c, 0xfe, 0x99, 0xa1, 0x24,
-  0xba, 0x19, 0x4c, 0x3e, 0x00, 0x32, 0x3f, 0x83, 0xfc, 0xd2, 0xff, 0x7c,
-  0xa8, 0xcc, 0x58, 0x14, 0x23, 0x91, 0xce, 0x14, 0x16, 0x34, 0xa3, 0xe9,
-  0x48, 0x24, 0x2a, 0xb0, 0x65, 0x05, 0xa2, 0xe4, 0x13, 0xb7, 0x39, 0xc5,
-  0x6e, 0xa6, 0xe1, 0x9b, 0xdb, 0xc8, 0xe2, 0x40, 0xdc, 0x28, 0x82, 0x8e,
-  0x7a, 0xf4, 0xa3, 0x1d, 0x05, 0x03, 0x3e, 0x01, 0xc0, 0x51, 0x90, 0x9a,
-  0xd4, 0x8d, 0x02, 0x79, 0x25, 0x18, 0x4c, 0x7a, 0x52, 0x69, 0x28, 0x24,
-  0x9e, 0xf5, 0x8c, 0xa9, 0x4c, 0x69, 0x79, 0xcf, 0x5d, 0xf6, 0x52, 0x7a,
-  0x92, 0x48, 0x03, 0x3f, 0xfb, 0x28, 0x4c, 0x62, 0xf6, 0xca, 0x98, 0x46,
-  0x43, 0xe6, 0x21, 0x5f, 0x11, 0x0b, 0x83, 0x22, 0x54, 0x21, 0xcf, 0x2c,
-  0x2a, 0x43, 0x8f, 0x98, 0xc0, 0xe4, 0x49, 0xf2, 0x9a, 0x12, 0xb5, 0x24,
-  0x37, 0x33, 0x99, 0x86, 0x8b, 0x4a, 0x0f, 0x21, 0x25, 0x65, 0xe9, 0x47,
-  0x45, 0x6a, 0xd3, 0xac, 0x6a, 0x55, 0x04, 0x28, 0x55, 0xe9, 0x57, 0x3f,
-  0x8a, 0x52, 0x84, 0xbc, 0xd2, 0x0c, 0x31, 0x35, 0x03, 0x23, 0xd0, 0x9a,
-  0xd6, 0xb5, 0xa6, 0x75, 0xa4, 0x07, 0xc1, 0x69, 0x55, 0x77, 0x3a, 0xc5,
-  0x9e, 0x02, 0x94, 0x3b, 0x40, 0x9d, 0x5c, 0x32, 0x8d, 0xa8, 0xd4, 0x83,
-  0x32, 0x33, 0x21, 0x49, 0x55, 0xaa, 0x34, 0x1d, 0xea, 0x54, 0x6b, 0x32,
-  0x31, 0x9b, 0x13, 0xbd, 0xa4, 0x45, 0xab, 0x7a, 0xd5, 0x83, 0xb8, 0xd1,
-  0x0c, 0x63, 0xf5, 0x28, 0x57, 0xdb, 0x38, 0x8b, 0xc8, 0x8a, 0x60, 0x16,
-  0xbb, 0x74, 0xe3, 0x4a, 0x2d, 0x6b, 0x86, 0xb2, 0x1a, 0xe4, 0xac, 0x26,
-  0x08, 0xad, 0x68, 0x47, 0x2b, 0xda, 0xce, 0x3e, 0x96, 0xb4, 0xa8, 0x35,
-  0x81, 0x69, 0xa5, 0x61, 0x86, 0xd4, 0xa2, 0xd6, 0xb4, 0xbc, 0x1c, 0xfe,
-  0x88, 0xf4, 0xaa, 0xaa, 0x53, 0x60, 0xf2, 0xd4, 0x9f, 0xc3, 0xbc, 0x6b,
-  0xc0, 0x04, 0x5a, 0xc8, 0xbd, 0x12, 0xb5, 0xaf, 0x47, 0x35, 0x48, 0x60,
-  0x8b, 0x3a, 0xd8, 0xa6, 0x46, 0xd2, 0xb0, 0x26, 0x12, 0x84, 0x36, 0x15,
-  0x4b, 0x55, 0xc6, 0x6e, 0xc3, 0xac, 0xa7, 0x75, 0xed, 0x68, 0x57, 0xdb,
-  0x5a, 0xe9, 0x86, 0x96, 0xba, 0xd6, 0x2d, 0x2d, 0x5c, 0x0b, 0xf2, 0x58,
-  0xcb, 0x8a, 0x60, 0xb2, 0xd2, 0xa8, 0x6c, 0x64, 0x31, 0x2b, 0x56, 0xce,
-  0x7a, 0xb6, 0x20, 0xb3, 0x9d, 0xab, 0x6d, 0xeb, 0x8a, 0x5b, 0x9f, 0x06,
-  0x74, 0x60, 0x41, 0x25, 0x28, 0x5f, 0x81, 0xfb, 0x57, 0x84, 0x0c, 0xb7,
-  0xb8, 0x90, 0x54, 0x62, 0x98, 0x92, 0xbb, 0xdc, 0xa9, 0xee, 0xb1, 0xaa,
-  0x18, 0x4d, 0xc8, 0x59, 0xdb, 0xca, 0xd6, 0x7a, 0xaa, 0xb5, 0xc0, 0xf3,
-  0x84, 0x6d, 0x42, 0xbc, 0xfa, 0xd5, 0xc9, 0x92, 0x54, 0x1a, 0x96, 0x0d,
-  0xab, 0x66, 0xbd, 0x7b, 0x5e, 0x82, 0xc8, 0xb5, 0xb6, 0x7b, 0xec, 0xe7,
-  0x3f, 0xad, 0x84, 0x57, 0x42, 0x1e, 0x53, 0xbe, 0xbf, 0x35, 0x6a, 0x7d,
-  0x01, 0xab, 0x50, 0xe2, 0x36, 0xd4, 0xb8, 0xfa, 0x8d, 0x68, 0x13, 0x13,
-  0xeb, 0xdf, 0x2a, 0x5a, 0x35, 0xa3, 0x2f, 0x75, 0xa3, 0x3c, 0x67, 0x4a,
-  0x63, 0x7b, 0x6e, 0xd7, 0x20, 0x0c, 0x66, 0xa9, 0x83, 0x1f, 0x1c, 0x61,
-  0x97, 0x02, 0xa0, 0xbc, 0x63, 0xad, 0xf0, 0x40, 0xf4, 0x89, 0xe1, 0x2a,
-  0x6a, 0x38, 0xb7, 0x1c, 0xde, 0x2d, 0x7c, 0xf5, 0x3a, 0xd4, 0xa2, 0xfa,
-  0xb5, 0x99, 0x48, 0x2d, 0x31, 0x7e, 0xa9, 0x09, 0xd1, 0x49, 0xae, 0x58,
-  0xaa, 0x15, 0xcd, 0x24, 0x46, 0x35, 0xfa, 0x59, 0x19, 0xd7, 0xf8, 0xcb,
-  0xb6, 0xac, 0x69, 0x6c, 0x0b, 0x72, 0xce, 0x71, 0x8e, 0x72, 0x20, 0x65,
-  0x1e, 0xe7, 0xfe, 0xe9, 0xd8, 0x89, 0xce, 0x77, 0x0a, 0x44, 0x9f, 0x74,
-  0xf5, 0x63, 0x7b, 0x75, 0x0b, 0x32, 0xde, 0x7e, 0xd8, 0x90, 0x05, 0x7d,
-  0xf2, 0x43, 0x18, 0x39, 0xe5, 0x87, 0xb2, 0x6b, 0xbf, 0xd8, 0x54, 0x2e,
-  0x8b, 0xb3, 0x5c, 0xc5, 0x4d, 0xc2, 0xb8, 0x21, 0xaf, 0x64, 0x03, 0x98,
-  0x17, 0xdd, 0x02, 0x5d, 0x8e, 0x99, 0xcc, 0xe2, 0x44, 0xe7, 0x99, 0xd1,
-  0x1c, 0xe9, 0x76, 0xa6, 0x92, 0x6a, 0x60, 0xb0, 0xb4, 0x3a, 0x0f, 0xe2,
-  0xcb, 0xf5, 0xca, 0x79, 0xc3, 0x82, 0xec, 0xb0, 0x9d, 0xe3, 0x8b, 0x67,
-  0x23, 0x06, 0x71, 0x91, 0x06, 0x64, 0x6a, 0x7e, 0xab, 0xb9, 0x44, 0xfe,
-  0x0e, 0x9a, 0x8a, 0x56, 0x04, 0xa7, 0xfa, 0xdc, 0x08, 0xc7, 0x39, 0xda,
-  0xfa, 0xd6, 0x8e, 0x6e, 0x08, 0xa6, 0xc7, 0x38, 0x69, 0x4a, 0x8f, 0x31,
-  0x7c, 0x1f, 0x3c, 0x23, 0xaf, 0xdd, 0x3c, 0x64, 0xe9, 0xe9, 0xd1, 0xc8,
-  0xb7, 0x05, 0x75, 0x31, 0x3d, 0x4c, 0xea, 0xbd, 0x9e, 0x3a, 0x22, 0x7c,
-  0x9e, 0xa6, 0x9f, 0x19, 0xe8, 0x40, 0xa7, 0x44, 0x50, 0x82, 0x34, 0x3c,
-  0x34, 0xeb, 0x4a, 0x78, 0xeb, 0x6e, 0xc7, 0xf1, 0x85, 0x8f, 0x46, 0x1d,
-  0xd5, 0xb0, 0x87, 0xc1, 0x72, 0xfa, 0xfa, 0xd7, 0xd9, 0x6b, 0x65, 0x08,
-  0xb5, 0x97, 0xc1, 0x7c, 0x66, 0xdb, 0x86, 0x91, 0xc1, 0xe1, 0x38, 0x74,
-  0xc8, 0xc3, 0x3b, 0x27, 0xf3, 0xd9, 0x12, 0x61, 0xa4, 0xb4, 0x0b, 0xfb,
-  0x89, 0xe5, 0x59, 0x1b, 0xde, 0xde, 0xa0, 0x21, 0x97, 0x11, 0x5d, 0xc2,
-  0xf7, 0x19, 0xfc, 0x7d, 0xe0, 0x86, 0xc8, 0xba, 0xdb, 0x6d, 0x10, 0x0e,
-  0xa2, 0xfb, 0x9d, 0x0b, 0x37, 0xf7, 0x4d, 0x29, 0x08, 0x70, 0x79, 0x3f,
-  0x2e, 0xaf, 0x42, 0xc5, 0xf7, 0x44, 0x2e, 0x87, 0x62, 0x56, 0x77, 0x4e,
-  0x6a, 0x26, 0x69, 0xdd, 0xeb, 0xfe, 0x0e, 0x4e, 0xf2, 0xdb, 0xc9, 0x4f,
-  0x22, 0xa9, 0xab, 0x9b, 0x06, 0x29, 0x5d, 0x3a, 0xd3, 0x6d, 0xba, 0x7c,
-  0xa1, 0x93, 0x38, 0xba, 0xc6, 0xa1, 0x3b, 0x66, 0xeb, 0x15, 0x78, 0x20,
-  0xdf, 0x38, 0xf1, 0x3a, 0x8e, 0xac, 0xb8, 0xa9, 0x44, 0xe4, 0x8a, 0x0b,
-  0xba, 0xd0, 0x0b, 0x87, 0xbb, 0x89, 0xa4, 0x3c, 0x7d, 0x0d, 0xaf, 0x5a,
-  0xcb, 0xb1, 0xf6, 0x72, 0x98, 0xab, 0x0e, 0x54, 0x17, 0xb7, 0x39, 0x00,
-  0x71, 0xbe, 0x91, 0xb5, 0x51, 0xf9, 0xcf, 0x3e, 0x67, 0xd4, 0xd6, 0xba,
-  0xe6, 0x35, 0x8e, 0x95, 0x84, 0x74, 0x2d, 0x27, 0x76, 0x8f, 0x1e, 0x57,
-  0xef, 0xf8, 0x52, 0x5d, 0x69, 0xc2, 0x4a, 0xd9, 0xb4, 0x01, 0xf5, 0xb2,
-  0x81, 0xdb, 0x6b, 0xeb, 0x5c, 0xc7, 0xd8, 0xd7, 0x4e, 0x32, 0xb3, 0xa5,
-  0xe7, 0x8c, 0x25, 0xfe, 0x12, 0x5a, 0x9d, 0x97, 0x8c, 0x0a, 0xa4, 0x05,
-  0x0f, 0xed, 0xe6, 0x40, 0x18, 0xbf, 0xc9, 0xe3, 0x30, 0x98, 0xa5, 0x09,
-  0xee, 0x71, 0xd7, 0xd6, 0xdc, 0xe9, 0x2e, 0x2f, 0x89, 0xdd, 0x5d, 0x25,
-  0xfe, 0x12, 0xc7, 0xc7, 0xca, 0x4e, 0xb2, 0xca, 0x75, 0x24, 0x5d, 0x83,
-  0x67, 0x8c, 0xbb, 0x0c, 0xaf, 0x92, 0x7b, 0x25, 0x1e, 0x5b, 0xfc, 0x42,
-  0x49, 0xc4, 0xe6, 0xf5, 0x78, 0x94, 0x44, 0x1e, 0x60, 0x7b, 0x27, 0x5b,
-  0x27, 0x82, 0xf5, 0xf7, 0x93, 0x15, 0xeb, 0xb8, 0x4b, 0x5c, 0x56, 0xb3,
-  0x3a, 0xef, 0xa8, 0x6a, 0x7d, 0x7e, 0x5f, 0x5e, 0x17, 0x7d, 0xe3, 0x49,
-  0x4f, 0x31, 0x97, 0x7c, 0x2b, 0x5c, 0xa2, 0x1e, 0x18, 0xeb, 0x73, 0xee,
-  0x11, 0xcc, 0xb3, 0x7a, 0xbf, 0xa9, 0x22, 0x13, 0x4a, 0xa8, 0x55, 0x2b,
-  0x49, 0xe5, 0x5e, 0xf7, 0x12, 0x53, 0x54, 0xef, 0x59, 0xb2, 0xab, 0x54,
-  0xfc, 0x94, 0x90, 0xc3, 0x3f, 0x89, 0x9e, 0xf8, 0xfe, 0x74, 0xfc, 0x40,
-  0xbd, 0x45, 0xf9, 0xb1, 0xaa, 0x7d, 0xf3, 0xa1, 0x14, 0x7a, 0x95, 0x8c,
-  0x1e, 0x5a, 0xa5, 0x27, 0xc9, 0xa5, 0x04, 0x73, 0x7d, 0x81, 0x76, 0x8a,
-  0xf8, 0x21, 0xe9, 0x52, 0x95, 0xa1, 0x3a, 0xa6, 0x34, 0x6d, 0x05, 0x52,
-  0xe3, 0x77, 0x13, 0xd8, 0x4a, 0xa2, 0x22, 0x33, 0x59, 0x20, 0xfd, 0x22,
-  0x11, 0x27, 0xa1, 0xa6, 0x64, 0x9b, 0x70, 0x27, 0x9e, 0x83, 0x12, 0x3e,
-  0x82, 0x5c, 0x42, 0x82, 0x1e, 0x8c, 0x72, 0x7f, 0xf9, 0x37, 0x25, 0x65,
-  0xe2, 0x7f, 0xff, 0x37, 0x7d, 0x29, 0xb1, 0x1b, 0x49, 0xb6, 0x77, 0x3b,
-  0x02, 0x7f, 0x61, 0x13, 0x13, 0xaa, 0xf0, 0x54, 0x87, 0xc5, 0x80, 0x0d,
-  0x88, 0x0d, 0x75, 0x00, 0x23, 0x31, 0x02, 0x81, 0x11, 0xe8, 0x7f, 0x00,
-  0x18, 0x12, 0x18, 0x32, 0x80, 0x75, 0x96, 0x81, 0x37, 0x11, 0x20, 0x0a,
-  0x68, 0x1c, 0x20, 0x18, 0x82, 0x23, 0x48, 0x82, 0x4c, 0x20, 0x23, 0x37,
-  0xd1, 0x7f, 0x66, 0x92, 0x82, 0x20, 0xb1, 0x82, 0xcb, 0xe6, 0x82, 0x3e,
-  0xc1, 0x14, 0xe2, 0x01, 0x68, 0x32, 0x48, 0x24, 0x2c, 0x31, 0x1f, 0xd5,
-  0x81, 0x83, 0x39, 0xc8, 0x1c, 0xfe, 0x07, 0x1f, 0x2e, 0xe1, 0x83, 0x3f,
-  0xe5, 0x1f, 0x07, 0xf8, 0x82, 0x64, 0xa7, 0x62, 0x27, 0xf2, 0x20, 0x5b,
-  0x51, 0x07, 0xf4, 0xa1, 0x84, 0x37, 0xa1, 0x1c, 0xcc, 0xe1, 0x1c, 0x95,
-  0x01, 0x1f, 0x2b, 0x87, 0x12, 0x50, 0x78, 0x25, 0x59, 0xa7, 0x14, 0xa9,
-  0x61, 0x65, 0x43, 0x22, 0x1f, 0x59, 0x68, 0x1b, 0x5c, 0x38, 0x19, 0x3a,
-  0x41, 0x17, 0xce, 0x71, 0x19, 0x57, 0x31, 0x23, 0xbc, 0x31, 0x27, 0x67,
-  0x08, 0x1e, 0x7a, 0x47, 0x7f, 0x91, 0x01, 0x7e, 0x4a, 0x92, 0x85, 0x6f,
-  0x28, 0x17, 0x71, 0x18, 0x1b, 0x74, 0xf8, 0x19, 0x16, 0xa8, 0x21, 0x5c,
-  0x79, 0x88, 0x15, 0x68, 0x71, 0x4d, 0x82, 0xe2, 0x87, 0x2e, 0xc2, 0x17,
-  0x6f, 0x82, 0x15, 0xb0, 0x51, 0x88, 0x42, 0xb1, 0x7e, 0xdb, 0x61, 0x18,
-  0x53, 0x88, 0x1a, 0x63, 0x61, 0x6d, 0x8e, 0x78, 0x13, 0x7b, 0xb1, 0x7f,
-  0x82, 0x58, 0x15, 0x98, 0x21, 0x15, 0xbb, 0x22, 0x16, 0x78, 0xa2, 0x89,
-  0x0f, 0x34, 0x7b, 0x99, 0x01, 0x8a, 0x4a, 0x41, 0x15, 0xb3, 0x81, 0x15,
-  0xdf, 0xb2, 0x3f, 0x99, 0x88, 0x18, 0xb4, 0x58, 0x8b, 0xb6, 0x78, 0x8b,
-  0xb8, 0x98, 0x8b, 0xba, 0xb8, 0x8b, 0xbc, 0xd8, 0x8b, 0xbe, 0xf8, 0x8b,
-  0xc0, 0x18, 0x8c, 0xc2, 0x18, 0x12, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04,
-  0x01, 0x14, 0x00, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x40, 0x00, 0x00, 0x08, 0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0,
-  0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10,
-  0x23, 0x4a, 0x9c, 0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc,
-  0xc8, 0xb1, 0xa3, 0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4,
-  0xc9, 0x93, 0x28, 0x53, 0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0xc5, 0x13, 0xd5,
-  0x62, 0x4e, 0x9b, 0x79, 0xc2, 0x25, 0x42, 0x08, 0xa7, 0x72, 0x9e, 0x82,
-  0x60, 0xb3, 0xe1, 0x86, 0x0d, 0x3d, 0x11, 0x9e, 0x98, 0x39, 0x2d, 0x66,
-  0xb5, 0x9a, 0x41, 0x17, 0x9e, 0xc8, 0x66, 0x94, 0xe8, 0x34, 0xa4, 0x49,
-  0x71, 0xea, 0xcc, 0xc9, 0x33, 0xe9, 0xc1, 0x0d, 0xbe, 0x7c, 0x01, 0xb5,
-  0x2a, 0x70, 0x28, 0x51, 0xa3, 0xd9, 0xa0, 0x72, 0x25, 0x98, 0x23, 0x5b,
-  0xb6, 0x4d, 0x8f, 0x1e, 0x45, 0x5a, 0xf4, 0x89, 0x66, 0xd4, 0x9c, 0x2f,
-  0x28, 0x50, 0x78, 0x41, 0x75, 0xec, 0x40, 0xac, 0x59, 0xb5, 0x72, 0xf5,
-  0xfa, 0x69, 0x51, 0xa4, 0xb4, 0x9b, 0xcc, 0xe6, 0xb0, 0x3b, 0xb0, 0x6c,
-  0xb6, 0x4e, 0x69, 0xd5, 0x2e, 0x12, 0xd4, 0xf6, 0x69, 0x4f, 0x07, 0x70,
-  0xe5, 0xca, 0xa5, 0x7b, 0xca, 0x81, 0x5d, 0xbc, 0x67, 0xce, 0x64, 0xdd,
-  0xda, 0x93, 0xaf, 0x20, 0xbf, 0x89, 0x3b, 0x09, 0x26, 0x6c, 0x18, 0x71,
-  0xe2, 0xb5, 0x82, 0x18, 0xcf, 0xb4, 0x09, 0xf9, 0x54, 0x5c, 0xc9, 0x93,
-  0x73, 0x5a, 0xb6, 0x8a, 0x79, 0xc9, 0x12, 0xcd, 0x7a, 0x7b, 0xce, 0xfc,
-  0x94, 0x1a, 0x74, 0xe8, 0xd1, 0x5c, 0x0d, 0xcb, 0x9a, 0x94, 0x58, 0x71,
-  0x6a, 0x41, 0xab, 0x5b, 0xb6, 0x7e, 0x0d, 0x3b, 0x76, 0xe5, 0xa4, 0xb5,
-  0x6d, 0xdf, 0xde, 0xac, 0x7b, 0xda, 0x71, 0xdf, 0x69, 0x27, 0xc9, 0x02,
-  0x1e, 0x54, 0xf8, 0x27, 0xe2, 0xa7, 0x17, 0xfe, 0xa7, 0x4e, 0xce, 0x12,
-  0xae, 0x85, 0xf3, 0xe8, 0xd3, 0x53, 0x0e, 0x1a, 0x5d, 0xfa, 0xf4, 0xdc,
-  0x2d, 0x67, 0x5e, 0xff, 0x9b, 0x78, 0xd2, 0xa7, 0xed, 0xd9, 0x06, 0xf7,
-  0x14, 0x8e, 0xe9, 0x7b, 0x71, 0xd4, 0xe3, 0x4d, 0xe3, 0x52, 0x4e, 0xe8,
-  0x9d, 0xa2, 0xce, 0x81, 0xea, 0x9c, 0x52, 0xe0, 0x29, 0x3d, 0xe1, 0x35,
-  0x06, 0x13, 0x10, 0x46, 0x08, 0xe1, 0x18, 0xd4, 0xc5, 0x67, 0x5d, 0x6f,
-  0xf4, 0x65, 0xf7, 0x09, 0x26, 0xf8, 0xe9, 0xd7, 0x92, 0x70, 0x9b, 0xf4,
-  0x07, 0x5e, 0x5a, 0x00, 0x22, 0x27, 0x60, 0x4b, 0x04, 0x5a, 0x60, 0x20,
-  0x82, 0x07, 0x2a, 0xa8, 0x22, 0x83, 0x2e, 0x39, 0x28, 0xe1, 0x8c, 0x4c,
-  0x50, 0x08, 0x9f, 0x4a, 0xf2, 0x61, 0x58, 0x9c, 0x7d, 0x98, 0x6c, 0xd2,
-  0xe1, 0x87, 0xda, 0x64, 0x83, 0xcb, 0x26, 0x21, 0xfa, 0x17, 0x5e, 0x6a,
-  0x8d, 0x0d, 0xe8, 0x22, 0x8b, 0x2c, 0x9e, 0x97, 0x53, 0x8c, 0xbb, 0xec,
-  0x32, 0x46, 0x11, 0x54, 0x56, 0x69, 0x25, 0x95, 0x63, 0x44, 0xc9, 0x59,
-  0x4a, 0xbb, 0xe9, 0x58, 0xdf, 0x86, 0x44, 0xe2, 0x92, 0x8d, 0x36, 0x1e,
-  0xa2, 0x94, 0x83, 0x36, 0xda, 0xa8, 0x42, 0x64, 0x91, 0x23, 0x1a, 0xd7,
-  0x98, 0x58, 0x2a, 0xa5, 0xc8, 0x24, 0x82, 0x4e, 0xc2, 0xb8, 0xd2, 0x06,
-  0x51, 0x4e, 0x79, 0xe5, 0x9e, 0x58, 0x6a, 0xb9, 0x92, 0x67, 0xd8, 0x3d,
-  0xc2, 0xe3, 0x9a, 0xaa, 0xa0, 0x59, 0x66, 0x49, 0x67, 0xa6, 0xd9, 0xc9,
-  0x9a, 0x22, 0xfe, 0xc7, 0x96, 0x5b, 0x2e, 0xad, 0xb2, 0x8a, 0x06, 0x1a,
-  0xac, 0x63, 0xe9, 0xa5, 0x96, 0x52, 0x2a, 0x29, 0x4b, 0x78, 0x4a, 0xc9,
-  0xe7, 0xa7, 0x45, 0x64, 0xb9, 0xcb, 0x96, 0x27, 0xf1, 0x15, 0xe8, 0xa0,
-  0x44, 0x76, 0x52, 0x28, 0x99, 0x27, 0x25, 0xfa, 0x4a, 0x27, 0xfe, 0x8b,
-  0x12, 0xd9, 0xe8, 0x69, 0xa9, 0x40, 0x1a, 0xe9, 0xa4, 0x95, 0x62, 0x7a,
-  0xa9, 0xa6, 0xab, 0xdc, 0x19, 0x65, 0x1d, 0xa0, 0x82, 0x5a, 0x87, 0x9f,
-  0x2a, 0x79, 0x95, 0x4a, 0x86, 0x82, 0x82, 0x99, 0x6a, 0x27, 0xaf, 0x18,
-  0x8a, 0x28, 0x9a, 0xaf, 0xc2, 0xca, 0xa8, 0x91, 0x69, 0xd5, 0xea, 0x58,
-  0x4f, 0x92, 0x52, 0xaa, 0xeb, 0xae, 0x1a, 0x6c, 0x9a, 0x52, 0xa7, 0x6e,
-  0xf4, 0x20, 0xee, 0xb8, 0xe4, 0x96, 0x5b, 0xae, 0x1b, 0xc4, 0xa6, 0x64,
-  0xec, 0x8e, 0xca, 0x6e, 0x02, 0x2b, 0xb3, 0xce, 0x8a, 0xe4, 0xea, 0xbb,
-  0xb1, 0xb2, 0x99, 0x98, 0xb5, 0x70, 0xb6, 0x94, 0x6d, 0xae, 0xdb, 0xf2,
-  0xfa, 0x6d, 0x94, 0xe1, 0x9a, 0x2b, 0xf0, 0xc0, 0xe8, 0x8e, 0xfa, 0xe7,
-  0x4c, 0xa9, 0x7c, 0xd9, 0xe3, 0xb2, 0xb0, 0x36, 0xcb, 0x2a, 0x48, 0x89,
-  0xd6, 0x82, 0x0a, 0xbd, 0xd3, 0x82, 0xb7, 0x49, 0x35, 0xd7, 0x06, 0xb5,
-  0xef, 0xb6, 0x99, 0x76, 0xdb, 0xeb, 0x49, 0x17, 0x00, 0x3c, 0xf0, 0xc8,
-  0x02, 0x17, 0x7c, 0xc1, 0xc1, 0xd5, 0xa0, 0x95, 0xec, 0xc2, 0xee, 0xbe,
-  0x8b, 0x4a, 0x2d, 0xf1, 0x76, 0x14, 0x31, 0x2a, 0x13, 0xbf, 0x5b, 0xf1,
-  0x23, 0x17, 0x1f, 0xc5, 0x95, 0xa4, 0x20, 0x80, 0xc0, 0xf1, 0x3a, 0x3d,
-  0x7b, 0x5b, 0x52, 0xc8, 0xbb, 0x04, 0x4c, 0xf2, 0xd1, 0xe3, 0x9a, 0xfc,
-  0x67, 0x4c, 0x68, 0xa1, 0xda, 0x32, 0xac, 0x34, 0xc3, 0xfc, 0xf0, 0x46,
-  0x11, 0x9b, 0x42, 0x33, 0xc5, 0xb2, 0x7e, 0xd7, 0x49, 0x4c, 0xf9, 0xda,
-  0xc4, 0xb3, 0xcf, 0x1c, 0x07, 0xfd, 0x31, 0x49, 0x17, 0xe4, 0x92, 0x8b,
-  0xd1, 0x48, 0xa7, 0xed, 0x86, 0xd9, 0x27, 0x17, 0x1b, 0x53, 0x27, 0x4e,
-  0xd3, 0x4b, 0xb3, 0x29, 0x52, 0x1f, 0x6a, 0x51, 0xa2, 0xb1, 0x98, 0x62,
-  0x75, 0xfe, 0xcd, 0xd2, 0x66, 0x2d, 0x9a, 0xce, 0x24, 0x39, 0xe0, 0xca,
-  0xe0, 0x84, 0xcf, 0x76, 0xd0, 0xe0, 0x3d, 0xff, 0xdc, 0xf3, 0xe0, 0x09,
-  0x09, 0x4e, 0xf8, 0xe0, 0x86, 0x47, 0x54, 0xf6, 0xd9, 0x3b, 0x54, 0x6e,
-  0xf9, 0xe5, 0x98, 0x67, 0xae, 0x79, 0xe5, 0x6b, 0xe7, 0xd2, 0xb6, 0xba,
-  0xd5, 0x1c, 0xd6, 0xae, 0xdc, 0xa8, 0xe8, 0x1d, 0x4b, 0xcc, 0x77, 0xa3,
-  0x49, 0x8b, 0x2a, 0x7a, 0x5f, 0x6d, 0x73, 0xd6, 0xbc, 0x84, 0x55, 0x92,
-  0x04, 0x8f, 0x3f, 0x2e, 0x01, 0x42, 0x88, 0x83, 0x30, 0xca, 0xb6, 0xa3,
-  0x2c, 0xee, 0x0a, 0x42, 0xb4, 0xd7, 0x3e, 0xf8, 0xed, 0x92, 0x9b, 0x8d,
-  0x86, 0x0d, 0xc8, 0x27, 0xaf, 0xfc, 0xf2, 0xcc, 0x37, 0xaf, 0x3c, 0x1a,
-  0x6c, 0xff, 0x99, 0x0d, 0x2f, 0xa3, 0xbb, 0x5c, 0xba, 0x29, 0xaa, 0xd0,
-  0x82, 0xfa, 0x44, 0x89, 0xae, 0xce, 0xfa, 0xde, 0x58, 0x17, 0xf9, 0xb7,
-  0x4c, 0x4e, 0x39, 0xb5, 0xcc, 0xf9, 0xe8, 0xa7, 0x8f, 0x81, 0x43, 0xc1,
-  0x03, 0x51, 0xc2, 0xfb, 0x25, 0x00, 0x31, 0xfc, 0xe1, 0xae, 0xbc, 0x5f,
-  0xc1, 0xee, 0x97, 0x8e, 0x52, 0xc1, 0xfb, 0x8c, 0x1b, 0xd4, 0x3e, 0xfc,
-  0xf1, 0x9b, 0xdf, 0x43, 0x26, 0x77, 0x3c, 0xe7, 0x19, 0xf0, 0x80, 0xcc,
-  0x83, 0x9e, 0xe7, 0x28, 0x82, 0x81, 0xf4, 0x39, 0x70, 0x19, 0xe5, 0x73,
-  0x0a, 0x58, 0x3a, 0x51, 0x3d, 0xa8, 0x5d, 0x4f, 0x15, 0xd9, 0xdb, 0x1e,
-  0x44, 0x12, 0xf5, 0x8b, 0x57, 0x60, 0xb0, 0x75, 0x7c, 0xab, 0x97, 0x88,
-  0x3a, 0x41, 0x0c, 0xf2, 0x45, 0x70, 0x1a, 0x0f, 0x4c, 0xdf, 0x31, 0xd6,
-  0xb7, 0x90, 0x09, 0x0c, 0xce, 0x7d, 0x00, 0x0c, 0xa0, 0x2b, 0x26, 0x60,
-  0x90, 0xc1, 0xc1, 0xaf, 0x02, 0xa5, 0x60, 0x07, 0x3b, 0x4a, 0xb1, 0x3f,
-  0xfe, 0xfd, 0xae, 0x20, 0xfe, 0x2e, 0x74, 0x05, 0x0c, 0x01, 0x28, 0xbf,
-  0x19, 0x3a, 0x84, 0x80, 0x33, 0x48, 0xa2, 0x12, 0x97, 0xc8, 0xc4, 0x26,
-  0x3a, 0xf1, 0x89, 0x0a, 0xfc, 0xdc, 0x43, 0x30, 0x70, 0x8c, 0x14, 0xa2,
-  0xef, 0x84, 0x33, 0x89, 0x09, 0x31, 0xe0, 0x56, 0xc1, 0x4e, 0xcc, 0x0d,
-  0x7b, 0xaa, 0x78, 0xc5, 0x2f, 0x34, 0xd8, 0x90, 0x1c, 0x74, 0x43, 0x1b,
-  0x1d, 0xf4, 0xe0, 0xf7, 0x5c, 0xd7, 0x37, 0x7b, 0x1d, 0xe9, 0x38, 0x80,
-  0x00, 0x04, 0x1f, 0xf8, 0x20, 0x87, 0x3a, 0xd6, 0x71, 0x0e, 0x78, 0x94,
-  0xc4, 0x31, 0x56, 0xb8, 0x90, 0xc1, 0x4d, 0x21, 0x86, 0xf0, 0x9b, 0x82,
-  0x00, 0x07, 0x62, 0xc3, 0x1b, 0x2e, 0x60, 0x01, 0x3d, 0xf4, 0x61, 0x41,
-  0x82, 0xf7, 0x47, 0x40, 0x96, 0x40, 0x90, 0x3f, 0x5c, 0x08, 0x12, 0x9f,
-  0x48, 0xc9, 0x4a, 0x56, 0x32, 0x8a, 0x10, 0xa1, 0xe2, 0x31, 0x24, 0x81,
-  0xc7, 0x39, 0xd8, 0xb1, 0x8e, 0x73, 0x8c, 0xe3, 0x71, 0x3e, 0x83, 0xac,
-  0xb8, 0x59, 0x4f, 0x6f, 0x18, 0x7c, 0x85, 0x18, 0xb5, 0xd1, 0x0d, 0xbb,
-  0x2d, 0xc4, 0x8c, 0xdd, 0x48, 0xa3, 0x1a, 0x41, 0x18, 0xbe, 0x59, 0x91,
-  0x48, 0x3c, 0xa9, 0x89, 0xe3, 0x1c, 0x3f, 0x29, 0x87, 0x4e, 0xce, 0x41,
-  0x8f, 0x7c, 0x4c, 0xc8, 0xe0, 0x52, 0x40, 0xcc, 0x62, 0x1a, 0x13, 0x92,
-  0xc4, 0x13, 0xc8, 0x30, 0x8d, 0xc9, 0x4c, 0x62, 0xf6, 0x4f, 0x20, 0x8c,
-  0x6c, 0xa6, 0x31, 0x9f, 0x99, 0x90, 0x0b, 0xcc, 0x62, 0x16, 0x5c, 0x68,
-  0x81, 0x36, 0xb7, 0xc9, 0xcd, 0x6e, 0x7a, 0xf3, 0x9b, 0xe0, 0xe4, 0x26,
-  0x17, 0xae, 0x29, 0x45, 0x85, 0x68, 0x92, 0x93, 0x9d, 0xe4, 0x65, 0x28,
-  0x01, 0x31, 0xca, 0x53, 0x75, 0xf1, 0x8b, 0xa9, 0x54, 0xe5, 0x2f, 0xba,
-  0xd1, 0xca, 0x87, 0xc0, 0xf2, 0x17, 0xb1, 0xfe, 0x50, 0xe5, 0x2c, 0xc1,
-  0xf7, 0x3a, 0x37, 0xde, 0x32, 0x35, 0x6d, 0x10, 0x06, 0x3d, 0x06, 0x3a,
-  0x8f, 0x82, 0x1a, 0x74, 0x1e, 0xcb, 0xe8, 0x24, 0x1f, 0xf6, 0xc8, 0x42,
-  0xfa, 0x49, 0xd3, 0x98, 0x4f, 0x18, 0xe4, 0x32, 0x1f, 0xea, 0xcc, 0x48,
-  0x06, 0xef, 0x09, 0x14, 0xad, 0xa8, 0x24, 0xaf, 0x99, 0xcd, 0x70, 0x7a,
-  0xf4, 0xa3, 0x1f, 0x1d, 0xe7, 0x2c, 0xca, 0x79, 0x10, 0x4d, 0xf2, 0xa1,
-  0x93, 0xcb, 0x38, 0xa8, 0x41, 0x07, 0x4a, 0x0f, 0x61, 0xb4, 0xc1, 0x4b,
-  0x1a, 0x62, 0x19, 0xe9, 0x50, 0x19, 0x46, 0x55, 0xc6, 0x62, 0x9e, 0xf5,
-  0x64, 0xc8, 0x3d, 0x63, 0x91, 0x4f, 0x55, 0x7e, 0x90, 0x9f, 0x6d, 0xb4,
-  0xa5, 0x71, 0x02, 0xca, 0x52, 0x7a, 0xa8, 0xd4, 0xa0, 0x09, 0x9d, 0x43,
-  0x1a, 0x16, 0x1a, 0xcc, 0x1a, 0xba, 0x42, 0x04, 0x50, 0x8d, 0xaa, 0x54,
-  0xa1, 0x1a, 0x51, 0x57, 0x10, 0x6f, 0x70, 0x53, 0xcd, 0xaa, 0x08, 0xfa,
-  0x77, 0x51, 0xad, 0x4e, 0x95, 0x9a, 0x06, 0xb1, 0x26, 0x36, 0x41, 0x4a,
-  0xd6, 0xb2, 0x76, 0x53, 0xa4, 0x24, 0x25, 0x88, 0x49, 0xd3, 0x80, 0xc7,
-  0x94, 0x1e, 0x75, 0x1e, 0x45, 0x75, 0x29, 0x29, 0xd9, 0x25, 0xd3, 0x53,
-  0x82, 0x51, 0x9f, 0x3c, 0xc5, 0xa9, 0x2b, 0xc9, 0x42, 0x4f, 0x7c, 0xf2,
-  0x54, 0x9f, 0x3f, 0x65, 0xa3, 0x08, 0xa9, 0xa5, 0x98, 0x80, 0xd6, 0xa3,
-  0xa8, 0x6f, 0x2d, 0x28, 0x1e, 0xd3, 0xb0, 0xd4, 0x3d, 0x22, 0xe4, 0x9a,
-  0x5e, 0x9d, 0xea, 0x13, 0xae, 0x79, 0x3b, 0xc8, 0x46, 0x16, 0xaa, 0xd7,
-  0x04, 0x80, 0x04, 0xae, 0xf9, 0x84, 0xcb, 0x46, 0x35, 0xb3, 0x08, 0x11,
-  0x6b, 0x47, 0x43, 0x6a, 0x87, 0xd1, 0x92, 0xd6, 0xb4, 0xe1, 0x44, 0x6b,
-  0x42, 0xf6, 0xc8, 0x07, 0xc6, 0xe2, 0x31, 0xb1, 0x70, 0x65, 0xfe, 0x69,
-  0x3d, 0x5c, 0xea, 0xce, 0xba, 0x5a, 0x90, 0xa6, 0x78, 0xcd, 0x2b, 0x3d,
-  0xf7, 0x0a, 0x80, 0x1f, 0xf4, 0x95, 0xa7, 0x7f, 0xf5, 0xe9, 0x1a, 0x43,
-  0x78, 0xb3, 0xf0, 0x6c, 0xa1, 0x1e, 0x87, 0x65, 0x29, 0x6c, 0x17, 0xcb,
-  0x58, 0xc7, 0x1e, 0x84, 0xb3, 0x9e, 0xa5, 0x2a, 0x65, 0x67, 0x71, 0x89,
-  0xe8, 0x5e, 0x62, 0x16, 0x9b, 0x9d, 0x45, 0x67, 0xa3, 0x3b, 0xd9, 0x59,
-  0x84, 0x96, 0xa3, 0x26, 0x08, 0xaf, 0x78, 0xc7, 0x2b, 0xde, 0x2e, 0x5c,
-  0x73, 0x16, 0x5d, 0x20, 0xaf, 0x7a, 0x4d, 0x60, 0xde, 0x6b, 0xa6, 0x77,
-  0xbd, 0xe4, 0x55, 0xed, 0x41, 0xf6, 0xc8, 0x58, 0xb6, 0xce, 0x01, 0xb6,
-  0x45, 0x45, 0xee, 0x16, 0x6a, 0xbb, 0xa6, 0x99, 0xde, 0xd5, 0xa6, 0xc0,
-  0xc5, 0xe9, 0x0f, 0x10, 0xe2, 0xdb, 0x58, 0x02, 0xb7, 0xa7, 0xfb, 0x14,
-  0x6c, 0x71, 0x6f, 0x79, 0xdc, 0xe4, 0x12, 0x34, 0xb1, 0xcc, 0x4d, 0x83,
-  0x73, 0xc3, 0x0a, 0x5e, 0xf8, 0x8e, 0xb7, 0xbd, 0xe8, 0xb5, 0x70, 0x79,
-  0xcf, 0xfb, 0x5e, 0x0d, 0x9b, 0x40, 0xbe, 0x06, 0x81, 0x2e, 0x77, 0xa7,
-  0x5b, 0x5d, 0xcf, 0x5e, 0x37, 0xbb, 0xdb, 0xf5, 0x6c, 0x77, 0x11, 0x42,
-  0x5f, 0xd7, 0xde, 0x37, 0xb1, 0xf9, 0xad, 0xc7, 0x7e, 0x4b, 0xf9, 0xce,
-  0x0b, 0xd6, 0xf4, 0x15, 0x07, 0x16, 0x70, 0x42, 0x76, 0x1a, 0xdc, 0x04,
-  0x13, 0x37, 0x6b, 0x6d, 0x5a, 0x8b, 0x61, 0x11, 0x0b, 0x61, 0xa5, 0x36,
-  0xf6, 0x18, 0xd5, 0xe4, 0x28, 0x59, 0xb9, 0x50, 0xda, 0xb2, 0x32, 0x19,
-  0xb5, 0xe0, 0x04, 0x71, 0x88, 0x67, 0x11, 0x5d, 0x11, 0x74, 0xb7, 0xb2,
-  0x54, 0xf6, 0x6c, 0x66, 0x51, 0x5c, 0x65, 0xd0, 0x1a, 0x84, 0xb5, 0x2e,
-  0xc6, 0xaf, 0x6c, 0x69, 0x4b, 0x63, 0xdb, 0x7a, 0xd1, 0xc6, 0xb9, 0xbd,
-  0xe9, 0xfe, 0x6e, 0x5f, 0xf9, 0x5b, 0x04, 0x07, 0xf6, 0xc7, 0xfe, 0x1c,
-  0xaa, 0x40, 0x95, 0xfb, 0xd6, 0xa4, 0x1e, 0xb9, 0xa1, 0x07, 0x11, 0xad,
-  0x59, 0xf7, 0xbc, 0x64, 0x72, 0x2a, 0x04, 0xab, 0x2a, 0x16, 0x20, 0xa0,
-  0x2f, 0xcb, 0xd5, 0xc1, 0xa5, 0x38, 0xb2, 0x60, 0x1d, 0xc8, 0x5a, 0xdb,
-  0x0a, 0x63, 0x96, 0xca, 0x95, 0xbf, 0x0c, 0x3b, 0x33, 0x6e, 0x01, 0xac,
-  0xd7, 0x32, 0xfe, 0x16, 0xb0, 0xc3, 0xad, 0x25, 0x61, 0x01, 0x44, 0xd4,
-  0x07, 0xab, 0x34, 0xa9, 0x73, 0x60, 0x2a, 0x9e, 0xbf, 0x3b, 0x56, 0x3e,
-  0x9b, 0xda, 0x9b, 0x52, 0x76, 0x68, 0x46, 0xab, 0x9a, 0xcc, 0x89, 0x52,
-  0xf4, 0x99, 0x17, 0xcd, 0x68, 0x0a, 0x12, 0xad, 0x68, 0xd6, 0xa2, 0xf4,
-  0xad, 0x8e, 0x7e, 0xe9, 0x5c, 0x15, 0xd6, 0x5f, 0xbb, 0xc6, 0x13, 0xc7,
-  0x95, 0x76, 0xc8, 0x3d, 0x31, 0x4d, 0xcb, 0x7e, 0x0a, 0xb5, 0x44, 0x82,
-  0xd0, 0x25, 0x1d, 0x3f, 0xe9, 0x4b, 0x60, 0x8e, 0x3a, 0xc9, 0xa5, 0x3e,
-  0xf5, 0xa9, 0x53, 0xad, 0xea, 0x87, 0x22, 0x93, 0x20, 0xae, 0x7e, 0x28,
-  0x35, 0xa3, 0xf9, 0xea, 0x48, 0x96, 0x74, 0x8f, 0xe8, 0xc4, 0xa3, 0x3a,
-  0xf9, 0x20, 0xca, 0xf9, 0xd0, 0xb5, 0xd7, 0xb7, 0xfd, 0xaf, 0x18, 0xd7,
-  0xbc, 0xc1, 0x33, 0xa6, 0xf1, 0xcd, 0x9a, 0x0e, 0x32, 0x2e, 0x93, 0x2d,
-  0xc7, 0x65, 0xdb, 0xb1, 0x93, 0xce, 0x86, 0xc8, 0x24, 0x2d, 0xc9, 0xef,
-  0x7e, 0x63, 0x92, 0x21, 0x7e, 0x74, 0xe4, 0x23, 0x07, 0xa9, 0xcc, 0xfa,
-  0x19, 0x12, 0x91, 0x00, 0x04, 0x2b, 0x23, 0x05, 0x0e, 0xc9, 0x85, 0x9c,
-  0x33, 0x9d, 0x9f, 0x5c, 0x67, 0x3b, 0xcb, 0x8c, 0x6e, 0x49, 0xff, 0x77,
-  0x8c, 0x39, 0x8d, 0x08, 0x07, 0x7d, 0x1c, 0x6f, 0x12, 0x9a, 0x30, 0x82,
-  0x56, 0x3c, 0x5f, 0x53, 0xfe, 0x07, 0x68, 0xbc, 0x7e, 0x9b, 0x9c, 0x92,
-  0xff, 0x66, 0x48, 0x10, 0x87, 0x08, 0xbf, 0x22, 0xd2, 0xb0, 0x20, 0x85,
-  0x2c, 0x01, 0x0e, 0x75, 0xc8, 0x43, 0xf8, 0x25, 0x7a, 0xe5, 0x80, 0x74,
-  0x39, 0x43, 0xa8, 0x18, 0x72, 0x08, 0x62, 0x51, 0x8b, 0x5c, 0x34, 0x33,
-  0x3c, 0xc3, 0x38, 0xc6, 0xa9, 0x49, 0xa4, 0x7b, 0xf0, 0x36, 0xf6, 0x27,
-  0xc6, 0x87, 0x31, 0x2c, 0xf6, 0xfc, 0xd9, 0x47, 0x34, 0x1e, 0x02, 0xa7,
-  0x8e, 0xc0, 0x94, 0x37, 0xe4, 0x7f, 0x2d, 0x27, 0x38, 0x21, 0x0d, 0x7e,
-  0x3f, 0x4c, 0xe9, 0x4f, 0x91, 0xfe, 0x7b, 0x21, 0x11, 0xb5, 0x9e, 0x90,
-  0x06, 0x86, 0x1c, 0x8b, 0x45, 0x89, 0x89, 0xe8, 0x84, 0x6e, 0x63, 0xed,
-  0x19, 0x9d, 0x7b, 0xaa, 0xcb, 0xb4, 0xd2, 0x63, 0xd7, 0x35, 0xb2, 0x49,
-  0x9d, 0xea, 0x78, 0x7f, 0x5e, 0xf4, 0x22, 0x12, 0x3c, 0xe1, 0x25, 0x13,
-  0xe6, 0xae, 0xe8, 0x19, 0xfe, 0xbc, 0xee, 0x3b, 0xe0, 0x09, 0x8f, 0xec,
-  0x1f, 0x59, 0x0a, 0xf5, 0xd8, 0x8e, 0x4a, 0xb7, 0xf3, 0x76, 0x83, 0x68,
-  0xca, 0x1b, 0x50, 0x07, 0xfb, 0xb7, 0xba, 0x8f, 0x64, 0x72, 0x6e, 0xd8,
-  0x9c, 0xe6, 0x37, 0x6f, 0xb9, 0xce, 0xa5, 0xb5, 0x21, 0x8e, 0x7b, 0x5c,
-  0xe4, 0x00, 0x9f, 0xb8, 0xb0, 0x81, 0x80, 0xd6, 0x02, 0x09, 0x7d, 0xe1,
-  0x4a, 0x02, 0x93, 0xb5, 0x57, 0xfc, 0x8b, 0xa7, 0x7b, 0x7b, 0xea, 0xb4,
-  0x51, 0x8b, 0xc9, 0x57, 0x6c, 0x6b, 0x80, 0x4b, 0x09, 0xe6, 0xd3, 0xc6,
-  0xfb, 0x1e, 0x78, 0xde, 0x24, 0x5f, 0x53, 0x1c, 0x08, 0x84, 0x96, 0x14,
-  0x98, 0x54, 0x23, 0xe8, 0xaf, 0x2f, 0x5d, 0xdd, 0x64, 0x86, 0x26, 0x89,
-  0xc1, 0xb9, 0x51, 0x39, 0xb3, 0xbc, 0x48, 0x88, 0x86, 0xb6, 0xde, 0x97,
-  0x2c, 0x4a, 0x9f, 0xff, 0x48, 0xf0, 0x4d, 0xfe, 0x4f, 0xfc, 0xce, 0x30,
-  0x6d, 0x65, 0xc9, 0x5f, 0xbe, 0x47, 0x66, 0x16, 0x6f, 0xc0, 0x60, 0x4c,
-  0xfa, 0x21, 0xa1, 0xbe, 0xf5, 0x09, 0x86, 0x7d, 0x94, 0x6c, 0x8c, 0x63,
-  0xfe, 0x2a, 0x7e, 0x51, 0x54, 0x66, 0x4a, 0xa8, 0x89, 0xff, 0x23, 0xf3,
-  0x52, 0xfa, 0x88, 0xf0, 0xe5, 0xab, 0xa2, 0xad, 0xff, 0x5c, 0xe9, 0x02,
-  0x7c, 0xb8, 0xf2, 0x33, 0xf1, 0xd7, 0x19, 0x08, 0xc3, 0x6b, 0x91, 0xe6,
-  0x30, 0x8f, 0x97, 0x11, 0xf9, 0x37, 0x58, 0x6d, 0xc2, 0x7f, 0x2a, 0x01,
-  0x2e, 0xff, 0x27, 0x2e, 0x05, 0x43, 0x2a, 0x25, 0xf1, 0x7e, 0xfd, 0xe2,
-  0x31, 0x41, 0xb1, 0x2e, 0x08, 0xf8, 0x34, 0x0a, 0xf8, 0x2c, 0xda, 0x10,
-  0x2d, 0x0b, 0xa6, 0x16, 0x10, 0xf8, 0x2f, 0xbb, 0x00, 0x2c, 0xc1, 0xc2,
-  0x27, 0xc3, 0x62, 0x30, 0x2a, 0x81, 0x81, 0xba, 0x52, 0x80, 0x2d, 0x61,
-  0x2c, 0x14, 0xb7, 0x2c, 0x1f, 0x68, 0x12, 0x89, 0xa2, 0x0a, 0x0e, 0xe8,
-  0x28, 0x6f, 0xd2, 0x7f, 0x7a, 0x92, 0x82, 0x55, 0x22, 0x2a, 0x16, 0x28,
-  0x80, 0xda, 0x02, 0x7f, 0x1a, 0xe8, 0x12, 0xa6, 0x32, 0x83, 0xee, 0xb2,
-  0x2a, 0x0b, 0x38, 0x7e, 0x68, 0xa2, 0x26, 0x40, 0xe6, 0x28, 0xaa, 0x91,
-  0x31, 0x28, 0xd1, 0x29, 0x3d, 0x98, 0x82, 0x40, 0x88, 0x22, 0x4b, 0x32,
-  0x27, 0xea, 0x50, 0x27, 0x46, 0xd8, 0x25, 0x90, 0xb6, 0x09, 0x4a, 0xb8,
-  0x12, 0x67, 0x22, 0x24, 0x4f, 0xf8, 0x46, 0x49, 0xc2, 0x83, 0x3e, 0x78,
-  0x85, 0x58, 0x78, 0x1e, 0x5a, 0xb8, 0x85, 0x2f, 0xe2, 0x12, 0x5d, 0xb2,
-  0x6b, 0x31, 0x15, 0x26, 0x63, 0xb2, 0x84, 0x21, 0x01, 0x22, 0xc7, 0x86,
-  0x4b, 0xe4, 0x11, 0x81, 0x59, 0xf1, 0x20, 0x34, 0x12, 0x21, 0x36, 0x12,
-  0x84, 0x28, 0x91, 0x22, 0x2b, 0xc2, 0x22, 0x2e, 0xf2, 0x24, 0xf6, 0x16,
-  0x62, 0x6e, 0xbc, 0xf6, 0x23, 0x2e, 0xc1, 0x1f, 0x9b, 0xa6, 0x87, 0x27,
-  0xc2, 0x29, 0x7d, 0xf8, 0x87, 0x35, 0x52, 0x21, 0x4a, 0x52, 0x20, 0x86,
-  0xb8, 0x20, 0x70, 0x78, 0x21, 0x72, 0xb8, 0x32, 0x8c, 0x68, 0x13, 0xde,
-  0x21, 0x6f, 0xc7, 0xb1, 0x87, 0x77, 0x92, 0x15, 0x67, 0xe0, 0x1e, 0xb6,
-  0x81, 0x1b, 0x82, 0x98, 0x12, 0xe6, 0x91, 0x1e, 0xae, 0xb8, 0x1e, 0x89,
-  0x08, 0x53, 0xc9, 0xf2, 0x89, 0xfb, 0x61, 0x16, 0xc3, 0x01, 0x85, 0x01,
-  0xd2, 0x20, 0xa6, 0xe8, 0x1e, 0xaa, 0x98, 0x14, 0xcb, 0xd1, 0x1c, 0x92,
-  0x41, 0x19, 0xa3, 0xc7, 0x25, 0x9c, 0x78, 0x2a, 0xb4, 0xd8, 0x1d, 0x66,
-  0x61, 0x1a, 0xff, 0x14, 0x85, 0xec, 0xb1, 0x8b, 0xef, 0xb1, 0x8a, 0x2b,
-  0xf1, 0x8b, 0xcd, 0x21, 0x8c, 0x36, 0x11, 0x87, 0x81, 0x22, 0x1a, 0xf9,
-  0x41, 0x1a, 0xc9, 0x78, 0x24, 0x3b, 0xd8, 0x8c, 0xbe, 0x90, 0x19, 0x96,
-  0x68, 0x15, 0xd2, 0xe8, 0x1c, 0xc3, 0x58, 0x2c, 0x5e, 0x98, 0x21, 0xd8,
-  0x68, 0x87, 0x2c, 0x61, 0x18, 0x2a, 0xb3, 0x16, 0xdd, 0x08, 0x1d, 0x79,
-  0x71, 0x23, 0x5c, 0x21, 0x15, 0xaf, 0x41, 0x19, 0x55, 0x61, 0x80, 0xd3,
-  0xd0, 0x17, 0xf4, 0x11, 0x18, 0xd9, 0x48, 0x18, 0x03, 0xb1, 0x14, 0x4d,
-  0x41, 0x14, 0xe8, 0x57, 0x8a, 0xf2, 0x38, 0x16, 0x52, 0x31, 0x15, 0xf7,
-  0xb8, 0x81, 0x12, 0xa4, 0x76, 0x03, 0xb9, 0x81, 0x01, 0x29, 0x85, 0x5c,
-  0xf1, 0x13, 0xfe, 0x48, 0x10, 0x07, 0xb9, 0x13, 0x76, 0xe1, 0x15, 0x69,
-  0x97, 0x7b, 0x13, 0xb9, 0x91, 0x1c, 0xd9, 0x91, 0x1e, 0xf9, 0x91, 0x20,
-  0x19, 0x92, 0x22, 0x39, 0x92, 0x24, 0x59, 0x92, 0x26, 0x79, 0x92, 0x28,
-  0x99, 0x92, 0x14, 0x11, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x01, 0x14, 0x00,
-  0xff, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-  0x08, 0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08,
-  0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x4a, 0x9c,
-  0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3,
-  0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28,
-  0x53, 0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0x45, 0x12, 0xc1, 0x62, 0xf2, 0x9a,
-  0x99, 0xc1, 0x25, 0xc2, 0x02, 0x7a, 0x72, 0xea, 0x29, 0x60, 0xb3, 0xe1,
-  0x83, 0x07, 0x3d, 0x11, 0x66, 0x98, 0xc9, 0x2b, 0x66, 0x30, 0x12, 0x41,
-  0x19, 0x92, 0x20, 0x66, 0x94, 0x68, 0xaf, 0x9a, 0x49, 0x01, 0xe0, 0xd4,
-  0x99, 0x93, 0x67, 0x54, 0x83, 0x0f, 0x42, 0x85, 0x02, 0x7a, 0x15, 0x40,
-  0x86, 0x5e, 0x44, 0x8d, 0x12, 0x43, 0xda, 0xb5, 0xe0, 0x52, 0x62, 0xa9,
-  0x1e, 0x3d, 0x8a, 0xb4, 0xe8, 0x51, 0xaf, 0xa7, 0x49, 0xa7, 0xbe, 0xa0,
-  0x40, 0xe1, 0x45, 0xd5, 0xb2, 0x02, 0xb3, 0x6a, 0xdd, 0x7a, 0xf5, 0x6b,
-  0xaf, 0x47, 0x8b, 0x22, 0xa9, 0x4d, 0x45, 0x6c, 0x2c, 0x5e, 0x81, 0x67,
-  0x37, 0xa9, 0x5d, 0xbb, 0x48, 0x90, 0x5b, 0xb8, 0x36, 0xe5, 0xd2, 0xa5,
-  0x6b, 0x77, 0x67, 0x59, 0xbd, 0x57, 0xae, 0x68, 0xe5, 0xda, 0xd3, 0xef,
-  0x23, 0x41, 0x81, 0x17, 0x6f, 0x2a, 0x4c, 0xb6, 0x2b, 0x89, 0x61, 0xc4,
-  0x14, 0x2f, 0x66, 0x2b, 0xc8, 0xf1, 0xdb, 0xc8, 0x39, 0xe7, 0x4e, 0xa6,
-  0x7c, 0x37, 0xaa, 0xde, 0x33, 0x4b, 0x96, 0x9c, 0xd9, 0x1c, 0xf4, 0xed,
-  0x67, 0xd0, 0x82, 0x45, 0x13, 0x1b, 0x56, 0x3a, 0xe9, 0xe9, 0x61, 0x9d,
-  0x26, 0x2d, 0x66, 0xdc, 0x5a, 0xd0, 0xeb, 0x96, 0x92, 0x67, 0x4f, 0xae,
-  0x6c, 0xb5, 0xe7, 0xed, 0xdc, 0xb9, 0x77, 0xf3, 0xb5, 0xf9, 0xb6, 0x79,
-  0xe8, 0xc5, 0x93, 0x3a, 0xfe, 0x0d, 0x23, 0x1e, 0xf5, 0x78, 0xa7, 0x4f,
-  0xca, 0x57, 0x37, 0x6e, 0xfd, 0x9c, 0xe5, 0x9e, 0x3d, 0x3e, 0x2c, 0xc8,
-  0x9f, 0x4f, 0xdf, 0xc7, 0xfb, 0xa0, 0xd7, 0xb1, 0x67, 0xe7, 0xed, 0xb2,
-  0x7b, 0xeb, 0xef, 0x6a, 0x4d, 0xf2, 0x89, 0x78, 0xe4, 0xf5, 0x64, 0x1e,
-  0x26, 0xe8, 0x2d, 0xc7, 0x1a, 0x7b, 0xbd, 0xb8, 0xf4, 0xde, 0x7c, 0xa7,
-  0xa8, 0x23, 0xa1, 0x3a, 0xa7, 0xcc, 0x77, 0x9f, 0x4d, 0x0f, 0x78, 0xe2,
-  0xc9, 0x19, 0x4c, 0x74, 0xe8, 0x61, 0x87, 0x67, 0x68, 0xc8, 0xd9, 0x4a,
-  0xfe, 0x01, 0xb7, 0x9c, 0x80, 0x98, 0x10, 0x58, 0xdc, 0x4a, 0x24, 0x30,
-  0x83, 0xdc, 0x26, 0x08, 0xa6, 0xa7, 0xd6, 0x82, 0xce, 0x35, 0xd8, 0xd2,
-  0x83, 0x16, 0x44, 0x38, 0xa1, 0x84, 0x15, 0x5a, 0x70, 0x61, 0x4b, 0x19,
-  0x6e, 0xf8, 0xe1, 0x90, 0x4c, 0x84, 0xe8, 0xc9, 0x88, 0x29, 0x95, 0x08,
-  0xe0, 0x23, 0x28, 0x6e, 0x22, 0x1e, 0x33, 0x2b, 0xa2, 0xd4, 0x22, 0x33,
-  0xa0, 0x6c, 0x02, 0x63, 0x82, 0xea, 0xb5, 0xf6, 0x98, 0x83, 0x7b, 0xc8,
-  0xb7, 0xe3, 0x8e, 0xf2, 0xfd, 0xb8, 0x52, 0x90, 0x67, 0x14, 0x61, 0xe6,
-  0x99, 0x68, 0x9a, 0x69, 0x24, 0x92, 0x27, 0xf9, 0xf6, 0x5f, 0x70, 0x01,
-  0x7e, 0x82, 0x89, 0x95, 0xa0, 0x30, 0x03, 0x25, 0x8b, 0x76, 0x9a, 0x62,
-  0xe5, 0x95, 0x32, 0x32, 0xf7, 0x18, 0x54, 0xee, 0x75, 0x69, 0xc1, 0x97,
-  0x13, 0x86, 0xb9, 0x07, 0x90, 0x1a, 0x96, 0x99, 0xe6, 0xa2, 0x6a, 0x8a,
-  0xb8, 0x92, 0x67, 0x26, 0x82, 0x27, 0xe7, 0x9e, 0xa6, 0xd8, 0x19, 0xe5,
-  0x48, 0x53, 0x9a, 0xd2, 0xc9, 0x9e, 0x31, 0x2a, 0xd8, 0xd6, 0x5b, 0x80,
-  0x06, 0xaa, 0x81, 0x06, 0xeb, 0x94, 0x6a, 0x6a, 0xa9, 0xa3, 0x8a, 0x89,
-  0x52, 0x90, 0x63, 0x30, 0xea, 0x6a, 0x11, 0xfe, 0x63, 0x38, 0xaa, 0x92,
-  0x67, 0x4b, 0x36, 0x69, 0x65, 0x27, 0x95, 0xde, 0x69, 0x52, 0xa6, 0x9d,
-  0x6c, 0x6a, 0x65, 0xa7, 0xab, 0x4d, 0xc2, 0x0b, 0x64, 0x5c, 0x8e, 0x7a,
-  0xea, 0xa9, 0xa9, 0x1e, 0xaa, 0x12, 0xab, 0xaf, 0xbe, 0x1a, 0xeb, 0x91,
-  0x8f, 0x82, 0x35, 0x09, 0x9c, 0x4c, 0x4e, 0x7a, 0x2b, 0xae, 0x96, 0x96,
-  0x34, 0xa5, 0x2a, 0xbd, 0xfa, 0xca, 0xe7, 0x89, 0x34, 0x05, 0x35, 0xc8,
-  0x20, 0xc6, 0x1e, 0x8b, 0xaa, 0x06, 0xe3, 0xaa, 0xc4, 0x80, 0x86, 0x63,
-  0xf4, 0xe0, 0xee, 0xbb, 0xf0, 0xc6, 0x1b, 0xef, 0xb3, 0x0c, 0x3c, 0x3a,
-  0x53, 0x9f, 0xb6, 0x3a, 0xd9, 0xab, 0x2a, 0xd9, 0x8a, 0x04, 0x03, 0x34,
-  0xcc, 0x70, 0xdb, 0x2d, 0xa7, 0x58, 0x3e, 0xf2, 0x49, 0xb8, 0xe2, 0x92,
-  0x4b, 0xaa, 0xb9, 0xeb, 0x8c, 0x9a, 0x2e, 0x4a, 0xeb, 0x7a, 0xd2, 0xae,
-  0xbc, 0x14, 0x57, 0x4c, 0xaf, 0xbd, 0xbc, 0x7c, 0x22, 0xe9, 0x9c, 0xd7,
-  0xee, 0xcb, 0x0c, 0x34, 0x30, 0x84, 0xf4, 0x2f, 0x34, 0xaf, 0xa0, 0xd2,
-  0xad, 0xb7, 0xc0, 0xa6, 0x12, 0x0c, 0x2f, 0xa1, 0xda, 0x34, 0x6e, 0xb9,
-  0xe6, 0x3a, 0x3c, 0x08, 0xc4, 0x99, 0x64, 0x32, 0x71, 0xc5, 0x38, 0xcf,
-  0x5b, 0x73, 0xbd, 0xb3, 0x16, 0x95, 0x56, 0xb5, 0x1c, 0xeb, 0xdb, 0x2b,
-  0x2a, 0xaf, 0x40, 0x03, 0xf2, 0x47, 0x1f, 0x18, 0x5d, 0xb2, 0xc9, 0x03,
-  0xff, 0x9a, 0xa0, 0xca, 0xc1, 0xb4, 0xec, 0xf2, 0x20, 0x20, 0x80, 0xc0,
-  0xf0, 0x3a, 0x55, 0x3f, 0x5c, 0x12, 0x03, 0x35, 0xdf, 0x9c, 0xf3, 0xd7,
-  0xee, 0x8e, 0xb1, 0xf3, 0xa3, 0x31, 0xa5, 0x95, 0xef, 0xc9, 0xa8, 0x10,
-  0x6d, 0xf4, 0x07, 0x1d, 0x25, 0x0d, 0x4d, 0x2d, 0xa6, 0xa4, 0x7d, 0x32,
-  0xc1, 0x93, 0x6c, 0x12, 0x93, 0xd4, 0x53, 0x57, 0x7d, 0x75, 0xfe, 0xd6,
-  0x33, 0x6f, 0x5d, 0x73, 0x13, 0x60, 0x07, 0xfe, 0x6e, 0x13, 0x63, 0xcf,
-  0x1a, 0xd3, 0x26, 0x67, 0x77, 0x9b, 0xb6, 0x29, 0xb5, 0xac, 0xbd, 0x91,
-  0xdb, 0x70, 0xc7, 0xcd, 0x74, 0xaf, 0x04, 0x8f, 0x16, 0x75, 0x49, 0x08,
-  0x8c, 0xab, 0xf9, 0x20, 0x08, 0x24, 0x34, 0xae, 0xde, 0x0c, 0xf3, 0x9d,
-  0x50, 0xe6, 0x9b, 0x73, 0x4e, 0x11, 0xd7, 0x99, 0x34, 0xb1, 0xc3, 0xea,
-  0xac, 0xb7, 0xde, 0x3a, 0x0a, 0x28, 0xb8, 0x2e, 0x3b, 0xeb, 0x84, 0x67,
-  0xc2, 0x73, 0x4a, 0x19, 0x04, 0x93, 0x9a, 0xb5, 0x42, 0x77, 0xb2, 0x38,
-  0xe3, 0x8e, 0x63, 0x04, 0x83, 0x35, 0x6f, 0xab, 0x62, 0x8a, 0xe4, 0x73,
-  0x3b, 0x2d, 0x0b, 0x31, 0x1c, 0x60, 0x5e, 0xc8, 0xf3, 0xd0, 0x3f, 0xdf,
-  0xf9, 0x41, 0xcf, 0x57, 0x3d, 0x8a, 0xb9, 0xa3, 0x54, 0xfd, 0x3c, 0x42,
-  0x08, 0x44, 0x1f, 0xfd, 0xf4, 0x10, 0xa1, 0xde, 0x84, 0x0d, 0xe4, 0x97,
-  0x6f, 0xbe, 0xf9, 0x23, 0xb0, 0xc2, 0xca, 0x08, 0xe7, 0xb7, 0x5f, 0x7e,
-  0xed, 0xb7, 0xa3, 0xc4, 0x01, 0x31, 0xb2, 0xf0, 0x8e, 0x36, 0x2a, 0xc7,
-  0xab, 0xd2, 0xb8, 0x35, 0x21, 0x5b, 0x34, 0xbc, 0x35, 0xb1, 0x50, 0x85,
-  0xf1, 0x90, 0xd7, 0xb4, 0x2b, 0x59, 0x4e, 0x26, 0x33, 0x79, 0xcb, 0x5b,
-  0x6c, 0xc1, 0x40, 0x06, 0xde, 0xe2, 0x81, 0xb7, 0x68, 0x85, 0x04, 0x31,
-  0xe0, 0x90, 0xee, 0x15, 0x02, 0x08, 0x25, 0xc8, 0x60, 0x09, 0x80, 0x20,
-  0x3d, 0xea, 0x15, 0x22, 0x83, 0x15, 0xb8, 0x9e, 0xa9, 0x46, 0x51, 0x81,
-  0x0c, 0x6e, 0xcf, 0x20, 0x16, 0xc4, 0xa0, 0x06, 0x39, 0x58, 0x08, 0xf0,
-  0x35, 0x84, 0x01, 0x90, 0x80, 0xc4, 0xf8, 0xdc, 0xd7, 0xbe, 0xf4, 0xc1,
-  0x03, 0x1e, 0xeb, 0xa3, 0x61, 0xfb, 0x9a, 0x10, 0xc3, 0xf8, 0x41, 0x04,
-  0x03, 0xfe, 0x12, 0x6c, 0x05, 0x04, 0x6f, 0xd1, 0x40, 0x06, 0x2a, 0x10,
-  0x2c, 0x33, 0x11, 0xcb, 0x26, 0xec, 0xa7, 0x38, 0xfc, 0x99, 0x42, 0x80,
-  0xb1, 0xb0, 0x06, 0xff, 0x2a, 0xf2, 0x3f, 0x5a, 0xbc, 0x42, 0x80, 0xc7,
-  0x93, 0x5b, 0x01, 0x63, 0xb4, 0x09, 0x5c, 0x20, 0x70, 0x58, 0x0a, 0x2c,
-  0xa2, 0x2d, 0x86, 0x18, 0xc4, 0x56, 0x50, 0x70, 0x21, 0x16, 0x7c, 0x82,
-  0x06, 0x35, 0xf8, 0x84, 0x0e, 0x16, 0xe4, 0x79, 0x1a, 0xac, 0x40, 0x29,
-  0xd8, 0xc1, 0x8e, 0x52, 0x94, 0xd0, 0x84, 0x85, 0x40, 0xe1, 0xf3, 0xd4,
-  0xb8, 0xc6, 0x12, 0xb4, 0xb1, 0x85, 0x0e, 0x81, 0x21, 0x24, 0x86, 0x30,
-  0x83, 0x42, 0x1a, 0xf2, 0x90, 0x87, 0xb4, 0xe1, 0x0d, 0x71, 0x38, 0x02,
-  0x44, 0x3a, 0xd2, 0x90, 0x43, 0xe8, 0xa1, 0x44, 0x80, 0x18, 0xc4, 0x21,
-  0x8a, 0xf1, 0x88, 0x61, 0x09, 0x06, 0x2e, 0x10, 0xc7, 0xc4, 0xa1, 0x39,
-  0x51, 0x80, 0xaf, 0xa0, 0x85, 0x14, 0xfb, 0x17, 0x91, 0x2a, 0xbe, 0xe2,
-  0x8a, 0x03, 0xd4, 0x22, 0xe5, 0x9c, 0xd6, 0x27, 0x1a, 0x09, 0x02, 0x10,
-  0x80, 0xe0, 0x03, 0x1f, 0xe4, 0x40, 0x4b, 0x5a, 0xce, 0xe1, 0x96, 0x7c,
-  0x98, 0xe0, 0x42, 0xf6, 0xd8, 0x47, 0x36, 0xba, 0x71, 0x20, 0x70, 0x2c,
-  0x01, 0x3b, 0x5c, 0x51, 0x81, 0x05, 0x2c, 0xa0, 0x02, 0xae, 0x60, 0x07,
-  0x1e, 0x0b, 0x92, 0xc6, 0x5e, 0x66, 0xf0, 0x8f, 0x2f, 0x8c, 0x21, 0x21,
-  0x1f, 0xf9, 0x48, 0x56, 0x2c, 0x72, 0x91, 0xac, 0xa0, 0xe6, 0x23, 0x23,
-  0x09, 0x09, 0x1f, 0x2e, 0x84, 0x92, 0x7c, 0xb8, 0xe5, 0x1c, 0x6a, 0x49,
-  0x4b, 0x59, 0xc2, 0xb2, 0x39, 0x91, 0x8a, 0x53, 0xd0, 0xee, 0x97, 0x3f,
-  0x55, 0x9c, 0x52, 0x94, 0x53, 0x84, 0xc8, 0xff, 0x7e, 0x71, 0x4a, 0x54,
-  0x66, 0x71, 0x72, 0x28, 0xfe, 0x2b, 0x18, 0x73, 0x9a, 0x03, 0x4b, 0x59,
-  0x92, 0x53, 0x0e, 0xe2, 0x1c, 0xa7, 0x2e, 0x13, 0xf2, 0xbc, 0x14, 0x18,
-  0xf4, 0xa0, 0x08, 0xfd, 0xa3, 0x02, 0x08, 0x52, 0xd0, 0x14, 0xd0, 0xd1,
-  0x15, 0x06, 0x4d, 0x26, 0x3b, 0x0c, 0x7a, 0x42, 0x81, 0x28, 0x60, 0x8f,
-  0x08, 0xcd, 0x68, 0x0a, 0x2a, 0x9a, 0x10, 0x41, 0x0e, 0xa1, 0x05, 0x20,
-  0x0d, 0xa9, 0x48, 0x47, 0xda, 0x82, 0x6b, 0x5e, 0x93, 0xa4, 0x28, 0x0d,
-  0x29, 0x37, 0xbd, 0x89, 0x10, 0x4a, 0x02, 0x54, 0x9c, 0xff, 0x34, 0x27,
-  0x20, 0xd0, 0x59, 0xab, 0x4e, 0xfa, 0xee, 0x93, 0xee, 0x3c, 0xe5, 0x2f,
-  0x46, 0xf9, 0x90, 0x79, 0xc6, 0xa2, 0x9e, 0x58, 0x24, 0x60, 0xaf, 0x08,
-  0xd1, 0x0c, 0x7c, 0x18, 0xd5, 0x1e, 0x48, 0xb5, 0x47, 0x3d, 0x96, 0x5a,
-  0x0f, 0x41, 0xb4, 0x41, 0x18, 0xf4, 0x88, 0xea, 0x3c, 0xa6, 0x4a, 0xd5,
-  0x79, 0x2c, 0x03, 0xa6, 0x03, 0x3d, 0x08, 0x23, 0x18, 0xa1, 0xd1, 0x8c,
-  0x3e, 0x61, 0xab, 0x0b, 0x15, 0xc8, 0x56, 0x0d, 0x4a, 0xc7, 0xb2, 0x96,
-  0xd5, 0xa0, 0x5b, 0x1d, 0x88, 0x02, 0xb6, 0xfa, 0x84, 0xae, 0x22, 0x34,
-  0xad, 0x0a, 0x51, 0x80, 0x34, 0x53, 0x4a, 0x57, 0x93, 0x2e, 0x92, 0xae,
-  0x29, 0xe5, 0x66, 0x58, 0x15, 0xe2, 0x52, 0x71, 0x2e, 0xa3, 0xaa, 0x54,
-  0x8d, 0x2a, 0x3d, 0x84, 0xd1, 0x06, 0x41, 0x30, 0xb5, 0x1e, 0x49, 0xb5,
-  0x87, 0x51, 0xf1, 0xd1, 0x0c, 0x42, 0xb0, 0xf3, 0x89, 0x39, 0x7d, 0x45,
-  0x2c, 0x76, 0x1a, 0xcf, 0x85, 0xf8, 0xf4, 0xa7, 0xa7, 0x0c, 0xaa, 0x2a,
-  0x15, 0x51, 0xd4, 0xc5, 0x26, 0x96, 0xa9, 0xd3, 0x78, 0xaa, 0x60, 0xe9,
-  0x01, 0x58, 0xaa, 0x5e, 0x75, 0x0e, 0x69, 0x90, 0x43, 0x56, 0x0b, 0xb2,
-  0x55, 0x11, 0xb8, 0xf6, 0xb5, 0xb0, 0x75, 0xfe, 0x6d, 0x10, 0xc0, 0x2a,
-  0x56, 0x46, 0xb8, 0xd6, 0xac, 0x66, 0x75, 0x2d, 0x5c, 0xd7, 0xca, 0x88,
-  0x20, 0xc4, 0xf6, 0xb7, 0x22, 0x80, 0x2b, 0x42, 0xe4, 0x0a, 0x89, 0x23,
-  0xe0, 0x35, 0xa5, 0xee, 0x48, 0xae, 0x72, 0x93, 0x7b, 0x5c, 0x94, 0x1e,
-  0x21, 0x86, 0x7b, 0x3d, 0x88, 0x4b, 0xd3, 0x70, 0xcb, 0xbf, 0x96, 0x76,
-  0x1e, 0xa3, 0x25, 0xec, 0x34, 0x98, 0x9a, 0xd8, 0xc5, 0x32, 0x56, 0x11,
-  0x4d, 0x6c, 0x67, 0x3d, 0x63, 0x31, 0x59, 0x9e, 0x2a, 0xe4, 0xb2, 0x98,
-  0xb5, 0x27, 0x01, 0x15, 0xf1, 0x0c, 0xef, 0xe2, 0xe3, 0xb3, 0xf5, 0x08,
-  0xad, 0x30, 0xea, 0x31, 0xda, 0xeb, 0x4e, 0xf5, 0x96, 0x69, 0x48, 0xad,
-  0x04, 0x11, 0xd2, 0x5a, 0xe0, 0xc6, 0xf6, 0x08, 0xb4, 0xed, 0x2f, 0x6e,
-  0xcb, 0xaa, 0x5b, 0x46, 0x00, 0x80, 0xb7, 0x47, 0xf0, 0x6f, 0x6c, 0x85,
-  0x6b, 0x10, 0xe2, 0x1a, 0xb7, 0xb9, 0x47, 0x30, 0xc3, 0x83, 0x5b, 0xb0,
-  0xdc, 0xe5, 0x86, 0x34, 0xc2, 0x13, 0xc6, 0xeb, 0x73, 0x21, 0x11, 0xdd,
-  0x82, 0x48, 0x50, 0x0e, 0xf9, 0xbd, 0xa5, 0x7d, 0xb1, 0x2b, 0xd8, 0x7a,
-  0x68, 0x77, 0xa9, 0xdd, 0xf5, 0xee, 0x33, 0xc0, 0x7b, 0x53, 0xf1, 0x9e,
-  0x92, 0xbc, 0xe5, 0xad, 0xac, 0x41, 0xd0, 0x9b, 0x5e, 0xcd, 0x9a, 0x8c,
-  0xbd, 0xee, 0x7d, 0x6f, 0x52, 0x97, 0xba, 0x88, 0x2d, 0x2c, 0xb5, 0xbe,
-  0xf6, 0xc5, 0x6f, 0x7e, 0xf7, 0xab, 0x55, 0x46, 0x24, 0x58, 0xc1, 0xaf,
-  0x05, 0x30, 0x23, 0xd6, 0x6a, 0x87, 0xdb, 0x0e, 0x98, 0x1d, 0xae, 0xb5,
-  0xc3, 0x92, 0xb7, 0x7a, 0x64, 0x24, 0x8b, 0x40, 0xc9, 0xc3, 0xa5, 0xb2,
-  0x09, 0xb6, 0xcc, 0xe5, 0x2e, 0x73, 0x59, 0xc9, 0x46, 0xde, 0x72, 0x85,
-  0x95, 0xbb, 0x65, 0x30, 0x1f, 0xc1, 0xcb, 0x68, 0x2e, 0x33, 0xfe, 0x6d,
-  0x0f, 0x22, 0xc1, 0xfc, 0x52, 0x77, 0x0e, 0x23, 0x1e, 0xed, 0x52, 0xb7,
-  0xb0, 0x08, 0x14, 0x27, 0x35, 0xc7, 0x2b, 0x6e, 0x31, 0x64, 0xc7, 0x0b,
-  0x63, 0xca, 0x92, 0xb2, 0x20, 0x34, 0x06, 0x6a, 0x2a, 0x6f, 0xdc, 0x5e,
-  0xf7, 0xc2, 0xb7, 0xc7, 0x3f, 0x16, 0xec, 0x88, 0x85, 0x9c, 0x06, 0x22,
-  0x37, 0x58, 0xcb, 0x69, 0xf6, 0xb2, 0x99, 0xc5, 0x3c, 0x66, 0x77, 0xa8,
-  0x19, 0xd2, 0x91, 0xfe, 0xf2, 0x9a, 0x0d, 0x42, 0x65, 0x2b, 0xbb, 0x56,
-  0xc9, 0x4c, 0x76, 0xf2, 0x80, 0xa3, 0x3c, 0x65, 0x23, 0x7b, 0xfa, 0xca,
-  0x0c, 0x26, 0x48, 0x9b, 0x43, 0x0c, 0x67, 0xfb, 0xca, 0xb9, 0x1e, 0x74,
-  0xb6, 0x33, 0x52, 0xf1, 0x0c, 0xde, 0xdf, 0x81, 0xf2, 0xc5, 0x7d, 0x36,
-  0xef, 0x41, 0xd0, 0x2b, 0xe8, 0x7b, 0xf6, 0x0a, 0xc7, 0xde, 0x85, 0xaf,
-  0x7c, 0xe9, 0xab, 0xe8, 0x20, 0xa3, 0x56, 0xbf, 0xad, 0x48, 0x88, 0x83,
-  0x9b, 0xdb, 0x02, 0x0c, 0x87, 0xb4, 0xd2, 0xee, 0xb8, 0xb0, 0x84, 0x99,
-  0xbd, 0xe1, 0x0e, 0x13, 0xa4, 0xbf, 0x56, 0x06, 0x35, 0x00, 0x04, 0xfc,
-  0xe4, 0x02, 0x1f, 0xb8, 0xd3, 0x9e, 0x4e, 0xf5, 0x40, 0x3e, 0xcc, 0xea,
-  0x38, 0x97, 0xf8, 0xc4, 0x88, 0xbd, 0xb3, 0x8a, 0x59, 0x6c, 0xeb, 0xc8,
-  0xe6, 0x5a, 0xc6, 0xbb, 0x96, 0xe2, 0x2f, 0xc8, 0xdb, 0x6b, 0xa1, 0x72,
-  0x36, 0xd8, 0x3b, 0x5e, 0xaa, 0x7c, 0x81, 0x5c, 0xda, 0xd3, 0x22, 0xfb,
-  0x8c, 0xc3, 0x8d, 0x61, 0x86, 0x99, 0x4d, 0xe1, 0x4a, 0x13, 0x5c, 0xa4,
-  0xd5, 0x56, 0x08, 0xb6, 0x15, 0x3c, 0xdb, 0x25, 0xd7, 0x56, 0xd4, 0xb8,
-  0xf5, 0xf6, 0xb7, 0x7b, 0x1b, 0x6e, 0x03, 0x4b, 0x97, 0xdc, 0xd5, 0x75,
-  0xb5, 0x60, 0xd1, 0x9d, 0xee, 0x59, 0x2f, 0xb6, 0x19, 0x2c, 0xd6, 0xf3,
-  0xad, 0xfe, 0x25, 0x1b, 0xe3, 0x3f, 0x27, 0xc4, 0xa7, 0xf5, 0x56, 0x65,
-  0x27, 0x88, 0xea, 0xd9, 0x7c, 0x2f, 0xd5, 0xa9, 0x50, 0x95, 0x6a, 0xbf,
-  0xb1, 0x6a, 0x46, 0x86, 0x10, 0xf7, 0xa3, 0x07, 0x2f, 0xa9, 0x5d, 0xe1,
-  0x91, 0xf3, 0x16, 0xe8, 0x75, 0x21, 0x63, 0x75, 0xab, 0x41, 0xbf, 0xea,
-  0xf0, 0xda, 0x92, 0xf5, 0xc9, 0x68, 0xb5, 0xf8, 0xc4, 0xdb, 0x2a, 0xf4,
-  0x14, 0x88, 0x7b, 0x20, 0x7d, 0xcd, 0x78, 0x69, 0x37, 0x5e, 0xd8, 0xc3,
-  0xa6, 0x98, 0xb1, 0x8e, 0x0d, 0xef, 0x9e, 0x5f, 0xec, 0xe7, 0x9e, 0xca,
-  0x3b, 0xe5, 0xf8, 0xa4, 0x9b, 0xa7, 0xd0, 0xd9, 0xcf, 0x59, 0x92, 0x33,
-  0xa0, 0xaa, 0xad, 0x79, 0x34, 0x07, 0x99, 0xf3, 0x9d, 0xf3, 0xfc, 0xe0,
-  0x2b, 0x65, 0x48, 0x43, 0xdd, 0xaa, 0x50, 0x86, 0x16, 0xe2, 0xe8, 0x10,
-  0x4d, 0x81, 0x44, 0x29, 0x9a, 0x47, 0xb5, 0x62, 0x54, 0xe8, 0x1c, 0x35,
-  0x48, 0xd4, 0x6f, 0x19, 0x53, 0x3e, 0x9c, 0xd3, 0x3b, 0xd4, 0x4a, 0x9c,
-  0x27, 0x5d, 0xfc, 0x8a, 0xae, 0xcb, 0x53, 0x8a, 0x56, 0x54, 0xaf, 0xca,
-  0xc5, 0x9e, 0x25, 0x7e, 0xc6, 0xd2, 0xec, 0xb5, 0x14, 0x67, 0x2e, 0xd5,
-  0x1e, 0x48, 0x69, 0x6a, 0xd3, 0x91, 0xd6, 0x34, 0x69, 0x36, 0x3f, 0x7f,
-  0xc8, 0xb8, 0xcb, 0xbd, 0x10, 0x7c, 0xec, 0xe5, 0x1f, 0x5d, 0x08, 0x80,
-  0x60, 0x0e, 0xb3, 0x98, 0xc7, 0x4c, 0xe6, 0x32, 0x09, 0xd2, 0x4c, 0x67,
-  0x42, 0x93, 0xaf, 0x12, 0x0c, 0x27, 0xe1, 0xc9, 0x29, 0x53, 0x9a, 0x26,
-  0xde, 0xa6, 0xed, 0x7e, 0xa7, 0xae, 0x1f, 0x6f, 0x0d, 0x2b, 0xda, 0x38,
-  0x79, 0x7c, 0xea, 0xe2, 0x17, 0x8f, 0x28, 0x46, 0x32, 0x06, 0x11, 0xe0,
-  0x0f, 0xf1, 0x28, 0xe9, 0x0d, 0xa9, 0xc8, 0x1b, 0xae, 0x6f, 0xfa, 0x85,
-  0x34, 0x3d, 0x43, 0x6a, 0xfe, 0xbf, 0xc6, 0xd5, 0x1b, 0x24, 0x98, 0x25,
-  0x90, 0x23, 0x1d, 0xed, 0xa8, 0xc1, 0xc0, 0x03, 0x80, 0xfb, 0xbe, 0x04,
-  0xe4, 0x37, 0xcb, 0x68, 0xc9, 0x22, 0x62, 0x32, 0x89, 0x9a, 0xe4, 0xe4,
-  0x3a, 0xb5, 0x0e, 0x4a, 0x78, 0x9a, 0x9c, 0xf8, 0x01, 0x1c, 0x34, 0xf2,
-  0x11, 0x74, 0xc0, 0x95, 0x25, 0x30, 0x8c, 0x45, 0xe4, 0x7c, 0x9c, 0x17,
-  0x11, 0x82, 0x34, 0x43, 0x3a, 0x54, 0x3e, 0x8a, 0x94, 0x43, 0x07, 0xf8,
-  0x3e, 0x92, 0xf4, 0x10, 0x29, 0xb4, 0x46, 0x2c, 0xc4, 0x7a, 0x02, 0x11,
-  0x4c, 0x21, 0x74, 0x2a, 0x24, 0x34, 0x7b, 0xcc, 0xf4, 0x3c, 0x2a, 0x94,
-  0x41, 0x11, 0xe8, 0x10, 0x94, 0x24, 0x44, 0x10, 0x74, 0x49, 0x0a, 0x94,
-  0x49, 0xba, 0xb3, 0x44, 0xf3, 0xb7, 0x78, 0x90, 0x15, 0x45, 0xf0, 0x26,
-  0x11, 0xc3, 0x53, 0x3c, 0xbe, 0xb6, 0x45, 0x9f, 0xb0, 0x3c, 0xcd, 0xa3,
-  0x2e, 0x7f, 0xb3, 0x80, 0x08, 0xa8, 0x3e, 0xec, 0x63, 0x83, 0x36, 0x00,
-  0x3f, 0x12, 0x61, 0x41, 0xde, 0xa3, 0x7e, 0xdf, 0x57, 0x08, 0xd6, 0x83,
-  0x3d, 0xda, 0xd3, 0x77, 0x7a, 0xf4, 0x83, 0x40, 0x28, 0x12, 0xf3, 0x53,
-  0x3f, 0x27, 0x28, 0x72, 0xfb, 0x73, 0x7f, 0x13, 0x01, 0x39, 0x2f, 0xb8,
-  0x4a, 0x06, 0xc4, 0x14, 0x78, 0x43, 0x12, 0xe2, 0x33, 0x3b, 0xb3, 0x03,
-  0x3b, 0x5a, 0x28, 0x3b, 0x3c, 0x38, 0x11, 0xa4, 0xb3, 0x39, 0x12, 0x38,
-  0x10, 0x9f, 0x63, 0x35, 0xa1, 0x03, 0x02, 0x5a, 0x83, 0x42, 0xa5, 0x63,
-  0x3a, 0x24, 0x91, 0x3b, 0xbb, 0xd3, 0x84, 0xbf, 0xd3, 0x38, 0xd0, 0xc0,
-  0x36, 0x1a, 0x21, 0x85, 0x93, 0xc7, 0x4a, 0x76, 0x73, 0x39, 0x34, 0x98,
-  0x3a, 0x82, 0x23, 0x38, 0x5f, 0x48, 0x12, 0x65, 0xb8, 0x37, 0x68, 0xd8,
-  0x37, 0x51, 0x91, 0x3b, 0xc1, 0x20, 0x7f, 0xfe, 0x7b, 0xc2, 0x4e, 0x72,
-  0x48, 0x87, 0x8f, 0xa3, 0x34, 0x77, 0xf8, 0x2d, 0x50, 0x73, 0x85, 0x23,
-  0x81, 0x3a, 0x5e, 0xd3, 0x87, 0x14, 0x23, 0x36, 0xb6, 0x73, 0x12, 0x81,
-  0x78, 0x86, 0x69, 0xd8, 0x19, 0x65, 0x03, 0x34, 0x89, 0xd8, 0x44, 0x45,
-  0x33, 0x87, 0x1f, 0x31, 0x32, 0x25, 0xb3, 0x7f, 0x58, 0xa2, 0x32, 0x2c,
-  0xb3, 0x12, 0x94, 0x68, 0x89, 0x16, 0x53, 0x38, 0x26, 0xf1, 0x32, 0x0b,
-  0x13, 0x33, 0xe8, 0x42, 0x88, 0x9d, 0xe1, 0x33, 0xea, 0x14, 0x8a, 0x43,
-  0x33, 0x8a, 0x50, 0xa8, 0x11, 0xff, 0x12, 0x30, 0xa8, 0x28, 0x23, 0x07,
-  0xb3, 0x8a, 0xea, 0xc2, 0x2e, 0xae, 0x38, 0x2f, 0x1a, 0xc2, 0x52, 0x22,
-  0x21, 0x8b, 0x57, 0x23, 0x33, 0x49, 0x31, 0x14, 0x19, 0xb3, 0x31, 0xba,
-  0xd8, 0x09, 0xfc, 0x72, 0x34, 0x22, 0xb1, 0x2d, 0x30, 0x88, 0x2f, 0x08,
-  0x93, 0x12, 0x11, 0x53, 0x89, 0x7d, 0x78, 0x31, 0x29, 0xc1, 0x8c, 0x0c,
-  0xe3, 0x8c, 0xb7, 0xc8, 0x0b, 0xf8, 0xd2, 0x49, 0xfc, 0xa2, 0x2b, 0x98,
-  0x92, 0x27, 0x54, 0x08, 0x2c, 0x33, 0x22, 0x2c, 0xc4, 0xb2, 0x2a, 0xec,
-  0xd2, 0x2c, 0xae, 0xf2, 0x2c, 0x6c, 0x52, 0x12, 0xef, 0x01, 0x33, 0xc7,
-  0x92, 0x2c, 0x9d, 0x21, 0x2d, 0xbf, 0x37, 0x7f, 0xb9, 0x72, 0x29, 0x20,
-  0xc1, 0x2b, 0x94, 0x37, 0x23, 0x9f, 0x12, 0x8f, 0x27, 0xc1, 0x2c, 0xf4,
-  0x88, 0x26, 0xf6, 0x28, 0x2a, 0xb3, 0xb8, 0x8f, 0x1a, 0xa0, 0x2a, 0xb3,
-  0xe2, 0x1b, 0x35, 0xb5, 0x4e, 0x01, 0x99, 0x12, 0x99, 0x52, 0x90, 0x7e,
-  0x02, 0x2a, 0x63, 0x92, 0x28, 0x0b, 0xd9, 0x28, 0xd0, 0x12, 0x28, 0x5e,
-  0x42, 0x28, 0xea, 0x60, 0x28, 0x2e, 0x01, 0x29, 0x15, 0x49, 0x29, 0xfd,
-  0x82, 0x91, 0x76, 0x52, 0x25, 0xdf, 0x52, 0x79, 0x5b, 0xd2, 0xfe, 0x91,
-  0x1b, 0xb2, 0x90, 0x6b, 0xc2, 0x25, 0x23, 0x49, 0x28, 0x26, 0xd9, 0x12,
-  0x6e, 0x92, 0x4e, 0xa0, 0xb8, 0x09, 0x75, 0xa2, 0x8e, 0x2a, 0xd1, 0x22,
-  0x2f, 0xe2, 0x8e, 0xfb, 0x54, 0x23, 0x88, 0x22, 0x24, 0x44, 0xe2, 0x21,
-  0x35, 0x69, 0x93, 0x39, 0x42, 0x28, 0x3d, 0x22, 0x91, 0x28, 0xa1, 0x24,
-  0xff, 0xe8, 0x24, 0xc3, 0x00, 0x94, 0x2c, 0x32, 0x1e, 0x9d, 0x40, 0x94,
-  0x34, 0xd2, 0x1e, 0x32, 0xc9, 0x21, 0x49, 0xb9, 0x94, 0x4c, 0xd9, 0x94,
-  0x13, 0xd2, 0x23, 0x3e, 0xa2, 0x2c, 0x2c, 0x21, 0x95, 0x27, 0x22, 0x27,
-  0x2a, 0x12, 0x14, 0xe6, 0xa1, 0x4f, 0x5b, 0x69, 0x23, 0x40, 0xa2, 0x15,
-  0xb8, 0xa1, 0x1f, 0xba, 0xc1, 0x1f, 0x36, 0xf1, 0x1e, 0xf1, 0x41, 0x1f,
-  0x7a, 0x69, 0x1f, 0x66, 0x49, 0x22, 0xbd, 0x80, 0x78, 0x69, 0xb9, 0x96,
-  0xc6, 0x81, 0x95, 0xad, 0xb4, 0x1e, 0x46, 0x89, 0x21, 0x72, 0xa9, 0x1f,
-  0xda, 0x71, 0x8f, 0x2b, 0x11, 0x1d, 0xd2, 0x51, 0x17, 0xb5, 0x71, 0x96,
-  0x7f, 0xf9, 0x26, 0x27, 0x22, 0x98, 0xe5, 0x81, 0x1a, 0xaa, 0x61, 0x90,
-  0x5a, 0xc2, 0x95, 0x71, 0x19, 0x0a, 0x73, 0xb9, 0x98, 0x57, 0xe1, 0x98,
-  0xd3, 0x11, 0x99, 0x92, 0xf9, 0x1b, 0x4b, 0x32, 0x1a, 0x05, 0x62, 0x1a,
-  0x85, 0x91, 0x99, 0xac, 0xf1, 0x27, 0x49, 0x81, 0x19, 0x9a, 0xb1, 0x1d,
-  0xa1, 0x19, 0x1b, 0xb3, 0x41, 0x1d, 0xfd, 0xf8, 0x17, 0xe9, 0x34, 0x1a,
-  0x86, 0x71, 0x18, 0x67, 0xf1, 0x33, 0x6c, 0xe1, 0x9a, 0xb6, 0xb1, 0x17,
-  0xb2, 0xd9, 0x15, 0xd1, 0x61, 0x9b, 0x41, 0x41, 0x2b, 0xc1, 0x41, 0x18,
-  0xbb, 0x79, 0x18, 0x00, 0xb0, 0x14, 0x4d, 0x91, 0x40, 0x92, 0xd8, 0x99,
-  0x8c, 0x19, 0x17, 0x54, 0x41, 0x9a, 0xfd, 0x48, 0x82, 0xcb, 0xc9, 0x9c,
-  0xcd, 0x29, 0xf9, 0x9c, 0xc4, 0x78, 0x19, 0xd3, 0x19, 0x15, 0x53, 0x61,
-  0x9d, 0xc7, 0x49, 0x82, 0x02, 0xa9, 0x9d, 0xe6, 0x79, 0x9e, 0xe8, 0x99,
-  0x9e, 0xea, 0xb9, 0x9e, 0xec, 0xd9, 0x9e, 0xee, 0xf9, 0x9e, 0xf0, 0x19,
-  0x9f, 0xf2, 0x39, 0x9f, 0xf3, 0x19, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x01,
-  0x14, 0x00, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-  0x00, 0x00, 0x08, 0xfe, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1,
-  0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23,
-  0x4a, 0x9c, 0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8,
-  0xb1, 0xa3, 0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9,
-  0x93, 0x28, 0x53, 0xaa, 0x5c, 0xc9, 0xb2, 0x25, 0xc5, 0x08, 0x9d, 0x3a,
-  0x6d, 0x4a, 0x45, 0xb3, 0x81, 0x4b, 0x84, 0x01, 0x88, 0xe8, 0x24, 0x12,
-  0xe0, 0x66, 0xc3, 0x03, 0x07, 0x7c, 0x22, 0x6c, 0x40, 0x33, 0xd5, 0xa6,
-  0x98, 0x11, 0x84, 0x32, 0x8c, 0x20, 0x2b, 0xe6, 0xcc, 0xa2, 0x36, 0x95,
-  0x02, 0xc8, 0xb9, 0x53, 0x67, 0x4f, 0xa9, 0x06, 0x0f, 0xd4, 0xa9, 0x13,
-  0x14, 0x2b, 0x00, 0xa2, 0x45, 0x8f, 0x76, 0x92, 0x95, 0xd4, 0x6b, 0x41,
-  0xa6, 0xb2, 0x3e, 0x3d, 0x7a, 0x14, 0x69, 0xd1, 0xa3, 0x54, 0x9f, 0xa2,
-  0xfa, 0xa4, 0x4a, 0xa1, 0x2e, 0x05, 0xab, 0x66, 0x05, 0x6a, 0xdd, 0xca,
-  0x15, 0x6b, 0x83, 0x4f, 0xa9, 0x1e, 0x2d, 0x8a, 0xb4, 0xf6, 0x93, 0x2c,
-  0xb2, 0x79, 0x05, 0xa2, 0x55, 0xbb, 0xb6, 0xad, 0xa0, 0x48, 0x9f, 0xe2,
-  0xce, 0x35, 0x62, 0xc4, 0xae, 0x5d, 0xca, 0x57, 0xb1, 0xee, 0xbd, 0x72,
-  0x65, 0x6b, 0x57, 0x9f, 0x7f, 0x3f, 0x45, 0x12, 0x34, 0x78, 0xed, 0x23,
-  0xc3, 0x88, 0xcd, 0x46, 0xc0, 0x25, 0x2b, 0xb0, 0x69, 0xc7, 0xa4, 0x23,
-  0xdf, 0x0c, 0x40, 0xd9, 0xb2, 0x65, 0xcc, 0x58, 0x0d, 0x6c, 0xbd, 0xb2,
-  0x64, 0x49, 0xe7, 0x3a, 0x06, 0x84, 0x46, 0x5e, 0x24, 0x88, 0x34, 0x61,
-  0xd3, 0xa9, 0x64, 0xe1, 0x2a, 0x2b, 0x75, 0x35, 0xae, 0x4d, 0x93, 0xf0,
-  0x20, 0xb3, 0x57, 0xaf, 0xde, 0xb4, 0xe2, 0x82, 0x64, 0xb7, 0xa4, 0x5d,
-  0xd9, 0xf6, 0x6d, 0x23, 0x99, 0x6f, 0xfe, 0xea, 0xae, 0xc3, 0xdb, 0x85,
-  0x0b, 0xdf, 0x5b, 0x83, 0xdf, 0x8c, 0x8c, 0x7d, 0x5a, 0x75, 0x7b, 0xc8,
-  0xf0, 0x4c, 0xda, 0x84, 0x6b, 0x79, 0xf3, 0xfa, 0x9b, 0x3e, 0x49, 0xb7,
-  0x47, 0xbd, 0x3a, 0x76, 0xed, 0x2c, 0xd5, 0x66, 0xc1, 0x80, 0x04, 0x16,
-  0x48, 0x01, 0x65, 0x42, 0x8d, 0x57, 0x1e, 0x2c, 0xb0, 0x9c, 0xf7, 0x9b,
-  0x7a, 0x2d, 0xb1, 0x57, 0x5c, 0x75, 0xf5, 0xf0, 0x17, 0xdf, 0x27, 0xf4,
-  0xd9, 0xe7, 0x13, 0x07, 0xaa, 0x3c, 0x87, 0x09, 0x21, 0xd3, 0xf1, 0x47,
-  0xe1, 0x7f, 0x9f, 0xb8, 0x44, 0x19, 0x81, 0xa7, 0xa8, 0xa3, 0xa2, 0x3a,
-  0xa7, 0x10, 0x88, 0xa0, 0x78, 0x5b, 0x51, 0xc1, 0x04, 0x0b, 0xb0, 0xc0,
-  0x03, 0x0f, 0x2c, 0x2c, 0x30, 0x41, 0x45, 0x7a, 0x2e, 0x49, 0x28, 0x08,
-  0x85, 0xfc, 0xc1, 0x47, 0x08, 0x26, 0xf4, 0xa9, 0xc2, 0xc1, 0x4d, 0x1c,
-  0xbc, 0xa2, 0x8a, 0x4c, 0x20, 0x06, 0xd9, 0x5f, 0x3d, 0x24, 0x9a, 0x68,
-  0xc4, 0x80, 0x29, 0xae, 0xa8, 0x62, 0x8b, 0x16, 0xbc, 0xd8, 0xd2, 0x78,
-  0x32, 0xd2, 0x68, 0xa3, 0x8d, 0x38, 0xea, 0xc8, 0x23, 0x4b, 0x3e, 0x02,
-  0x19, 0x24, 0x32, 0x84, 0x1c, 0xa5, 0xca, 0x2b, 0x47, 0xb2, 0x94, 0xe4,
-  0x2b, 0x4c, 0x22, 0x83, 0x8f, 0x93, 0xd5, 0x5d, 0x17, 0x5b, 0x89, 0x2d,
-  0x9d, 0x68, 0x81, 0x95, 0x56, 0x0e, 0xa8, 0xe5, 0x4a, 0xe3, 0x39, 0x51,
-  0x84, 0x97, 0x5f, 0x82, 0xc9, 0x42, 0x11, 0x4e, 0x8c, 0xa9, 0xd2, 0x70,
-  0xc5, 0xb9, 0x57, 0x61, 0x90, 0xf8, 0xa0, 0x79, 0xd4, 0x2b, 0x6c, 0xae,
-  0xc4, 0x41, 0x2d, 0x70, 0x6e, 0x42, 0x48, 0x33, 0xf8, 0xcc, 0x19, 0xa4,
-  0x75, 0xc4, 0x41, 0x26, 0x59, 0x9e, 0x53, 0xee, 0xc9, 0xa7, 0x8a, 0x7e,
-  0x1a, 0xb1, 0xa5, 0x1b, 0x6e, 0x08, 0x4a, 0x68, 0xa1, 0xfe, 0x86, 0x22,
-  0xca, 0x2a, 0x84, 0x28, 0x85, 0x36, 0xda, 0x22, 0xee, 0x39, 0xd9, 0x69,
-  0x33, 0x69, 0x76, 0xf2, 0x4a, 0x2d, 0x6d, 0x9e, 0x74, 0x69, 0x2d, 0xa0,
-  0x74, 0xb2, 0x69, 0xa7, 0x9e, 0xf2, 0x37, 0x4d, 0x5b, 0x6f, 0x8d, 0xda,
-  0x52, 0x14, 0x51, 0x68, 0xa0, 0xc1, 0x3a, 0xd4, 0x56, 0x4b, 0xad, 0xb4,
-  0xd0, 0xb2, 0x64, 0x00, 0xab, 0xae, 0xd6, 0x08, 0x6b, 0xa1, 0x38, 0xca,
-  0xea, 0x06, 0xad, 0x27, 0xfd, 0x15, 0xd8, 0x60, 0xd3, 0xe8, 0xba, 0x2b,
-  0x21, 0x9d, 0x80, 0x52, 0x0b, 0xb0, 0x27, 0x7d, 0xf0, 0xae, 0x29, 0x9d,
-  0x28, 0xc2, 0x29, 0xb2, 0x41, 0x56, 0xc3, 0xd6, 0x5b, 0xa9, 0xc8, 0xf5,
-  0x6c, 0xb4, 0xd3, 0x5a, 0x5b, 0x2d, 0xb6, 0x51, 0x00, 0xca, 0xed, 0xa0,
-  0xde, 0x7e, 0x0b, 0xee, 0xa1, 0x4e, 0xcc, 0xba, 0x12, 0x58, 0xfb, 0x56,
-  0x03, 0x29, 0xb2, 0xcd, 0x28, 0xd2, 0x89, 0x29, 0xef, 0x7e, 0x50, 0x92,
-  0xbc, 0xb5, 0xa0, 0x52, 0xef, 0x33, 0xc8, 0x76, 0xca, 0x9f, 0xbe, 0x6b,
-  0xd5, 0x24, 0x14, 0xb4, 0xd2, 0x0a, 0x3c, 0xb0, 0x06, 0xd9, 0xa6, 0x44,
-  0x00, 0xb7, 0x3d, 0xa0, 0x90, 0xb0, 0xc2, 0xe0, 0xa2, 0xd0, 0x43, 0xc3,
-  0x6e, 0x10, 0xf0, 0x30, 0x4d, 0xa6, 0x49, 0x6c, 0x4f, 0xc8, 0xf8, 0x3c,
-  0x63, 0x31, 0x2a, 0x19, 0x8f, 0xf4, 0x81, 0x2e, 0xb5, 0xd0, 0xab, 0x08,
-  0xc8, 0x40, 0xdb, 0x93, 0x0d, 0x72, 0xfd, 0x2a, 0x85, 0x72, 0xc0, 0x2a,
-  0x13, 0xec, 0x32, 0xcc, 0x32, 0xd3, 0x4c, 0x33, 0x2c, 0x36, 0xe3, 0xac,
-  0xb3, 0x4a, 0x10, 0xaf, 0x95, 0xcd, 0xcf, 0x40, 0x0b, 0x7d, 0x71, 0x2d,
-  0xba, 0x68, 0x0c, 0xd2, 0x07, 0xbf, 0xe8, 0x62, 0x0a, 0x2a, 0x8a, 0x50,
-  0x03, 0x74, 0xa7, 0x4f, 0x9f, 0x36, 0x93, 0xbf, 0x37, 0x4d, 0xad, 0xf2,
-  0xfe, 0xb5, 0x2c, 0x17, 0x7c, 0x12, 0x01, 0x68, 0xa0, 0x21, 0x44, 0xcc,
-  0x33, 0x6b, 0x0d, 0x2b, 0xd7, 0x3d, 0x08, 0x11, 0xf8, 0xd7, 0x29, 0x11,
-  0x95, 0x9f, 0xd8, 0x73, 0xe3, 0x43, 0x8d, 0x22, 0xa8, 0x98, 0xa2, 0xcb,
-  0x2f, 0x6a, 0x77, 0xc4, 0xf6, 0x2f, 0xaa, 0xc0, 0xcd, 0x34, 0xd0, 0xd9,
-  0x4c, 0x72, 0x9a, 0x4c, 0x78, 0xdf, 0x64, 0x85, 0x15, 0x20, 0x80, 0xb0,
-  0xf7, 0x3a, 0xa9, 0x9f, 0xfe, 0x77, 0xe0, 0x83, 0x67, 0x6d, 0xb8, 0xd6,
-  0x88, 0x2b, 0x8e, 0x06, 0xe3, 0xb5, 0x1e, 0xa5, 0xd6, 0x24, 0xd9, 0x44,
-  0x2e, 0x34, 0x2a, 0xaa, 0xfc, 0x82, 0xb9, 0xe6, 0xc2, 0xab, 0x62, 0x4a,
-  0xdc, 0x91, 0x67, 0xf3, 0xc9, 0x24, 0x9f, 0xc4, 0x54, 0xba, 0xe9, 0xa8,
-  0xab, 0xbe, 0x77, 0xeb, 0x56, 0x98, 0x04, 0xb8, 0xe0, 0x31, 0xb3, 0x32,
-  0xfb, 0xec, 0xac, 0xd8, 0x6c, 0x3b, 0xee, 0xe5, 0xc6, 0xb4, 0xfc, 0x27,
-  0xbd, 0xcf, 0x3d, 0xb9, 0x29, 0xc1, 0x0f, 0xaf, 0xd1, 0xe6, 0xaf, 0x1c,
-  0x2f, 0xf7, 0xdc, 0xd9, 0x60, 0x02, 0x58, 0x53, 0xcf, 0x7b, 0x24, 0xc0,
-  0xe9, 0xf8, 0x5b, 0x21, 0x40, 0x42, 0xa7, 0xa7, 0xbe, 0x3a, 0xf5, 0x09,
-  0xb9, 0x5f, 0xfe, 0xf4, 0x47, 0x91, 0xeb, 0x09, 0x61, 0x07, 0x28, 0xd0,
-  0x9e, 0xd6, 0x72, 0x81, 0x02, 0x14, 0xe4, 0xc2, 0x70, 0xdd, 0xdb, 0xc1,
-  0xf7, 0x1e, 0x36, 0x16, 0xb8, 0x60, 0xa2, 0x7c, 0x40, 0x3b, 0xdf, 0x2b,
-  0x84, 0x97, 0x39, 0x8b, 0xb0, 0x4f, 0x15, 0x71, 0xcb, 0x07, 0xfc, 0x36,
-  0x21, 0xbf, 0x4d, 0xa4, 0x66, 0x24, 0x02, 0x1c, 0x20, 0x01, 0x0f, 0xd2,
-  0x3f, 0x10, 0x8c, 0x42, 0x65, 0xa3, 0x00, 0xe0, 0x41, 0x52, 0x38, 0xc0,
-  0xfd, 0x45, 0xc4, 0x80, 0x36, 0x18, 0x81, 0x02, 0x69, 0x96, 0x0b, 0x1d,
-  0xb2, 0x62, 0x04, 0xfe, 0x0f, 0xd4, 0xda, 0x0f, 0x6d, 0x30, 0x41, 0x95,
-  0x30, 0x25, 0x3f, 0x44, 0xc2, 0x20, 0xb2, 0xf2, 0x31, 0xb9, 0x35, 0x71,
-  0xf0, 0x22, 0x1f, 0x0c, 0xa1, 0x08, 0x81, 0xb6, 0x09, 0x12, 0xce, 0xcf,
-  0x29, 0x45, 0x81, 0x4b, 0x64, 0x22, 0x23, 0x8a, 0x48, 0x78, 0xb1, 0x2d,
-  0xc4, 0x11, 0x84, 0x24, 0x12, 0xe0, 0x10, 0x01, 0x80, 0x01, 0x0c, 0x35,
-  0x28, 0x81, 0x1a, 0x4b, 0x50, 0x83, 0x33, 0xda, 0xb0, 0x20, 0x67, 0x54,
-  0x63, 0x05, 0x5e, 0x58, 0xad, 0x51, 0x54, 0x40, 0x8d, 0x67, 0x9c, 0xe1,
-  0x19, 0xd3, 0xb8, 0xc6, 0x36, 0x82, 0xe1, 0x8d, 0x0d, 0xb9, 0x5e, 0x0c,
-  0x72, 0xb8, 0x43, 0x85, 0xf5, 0x50, 0x81, 0x3f, 0x0c, 0x22, 0xcd, 0x86,
-  0x18, 0x83, 0xc5, 0x51, 0x24, 0x01, 0x92, 0x28, 0xce, 0x22, 0x06, 0xf3,
-  0x45, 0x51, 0x6c, 0x31, 0x32, 0x59, 0x14, 0x4b, 0x6b, 0x3e, 0x41, 0xa4,
-  0x4d, 0xcc, 0x2d, 0x1f, 0x4c, 0x54, 0x84, 0x13, 0xd5, 0x37, 0x91, 0xcd,
-  0xc5, 0xe2, 0x15, 0x96, 0xa0, 0x06, 0x28, 0xa7, 0x18, 0xb2, 0x2a, 0xca,
-  0x8f, 0x79, 0x47, 0x79, 0x0a, 0x4d, 0x2e, 0xf9, 0x89, 0x2e, 0x7e, 0x71,
-  0x92, 0xc5, 0x91, 0xc4, 0x18, 0x19, 0x22, 0x80, 0x29, 0x4c, 0x81, 0x8f,
-  0x6b, 0x64, 0xa3, 0x2f, 0x01, 0x29, 0x10, 0x5f, 0xae, 0xb1, 0x02, 0xa5,
-  0x60, 0x07, 0x3b, 0x4a, 0x71, 0x47, 0x35, 0xfa, 0xd2, 0x20, 0xbd, 0xfc,
-  0x65, 0x30, 0xd5, 0x58, 0x83, 0x61, 0x3a, 0x84, 0x00, 0x6c, 0x60, 0x43,
-  0x13, 0x66, 0xa0, 0x43, 0xc3, 0x1d, 0xb2, 0x50, 0x89, 0x84, 0xe0, 0x08,
-  0x66, 0xd0, 0x84, 0x6c, 0x82, 0xaf, 0x21, 0x90, 0x8c, 0x24, 0x69, 0x28,
-  0xe9, 0x45, 0x4b, 0x5e, 0x32, 0x93, 0x32, 0x19, 0x5f, 0x27, 0x3f, 0x09,
-  0x4a, 0x6a, 0x58, 0xe2, 0x15, 0xb1, 0xfe, 0x78, 0xa2, 0x44, 0x4c, 0x89,
-  0x4a, 0x55, 0xae, 0x72, 0x6e, 0xae, 0x5c, 0x9e, 0x69, 0xd8, 0x12, 0xc6,
-  0xe2, 0x00, 0x02, 0x10, 0x7c, 0xe0, 0x83, 0x1c, 0x16, 0xba, 0xd0, 0x39,
-  0x38, 0x54, 0x0e, 0xba, 0x24, 0xa3, 0x42, 0x7c, 0x09, 0xcc, 0x69, 0x56,
-  0x73, 0x0a, 0xc4, 0x34, 0x66, 0x09, 0xd8, 0xe1, 0x8a, 0x0a, 0x2c, 0x60,
-  0x01, 0x15, 0x70, 0x05, 0x3b, 0x9c, 0x39, 0x85, 0x82, 0x44, 0xb3, 0xa2,
-  0xc1, 0xbc, 0x68, 0x20, 0xb9, 0xc0, 0x85, 0x6d, 0x76, 0xf3, 0x5b, 0xb9,
-  0x98, 0x81, 0x4c, 0x67, 0x50, 0x48, 0x1b, 0xb1, 0x62, 0xa6, 0x33, 0x50,
-  0x24, 0x38, 0xc7, 0xd9, 0x04, 0x96, 0x9e, 0x53, 0x21, 0xe9, 0x94, 0x83,
-  0x43, 0xe7, 0xc0, 0xd0, 0x85, 0x26, 0xf4, 0xa0, 0xd8, 0x31, 0xce, 0x40,
-  0x99, 0x37, 0x4f, 0xa0, 0xad, 0x92, 0x89, 0xf7, 0xcc, 0x27, 0x29, 0x1d,
-  0xf2, 0x81, 0x62, 0xfc, 0xe2, 0x94, 0xa9, 0x7c, 0x2a, 0x2b, 0xe9, 0x16,
-  0x50, 0xd1, 0xbd, 0xa6, 0xa0, 0x82, 0x38, 0x68, 0x42, 0x8b, 0x2a, 0xd4,
-  0xa1, 0x42, 0x74, 0x97, 0x09, 0x39, 0x63, 0x0a, 0xd6, 0x2a, 0x52, 0x65,
-  0xba, 0x62, 0xad, 0x34, 0x70, 0x23, 0x41, 0xd4, 0x9a, 0x02, 0xb7, 0xb2,
-  0x55, 0x99, 0x6b, 0xcd, 0xe3, 0x40, 0xcc, 0x08, 0x06, 0x1a, 0xdc, 0xd5,
-  0xae, 0x79, 0x05, 0x03, 0x43, 0x08, 0xc0, 0xd2, 0x26, 0xb4, 0xc0, 0x03,
-  0x35, 0xb5, 0x51, 0x2e, 0x5a, 0xc0, 0x58, 0xc6, 0xd2, 0xac, 0xb1, 0x8c,
-  0xd5, 0xe9, 0x97, 0x58, 0xe1, 0x81, 0x16, 0xf4, 0x94, 0x0b, 0x3f, 0x3d,
-  0x48, 0x50, 0x87, 0x4a, 0xd4, 0xa2, 0x1e, 0x15, 0x10, 0x49, 0x2d, 0x8d,
-  0x69, 0x98, 0x5a, 0x45, 0x25, 0xe2, 0x43, 0xab, 0xf6, 0xc4, 0xe7, 0x2f,
-  0x8a, 0xd1, 0xc1, 0x85, 0x54, 0xb5, 0x18, 0xb4, 0x88, 0xfe, 0x45, 0x56,
-  0xb5, 0x1a, 0x32, 0x6d, 0x1c, 0x4b, 0x64, 0x9f, 0x1a, 0x51, 0x1b, 0x84,
-  0x41, 0x8f, 0xde, 0xce, 0xe3, 0xb7, 0xc0, 0x9d, 0xc7, 0x32, 0x38, 0x1b,
-  0xd1, 0xb4, 0x82, 0x61, 0xad, 0x75, 0x55, 0x26, 0x60, 0xe3, 0x0a, 0x86,
-  0x01, 0x0c, 0x84, 0xae, 0xca, 0x8d, 0x2e, 0x3b, 0x02, 0x3b, 0x90, 0x01,
-  0x9c, 0xd1, 0xaf, 0x29, 0x68, 0xab, 0x72, 0x91, 0xab, 0xd7, 0x84, 0x0c,
-  0x80, 0xa5, 0x38, 0x38, 0x6c, 0x62, 0xe1, 0x31, 0x0b, 0xc8, 0x3a, 0x56,
-  0x61, 0xe6, 0x6d, 0xc1, 0x2c, 0x14, 0x46, 0xd9, 0x16, 0xe0, 0x80, 0xa5,
-  0xce, 0x5d, 0x48, 0x3a, 0x39, 0xbb, 0x8c, 0xe0, 0x02, 0xb7, 0xb7, 0xf4,
-  0x10, 0x46, 0x1b, 0x7e, 0x64, 0x26, 0xfe, 0x50, 0x8c, 0x10, 0xda, 0x08,
-  0x99, 0x56, 0xa1, 0x1a, 0x0b, 0x5a, 0x14, 0x83, 0xb5, 0x0d, 0x79, 0x6d,
-  0x6c, 0x67, 0x4b, 0xdb, 0x4e, 0x69, 0xc3, 0x5e, 0x21, 0xa3, 0x53, 0x9d,
-  0x76, 0x8b, 0x5f, 0x7a, 0xd8, 0x17, 0xb8, 0xc3, 0x9d, 0x43, 0x1a, 0xe6,
-  0x50, 0xdc, 0x83, 0xf8, 0x52, 0x04, 0x20, 0x96, 0x2e, 0x47, 0x41, 0x4c,
-  0x03, 0x5f, 0xc6, 0xf7, 0xc3, 0x22, 0x10, 0xb1, 0x32, 0x41, 0xfc, 0x4c,
-  0x00, 0x0c, 0xc0, 0x97, 0x34, 0x00, 0xb1, 0x76, 0x95, 0x0b, 0x62, 0x11,
-  0xb4, 0x18, 0x21, 0x03, 0xe8, 0x42, 0x17, 0xc2, 0x8b, 0x58, 0x77, 0xf8,
-  0xf8, 0xc7, 0xee, 0x28, 0x6f, 0x7a, 0x81, 0x0c, 0xe4, 0xf4, 0xaa, 0x97,
-  0xc8, 0x3e, 0x6e, 0x2f, 0x0e, 0x74, 0x1c, 0x5f, 0x84, 0xcc, 0x77, 0xc3,
-  0x73, 0xa8, 0xef, 0x85, 0xe7, 0x51, 0x61, 0xfd, 0x3a, 0xea, 0x51, 0xfe,
-  0xa5, 0x98, 0x22, 0x02, 0xdc, 0xa9, 0x01, 0x13, 0xd8, 0xc0, 0x08, 0x56,
-  0x88, 0x82, 0x63, 0xa1, 0x09, 0x7f, 0x0e, 0xd8, 0xc1, 0x4b, 0x6b, 0x5a,
-  0xfe, 0x6e, 0xa7, 0xb1, 0xdb, 0x7a, 0x54, 0x78, 0xca, 0xbf, 0x75, 0x68,
-  0x1a, 0x36, 0xac, 0x4b, 0x84, 0xe8, 0xb8, 0xc6, 0x2a, 0x9e, 0x05, 0x89,
-  0x99, 0x0c, 0x80, 0x3b, 0xa7, 0x58, 0xc5, 0x20, 0xd6, 0xb1, 0x8b, 0x75,
-  0x1c, 0x63, 0x11, 0xcc, 0x02, 0xd0, 0x81, 0xee, 0x82, 0x77, 0x75, 0xcc,
-  0x63, 0x56, 0x20, 0x39, 0xc8, 0x8c, 0xc5, 0xc1, 0x11, 0xc2, 0xcb, 0xd8,
-  0x47, 0xbb, 0xa3, 0xb1, 0x92, 0xa6, 0xf4, 0x2c, 0x1e, 0xad, 0x64, 0x3e,
-  0x23, 0x44, 0x97, 0x1a, 0x86, 0x32, 0x9c, 0xa9, 0x8c, 0xdf, 0x7a, 0x58,
-  0xf9, 0x3d, 0x13, 0x43, 0x96, 0xd0, 0xb8, 0xec, 0x65, 0x26, 0x6a, 0xa2,
-  0xc0, 0x07, 0x6e, 0x2d, 0x41, 0xc6, 0x5c, 0xe6, 0x56, 0x4f, 0x31, 0xcd,
-  0x6a, 0x16, 0x51, 0x3d, 0x16, 0xb1, 0x85, 0xea, 0xbc, 0x19, 0xce, 0x72,
-  0x9e, 0x73, 0x9d, 0x0f, 0x42, 0x68, 0x10, 0x27, 0x53, 0xc4, 0x7a, 0x16,
-  0x01, 0x0d, 0x98, 0xdc, 0x85, 0x27, 0x84, 0x18, 0xd1, 0x4f, 0xe8, 0x42,
-  0x8e, 0xbb, 0x50, 0xe8, 0x43, 0x8b, 0xb8, 0x14, 0x7b, 0x56, 0xf4, 0x41,
-  0xa6, 0x8d, 0x03, 0x13, 0x78, 0xa0, 0x14, 0x8f, 0x9e, 0x85, 0x09, 0x4c,
-  0xb0, 0x64, 0x46, 0x8f, 0xdb, 0xd2, 0xe3, 0x2e, 0xf7, 0x8e, 0xc7, 0xbd,
-  0x69, 0x24, 0x97, 0xc2, 0x03, 0xe4, 0xf6, 0xb4, 0x41, 0x74, 0x39, 0x67,
-  0x51, 0xc3, 0xb9, 0xc2, 0xd5, 0xd9, 0xc2, 0x22, 0x50, 0x9d, 0xe5, 0x90,
-  0x09, 0xad, 0xcb, 0xad, 0xa6, 0xc6, 0xab, 0xc1, 0x2c, 0x6b, 0x81, 0xd0,
-  0xda, 0xcc, 0x67, 0xc6, 0x07, 0xae, 0x23, 0x9c, 0x5b, 0x5e, 0xfb, 0x1a,
-  0xbf, 0xa3, 0x0e, 0x76, 0x1a, 0x86, 0x6d, 0x10, 0x6e, 0x7b, 0x1b, 0xdc,
-  0x48, 0x16, 0x77, 0xbc, 0xcd, 0x6d, 0x02, 0x74, 0x6f, 0x7c, 0xdd, 0x26,
-  0x68, 0x37, 0x91, 0xfe, 0xdf, 0xbd, 0xf1, 0x26, 0x17, 0xa4, 0xd8, 0x22,
-  0x38, 0xb6, 0x74, 0x93, 0xbd, 0x6c, 0x69, 0x37, 0xfb, 0xd9, 0x22, 0x06,
-  0x71, 0xb4, 0xa7, 0x5d, 0x6d, 0x15, 0x63, 0x5b, 0xd9, 0x82, 0x3e, 0x08,
-  0xbd, 0xe7, 0xec, 0xd0, 0x51, 0xe3, 0xbb, 0x1e, 0xfa, 0xe6, 0x37, 0xd9,
-  0xfc, 0xad, 0x08, 0x80, 0x7b, 0x59, 0xe0, 0xb0, 0x0e, 0xf3, 0x41, 0x0e,
-  0xde, 0x6a, 0x34, 0x7f, 0x0e, 0xb7, 0xba, 0x66, 0xb3, 0x30, 0xdc, 0x0c,
-  0x71, 0x60, 0x87, 0x9a, 0xc3, 0x92, 0x58, 0xf4, 0x8e, 0xc5, 0x1b, 0xee,
-  0x48, 0x4f, 0xba, 0xb1, 0x96, 0xc6, 0xf4, 0xd7, 0x8f, 0x8c, 0xe4, 0x4e,
-  0x4b, 0x3b, 0x21, 0x7e, 0xfe, 0xf3, 0xca, 0xb3, 0xed, 0x5c, 0x3f, 0xab,
-  0x98, 0x1d, 0x89, 0x1e, 0x34, 0xb5, 0x41, 0x6c, 0x6d, 0xe9, 0xd6, 0x38,
-  0xe7, 0xf3, 0x96, 0xc4, 0xd5, 0xe7, 0xe0, 0xf3, 0x52, 0x9f, 0x1a, 0xcb,
-  0x43, 0xef, 0xd4, 0xaa, 0x8d, 0x8e, 0xda, 0x81, 0xc7, 0xda, 0xb5, 0x07,
-  0x5e, 0x30, 0xc2, 0xff, 0x89, 0xe6, 0x7b, 0x41, 0xfd, 0x49, 0x52, 0xff,
-  0xf5, 0x85, 0x33, 0x4c, 0x67, 0xb4, 0xe2, 0x98, 0xd1, 0x5c, 0xcf, 0xb8,
-  0x91, 0xc3, 0x9e, 0x5e, 0x91, 0x03, 0xd9, 0xec, 0x26, 0x37, 0x08, 0x8a,
-  0xd5, 0xae, 0x5c, 0x57, 0x90, 0xd8, 0xc4, 0xc5, 0x9c, 0x02, 0xcc, 0xed,
-  0x6e, 0xe3, 0x92, 0xba, 0x18, 0xc6, 0x32, 0x8e, 0x39, 0x8b, 0x5d, 0x6f,
-  0x90, 0x27, 0x3b, 0x54, 0xca, 0x17, 0xae, 0x72, 0x1b, 0xae, 0xac, 0xae,
-  0x5d, 0x6d, 0x79, 0x89, 0x03, 0xb6, 0x67, 0xd2, 0x0b, 0x6e, 0x90, 0x31,
-  0x33, 0x98, 0xf1, 0x0e, 0xbe, 0x6d, 0xb2, 0x9e, 0x04, 0x25, 0x0a, 0xfb,
-  0x76, 0xf2, 0xc4, 0xb5, 0xbc, 0x77, 0xc1, 0x2b, 0x5e, 0x85, 0x09, 0x19,
-  0xb2, 0x8f, 0x35, 0xef, 0x7a, 0xbf, 0xfe, 0xa5, 0x64, 0xf8, 0x2e, 0x84,
-  0xae, 0xc9, 0x2d, 0x3d, 0x5c, 0xcf, 0xd8, 0x64, 0xe8, 0xaa, 0x98, 0xba,
-  0x02, 0xb1, 0x6e, 0x5f, 0xff, 0xba, 0x5d, 0xf4, 0x6b, 0x16, 0xd4, 0x43,
-  0xc5, 0x7d, 0x70, 0xf1, 0xab, 0x5f, 0xfe, 0x0a, 0xfd, 0xbf, 0x5c, 0x26,
-  0x7c, 0x3d, 0x2d, 0x31, 0xfc, 0x87, 0x54, 0xf5, 0xaa, 0xfd, 0xd4, 0x60,
-  0xc8, 0x92, 0x0d, 0x5d, 0x35, 0x50, 0xb0, 0x61, 0x50, 0x08, 0xa5, 0x50,
-  0x45, 0xc5, 0x59, 0x67, 0x25, 0x51, 0x83, 0x55, 0x58, 0xd5, 0x07, 0x53,
-  0xe6, 0x95, 0x7d, 0x8d, 0x25, 0x59, 0x36, 0x55, 0x59, 0x97, 0x95, 0x59,
-  0x73, 0x75, 0x5c, 0xec, 0xf7, 0x56, 0x29, 0xc0, 0x5c, 0x80, 0x64, 0x7e,
-  0x1e, 0xd8, 0x56, 0xee, 0x07, 0x00, 0x7c, 0x85, 0x5d, 0xda, 0xe5, 0x81,
-  0x29, 0xd0, 0x5d, 0xef, 0x27, 0x09, 0x65, 0xf5, 0x50, 0x9e, 0xc5, 0x07,
-  0x48, 0x85, 0x1d, 0xa2, 0xb5, 0x16, 0xa4, 0xb5, 0x09, 0xa6, 0x85, 0x5a,
-  0x51, 0xb5, 0x5a, 0xc4, 0x97, 0x10, 0xfc, 0x74, 0x7c, 0x00, 0x65, 0x45,
-  0x5e, 0xd5, 0x18, 0x60, 0x25, 0x56, 0x0a, 0xc8, 0x50, 0x66, 0xd5, 0x61,
-  0xd7, 0x54, 0x58, 0xdc, 0x34, 0x5e, 0x31, 0x35, 0x53, 0x89, 0x75, 0x53,
-  0x33, 0x65, 0x81, 0xf0, 0xf0, 0x43, 0xe4, 0xe4, 0x53, 0x0d, 0x41, 0x51,
-  0xd3, 0xd4, 0x47, 0xd6, 0x44, 0x10, 0x1a, 0xc5, 0x51, 0x1e, 0x05, 0x52,
-  0x22, 0x45, 0x52, 0x26, 0xa5, 0x85, 0x5b, 0x28, 0x4c, 0xb4, 0xe7, 0x64,
-  0xba, 0xf4, 0x82, 0x64, 0xf5, 0x59, 0xa1, 0x75, 0x1c, 0x36, 0xc8, 0x49,
-  0x55, 0x44, 0x4f, 0xfb, 0xa7, 0x5a, 0x53, 0xe5, 0x7f, 0xc2, 0x83, 0x55,
-  0x66, 0x16, 0x84, 0xaf, 0x84, 0x21, 0x32, 0x91, 0x45, 0xb4, 0x64, 0x4b,
-  0x5e, 0x84, 0x4b, 0x62, 0x24, 0x7d, 0xd7, 0x94, 0x4d, 0xfe, 0x2e, 0x35,
-  0x5e, 0x5f, 0xf2, 0x4d, 0x93, 0x05, 0x44, 0xe2, 0x44, 0x4e, 0xe6, 0x54,
-  0x46, 0x66, 0x98, 0x52, 0x5d, 0xe8, 0x85, 0x53, 0x70, 0x4c, 0xc7, 0xc6,
-  0x4c, 0x6b, 0x74, 0x63, 0x7b, 0x35, 0x89, 0x5c, 0x88, 0x51, 0x0c, 0x91,
-  0x4e, 0x92, 0xc4, 0x4e, 0x91, 0xe0, 0x4e, 0x5b, 0x04, 0x4f, 0xf9, 0x71,
-  0x83, 0x74, 0x98, 0x5a, 0x52, 0xd5, 0x83, 0x0c, 0x11, 0x45, 0xfe, 0xc4,
-  0x87, 0x57, 0xf4, 0x87, 0x45, 0x11, 0x88, 0x5f, 0x04, 0x46, 0xb9, 0xe4,
-  0x80, 0x37, 0x14, 0x38, 0x83, 0xf4, 0x52, 0x3c, 0xf4, 0x52, 0xe1, 0x24,
-  0x44, 0x23, 0x60, 0x03, 0x8d, 0x74, 0x3b, 0x10, 0xc1, 0x57, 0x15, 0xe5,
-  0x47, 0xc4, 0x24, 0x10, 0x71, 0x54, 0x02, 0x73, 0x64, 0x2d, 0x76, 0x84,
-  0x47, 0x82, 0x05, 0x4d, 0x7b, 0x94, 0x52, 0x72, 0x85, 0x4e, 0xea, 0x34,
-  0x49, 0xb7, 0x68, 0x8a, 0x98, 0x14, 0x16, 0x31, 0xb1, 0x49, 0x4d, 0x25,
-  0x60, 0xa1, 0x34, 0x4a, 0xae, 0x98, 0x60, 0xc2, 0xa3, 0x24, 0x21, 0x34,
-  0x42, 0x25, 0x74, 0x42, 0x28, 0x81, 0x43, 0xbe, 0x68, 0x48, 0x3e, 0xe4,
-  0x88, 0xc2, 0x48, 0x44, 0x8e, 0x14, 0x11, 0x34, 0x94, 0x3f, 0xcb, 0x28,
-  0x10, 0x2d, 0x44, 0x47, 0xd0, 0x28, 0x43, 0xd0, 0xa4, 0x42, 0xa7, 0x93,
-  0x8f, 0x1e, 0x71, 0x44, 0x72, 0x68, 0x5a, 0xa7, 0xd5, 0x44, 0x1b, 0x74,
-  0x87, 0x14, 0xc1, 0x3e, 0xee, 0x93, 0x3c, 0xf2, 0x93, 0x1c, 0x9d, 0x50,
-  0x3f, 0x23, 0x61, 0x40, 0x08, 0xa4, 0x88, 0x8a, 0xd5, 0x40, 0x54, 0x38,
-  0x59, 0x28, 0x20, 0x41, 0xf5, 0x28, 0x11, 0xf7, 0xb8, 0x42, 0x2c, 0x14,
-  0x3d, 0xff, 0x03, 0x02, 0xae, 0x83, 0x10, 0x1f, 0x29, 0x90, 0x1d, 0xd1,
-  0x00, 0x15, 0xc4, 0x49, 0x06, 0x29, 0x39, 0x8a, 0x60, 0x0a, 0x09, 0x59,
-  0xfe, 0x8e, 0x10, 0xb1, 0x39, 0xc6, 0x83, 0x3c, 0xf0, 0x33, 0x3e, 0xce,
-  0xb3, 0x12, 0x06, 0x94, 0x3d, 0xdb, 0x03, 0x41, 0xde, 0xd3, 0x91, 0x23,
-  0xd1, 0x42, 0x23, 0x59, 0x92, 0x52, 0xa1, 0x92, 0x9d, 0x30, 0x3e, 0x2d,
-  0x79, 0x3e, 0xe9, 0x23, 0x93, 0x11, 0x41, 0x93, 0x9e, 0x93, 0x3c, 0xa2,
-  0xd3, 0x3c, 0x9b, 0x20, 0x91, 0x22, 0xb1, 0x93, 0xb2, 0xd3, 0x93, 0x87,
-  0xf3, 0x93, 0xc6, 0x68, 0x12, 0x42, 0x39, 0x3d, 0x24, 0x59, 0x3d, 0x45,
-  0xa9, 0x3b, 0x8f, 0xc0, 0x3b, 0xbe, 0x43, 0x39, 0x4b, 0xf9, 0x11, 0x6c,
-  0xe3, 0x36, 0x70, 0xf3, 0x3e, 0xa0, 0x53, 0x18, 0x77, 0xa3, 0x93, 0xb0,
-  0x43, 0x38, 0x58, 0x59, 0x33, 0x89, 0x03, 0x94, 0x24, 0xa1, 0x37, 0x7b,
-  0x63, 0x35, 0x4a, 0xe1, 0x38, 0x8c, 0x91, 0x94, 0x94, 0x63, 0x39, 0x0a,
-  0xb9, 0x11, 0x47, 0x93, 0x34, 0x1f, 0x33, 0x37, 0x4e, 0x03, 0x35, 0x54,
-  0x19, 0x12, 0x2f, 0xd3, 0x2a, 0x72, 0x39, 0x97, 0x88, 0xe3, 0x35, 0x29,
-  0x81, 0x97, 0x55, 0xd3, 0x37, 0x7b, 0xc9, 0x33, 0x62, 0x13, 0x78, 0x82,
-  0x67, 0x31, 0x18, 0x93, 0x36, 0x46, 0xf3, 0x2e, 0x1e, 0xb3, 0x70, 0xb8,
-  0x45, 0x32, 0xfc, 0x92, 0x98, 0x20, 0xb1, 0x98, 0x4e, 0xd0, 0x98, 0xdb,
-  0xf3, 0x98, 0xac, 0xa2, 0x81, 0x21, 0x21, 0x99, 0x02, 0xa3, 0x97, 0x37,
-  0x11, 0x36, 0x8f, 0xe0, 0x33, 0x65, 0x33, 0x34, 0x45, 0x43, 0x12, 0x1c,
-  0xa3, 0x34, 0x8e, 0x97, 0x2c, 0xfa, 0x42, 0x18, 0x26, 0xa3, 0x12, 0xdb,
-  0xd2, 0x2a, 0x08, 0x93, 0x9a, 0x0c, 0xe3, 0x30, 0x2a, 0xe1, 0x9a, 0xd6,
-  0x02, 0x9b, 0x2d, 0x01, 0x31, 0x84, 0xe1, 0x33, 0x81, 0x57, 0x31, 0x67,
-  0x53, 0x0b, 0x4c, 0xa9, 0x11, 0xc3, 0x52, 0x2c, 0xca, 0xe7, 0x24, 0xcb,
-  0xe2, 0x16, 0x70, 0xfe, 0x41, 0x9a, 0x1f, 0x11, 0x9c, 0xdd, 0x62, 0x38,
-  0xe1, 0x82, 0x33, 0xe4, 0x72, 0x12, 0xc8, 0xb9, 0x32, 0x2d, 0xb3, 0x9c,
-  0x80, 0x21, 0x18, 0x91, 0x90, 0x2e, 0xa9, 0xc6, 0x2b, 0xed, 0xf2, 0x2e,
-  0xc1, 0x62, 0x12, 0x97, 0x92, 0x29, 0xb7, 0x45, 0x27, 0xd3, 0x10, 0x2a,
-  0x91, 0xc1, 0x9d, 0x1e, 0xe1, 0x9d, 0xc3, 0xa9, 0x30, 0xe1, 0x69, 0x9c,
-  0x2b, 0xa1, 0x27, 0xa7, 0x82, 0x2a, 0x59, 0xa2, 0x2a, 0xe8, 0x29, 0x1a,
-  0xa4, 0x91, 0x2b, 0x13, 0xc3, 0x2b, 0x93, 0x02, 0x2f, 0x2a, 0xf1, 0x26,
-  0x71, 0xb2, 0x7c, 0x75, 0x22, 0x49, 0x00, 0x92, 0x12, 0x81, 0xd2, 0x9f,
-  0x0b, 0x83, 0x28, 0x8a, 0x12, 0xa0, 0xa5, 0x32, 0xa0, 0xea, 0x90, 0x2a,
-  0x3d, 0xf2, 0x09, 0x61, 0xe4, 0x28, 0xba, 0x22, 0x29, 0xbe, 0x52, 0x29,
-  0x6e, 0xa2, 0x24, 0x71, 0x22, 0x61, 0x50, 0x52, 0x1c, 0x15, 0x6a, 0xa1,
-  0x31, 0x32, 0x23, 0x33, 0x13, 0x26, 0x3b, 0x02, 0x1c, 0x37, 0xa1, 0x27,
-  0x55, 0x62, 0x25, 0x58, 0xf2, 0x27, 0x8b, 0xf2, 0x09, 0xd8, 0xd1, 0x5f,
-  0x42, 0xa2, 0x26, 0x28, 0xda, 0x12, 0x1c, 0xe2, 0x21, 0x4d, 0xa2, 0x6b,
-  0x2d, 0x9a, 0x1d, 0x78, 0xa2, 0x2d, 0x31, 0x4a, 0x28, 0x34, 0xba, 0xa1,
-  0x01, 0x52, 0x2a, 0x16, 0x90, 0xa3, 0x2c, 0xe2, 0x22, 0x06, 0x4a, 0x26,
-  0x3e, 0x3a, 0x21, 0xfc, 0x86, 0x26, 0x44, 0x82, 0x0b, 0x46, 0x22, 0x14,
-  0xce, 0x91, 0x1f, 0xfb, 0xf1, 0x24, 0x51, 0xe2, 0x12, 0x0a, 0xb2, 0x04,
-  0x2e, 0xc0, 0x20, 0x0e, 0x02, 0xa5, 0x51, 0x4a, 0x01, 0x05, 0xf2, 0xa6,
-  0x16, 0x70, 0x20, 0x57, 0xba, 0x12, 0x65, 0x82, 0x6a, 0x17, 0x92, 0x21,
-  0xcc, 0xe1, 0x13, 0x61, 0x1a, 0x1d, 0xd3, 0x31, 0xa1, 0x2e, 0xba, 0xa4,
-  0x5b, 0xb2, 0x1b, 0x68, 0xba, 0xa6, 0xae, 0x36, 0x2a, 0x14, 0xdc, 0xe1,
-  0x1d, 0xdf, 0x11, 0x1e, 0x3d, 0xda, 0x1e, 0xef, 0x11, 0x1f, 0xf3, 0x51,
-  0x1f, 0x79, 0x0a, 0xa6, 0xac, 0xe1, 0x1a, 0x44, 0x48, 0xa1, 0x80, 0x1a,
-  0xa8, 0xe4, 0xd1, 0x1b, 0x0f, 0x82, 0x15, 0x87, 0x8a, 0xa8, 0xb8, 0x11,
-  0xa2, 0x61, 0x54, 0x83, 0x6f, 0xa1, 0x1c, 0x91, 0xaa, 0x14, 0x8b, 0xf1,
-  0x55, 0x8f, 0x91, 0x9f, 0x4a, 0xb1, 0x19, 0xbf, 0xf1, 0x19, 0x52, 0xd1,
-  0xa9, 0x89, 0x0a, 0x1a, 0x91, 0x71, 0x2b, 0x70, 0x88, 0x1a, 0xa5, 0xda,
-  0x1c, 0x87, 0xc1, 0x18, 0xcc, 0xb2, 0x9d, 0x9a, 0xc1, 0x17, 0x7d, 0x91,
-  0x17, 0x74, 0x61, 0x17, 0x78, 0x21, 0x14, 0xe6, 0xa2, 0x9e, 0x85, 0x71,
-  0x18, 0xb7, 0x8a, 0x15, 0x4c, 0x81, 0x45, 0x50, 0x61, 0x16, 0x7b, 0xe1,
-  0xaa, 0x66, 0x41, 0x15, 0x55, 0xa1, 0xa8, 0xb1, 0x09, 0x4f, 0x63, 0x91,
-  0xac, 0x5e, 0x01, 0x13, 0xb4, 0x18, 0x35, 0x79, 0x01, 0x14, 0x89, 0x41,
-  0x10, 0xd2, 0xca, 0x13, 0x66, 0x01, 0x16, 0x46, 0x81, 0x14, 0xdf, 0x7a,
-  0xae, 0xe8, 0x9a, 0xae, 0xea, 0xba, 0xae, 0xec, 0xda, 0xae, 0xee, 0xfa,
-  0xae, 0xf0, 0x1a, 0xaf, 0xf2, 0x3a, 0xaf, 0xf4, 0x5a, 0xaf, 0x17, 0x11,
-  0x10, 0x00, 0x3b
-};
-unsigned int ldur_gif_len = 24099;
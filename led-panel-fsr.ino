@@ -1,10 +1,7 @@
 #include <ADC.h>
 #include <inttypes.h>
 
-#if !defined(__AVR_ATmega32U4__) && !defined(__AVR_ATmega328P__) && \
-    !defined(__AVR_ATmega1280__) && !defined(__AVR_ATmega2560__)
-  #define CAN_AVERAGE
-#endif
+#include "SensorConfig.h"
 
 #if defined(_SFR_BYTE) && defined(_BV) && defined(ADCSRA)
   #define CLEAR_BIT(sfr, bit) (_SFR_BYTE(sfr) &= ~_BV(bit))
@@ -13,53 +10,302 @@
 
 
 
-// Default threshold value for each of the sensors.
-const int16_t kDefaultThreshold = 1000;
-// Max window size for both of the moving averages classes.
-const size_t kWindowSize = 50;
 // Baud rate used for Serial communication. Technically ignored by Teensys.
 const long kBaudRate = 115200;
-// Max number of sensors per panel.
-// NOTE(teejusb): This is arbitrary, if you need to support more sensors
-// per panel then just change the following number.
-const size_t kMaxSharedSensors = 2;
+// Uncomment to replace the ADCs' hardware averaging and the moving average
+// with CIC decimation of samples taken by a fixed-rate interrupt. See
+// CicDecimator.h.
+// #define ENABLE_CIC_DECIMATION
+// In that mode every sensor is converted kCicSampleRate times per second and
+// decimated by kCicRatio, so thresholds are evaluated at 1kHz.
+const uint32_t kCicSampleRate = 16000;
+const uint8_t kCicOrder = 3;
+const uint16_t kCicRatio = 16;
+// Pads driven by this Teensy: 1, or 2 for P1 and P2 on one controller. Each
+// pad has kPanelsPerPad panels (see SensorConfig.h) with a state, a block of
+// joystick buttons and LED panels of its own, see PadTopology.h and
+// LedPanel.h.
+#define NUM_PADS 1
+const size_t kNumPads = NUM_PADS;
 
 // Defines the sensor collections and sets the pins for them appropriately.
 //
-// If you want to use multiple sensors in one panel, you will want to share
-// state across them. In the following example, the first and second sensors
-// share state. The maximum number of sensors that can be shared for one panel
-// is controlled by the kMaxSharedSensors constant at the top of this file, but
-// can be modified as needed.
+// kWiring lists every FSR with the pin it's on and the index of the state in
+// kStates it feeds. If you want to use multiple sensors in one panel, give
+// them the same state; they must be listed next to each other. The maximum
+// number of sensors that can be shared for one panel is controlled by the
+// kMaxSharedSensors constant in SensorConfig.h, but can be modified as
+// needed. In the following example, the first and second sensors share state.
 //
-// SensorState state1;
+// constexpr SensorWiring kWiring[] = {
+//   { A0, 0 }, { A1, 0 }, { A2, 1 }, { A3, 2 },
+// };
+// SensorState kStates[] = {
+//   SensorState(1, SensorsInState(kWiring, 0)),
+//   SensorState(2, SensorsInState(kWiring, 1)),
+//   SensorState(3, SensorsInState(kWiring, 2)),
+// };
 // Sensor kSensors[] = {
-//   Sensor(A0, &state1),
-//   Sensor(A1, &state1),
-//   Sensor(A2),
-//   Sensor(A3),
-//   Sensor(A4),
+//   Sensor(adc, TopologyOf(kWiring, 0), &kStates[0]),
+//   ...
 // };
+//
+// States are numbered pad by pad: pad p's panels are kStates[p *
+// kPanelsPerPad] onwards, in the same order in every pad.
 
+#include "MemoryPlacement.h"
+#include "AdcTuner.h"
+#include "LatencyTest.h"
 #include "button.h"
 #include "MovingAverage.h"
 #include "SensorState.h"
+#include "PadTopology.h"
 #include "Sensor.h"
 
-ADC *adc = new ADC();
-
-SensorState kStates[] = { SensorState(14), SensorState(13), SensorState(12), SensorState(11) };
-Sensor kSensors[] = {
-  Sensor(adc, A0, &kStates[0]),
-  Sensor(adc, A1, &kStates[0]),
-  Sensor(adc, A2, &kStates[1]),
-  Sensor(adc, A3, &kStates[1]),
-  Sensor(adc, A4, &kStates[2]),
-  Sensor(adc, A5, &kStates[2]),
-  Sensor(adc, A6, &kStates[3]),
-  Sensor(adc, A7, &kStates[3])
+// Not allocated with new, which would put it on the heap in OCRAM.
+ADC adcDevice HOT_DATA;
+ADC *adc = &adcDevice;
+
+constexpr SensorWiring kWiring[] = {
+  { A0, 0 }, { A1, 0 },
+  { A2, 1 }, { A3, 1 },
+  { A4, 2 }, { A5, 2 },
+  { A6, 3 }, { A7, 3 },
+#if NUM_PADS >= 2
+  { A8, 4 }, { A9, 4 },
+  { A10, 5 }, { A11, 5 },
+  { A12, 6 }, { A13, 6 },
+  { A14, 7 }, { A15, 7 },
+#endif
+};
+static_assert(StatesAreContiguous(kWiring),
+              "Sensors sharing a state must be listed next to each other");
+static_assert(SlotsFit(kWiring), "Increase kMaxSharedSensors");
+
+SensorState kStates[] HOT_DATA = {
+  SensorState(ButtonForState(0), SensorsInState(kWiring, 0)),
+  SensorState(ButtonForState(1), SensorsInState(kWiring, 1)),
+  SensorState(ButtonForState(2), SensorsInState(kWiring, 2)),
+  SensorState(ButtonForState(3), SensorsInState(kWiring, 3)),
+#if NUM_PADS >= 2
+  SensorState(ButtonForState(4), SensorsInState(kWiring, 4)),
+  SensorState(ButtonForState(5), SensorsInState(kWiring, 5)),
+  SensorState(ButtonForState(6), SensorsInState(kWiring, 6)),
+  SensorState(ButtonForState(7), SensorsInState(kWiring, 7)),
+#endif
+};
+static_assert(sizeof(kStates) / sizeof(SensorState) == kNumPads * kPanelsPerPad,
+              "Every panel of every pad needs a state");
+static_assert(ButtonForState(kNumPads * kPanelsPerPad - 1) <= kMaxButton,
+              "Not enough joystick buttons for this many pads");
+Sensor kSensors[] HOT_DATA = {
+  Sensor(adc, TopologyOf(kWiring, 0), &kStates[kWiring[0].state]),
+  Sensor(adc, TopologyOf(kWiring, 1), &kStates[kWiring[1].state]),
+  Sensor(adc, TopologyOf(kWiring, 2), &kStates[kWiring[2].state]),
+  Sensor(adc, TopologyOf(kWiring, 3), &kStates[kWiring[3].state]),
+  Sensor(adc, TopologyOf(kWiring, 4), &kStates[kWiring[4].state]),
+  Sensor(adc, TopologyOf(kWiring, 5), &kStates[kWiring[5].state]),
+  Sensor(adc, TopologyOf(kWiring, 6), &kStates[kWiring[6].state]),
+  Sensor(adc, TopologyOf(kWiring, 7), &kStates[kWiring[7].state]),
+#if NUM_PADS >= 2
+  Sensor(adc, TopologyOf(kWiring, 8), &kStates[kWiring[8].state]),
+  Sensor(adc, TopologyOf(kWiring, 9), &kStates[kWiring[9].state]),
+  Sensor(adc, TopologyOf(kWiring, 10), &kStates[kWiring[10].state]),
+  Sensor(adc, TopologyOf(kWiring, 11), &kStates[kWiring[11].state]),
+  Sensor(adc, TopologyOf(kWiring, 12), &kStates[kWiring[12].state]),
+  Sensor(adc, TopologyOf(kWiring, 13), &kStates[kWiring[13].state]),
+  Sensor(adc, TopologyOf(kWiring, 14), &kStates[kWiring[14].state]),
+  Sensor(adc, TopologyOf(kWiring, 15), &kStates[kWiring[15].state]),
+#endif
 };
 const size_t kNumSensors = sizeof(kSensors)/sizeof(Sensor);
+static_assert(kNumSensors == sizeof(kWiring)/sizeof(SensorWiring),
+              "Every entry in kWiring needs a Sensor");
+
+// Whether the first pin of each pair can be converted by adc0 and the second
+// by adc1. Checked once in setup(), pairs that can't are read one at a time.
+bool pairSynchronized[kNumSensors] HOT_DATA;
+
+// Samples every sensor once. Sensors paired in kWiring are converted
+// simultaneously on both ADCs.
+void SampleSensors(bool willSend) {
+  Unrolled<0, kNumSensors>::Run([willSend](auto i) {
+    constexpr size_t kIndex = decltype(i)::value;
+    constexpr SensorTopology kTopology = TopologyOf(kWiring, kIndex);
+    if (kTopology.pairing == kUnpaired) {
+      kSensors[kIndex].EvaluateSensor(willSend);
+    } else if (kTopology.pairing == kPairFirst) {
+      // kPairFirst always has a following sensor, the check only keeps the
+      // index in range for the instantiations where this branch is dead.
+      constexpr size_t kNext = kIndex + 1 < kNumSensors ? kIndex + 1 : kIndex;
+      if (pairSynchronized[kIndex]) {
+        ADC::Sync_result result = adc->analogSynchronizedRead(
+            kWiring[kIndex].pin, kWiring[kNext].pin);
+        kSensors[kIndex].EvaluateSample(
+            adcTuner.Normalize(latencyTest.Sample(kWiring[kIndex].pin,
+                                                  result.result_adc0)),
+            willSend);
+        kSensors[kNext].EvaluateSample(
+            adcTuner.Normalize(latencyTest.Sample(kWiring[kNext].pin,
+                                                  result.result_adc1)),
+            willSend);
+      } else {
+        kSensors[kIndex].EvaluateSensor(willSend);
+        kSensors[kNext].EvaluateSensor(willSend);
+      }
+    }
+    // kPairSecond was handled together with the sensor before it.
+  });
+}
+
+#if defined(ENABLE_CIC_DECIMATION)
+#include "CicDecimator.h"
+typedef CicDecimator<kCicOrder, kCicRatio> SensorDecimator;
+// No hardware averaging and the fastest conversions, at full resolution.
+const AdcConfig kCicAdcConfig = { 1, 12, 4, 4 };
+
+SensorDecimator decimators[kNumSensors] HOT_DATA;
+// Latest decimated value of every sensor, published by CicSampleIsr().
+volatile int32_t decimatedValues[kNumSensors] HOT_DATA;
+volatile uint32_t decimatedBatch HOT_DATA = 0;
+IntervalTimer cicTimer;
+
+// Converts every sensor once and feeds the decimators. Runs at
+// kCicSampleRate, so the decimators' delay of SensorDecimator::kDelaySamples
+// samples is an exact, fixed time.
+void CicSampleIsr() {
+  bool ready = false;
+  Unrolled<0, kNumSensors>::Run([&ready](auto i) {
+    constexpr size_t kIndex = decltype(i)::value;
+    constexpr SensorTopology kTopology = TopologyOf(kWiring, kIndex);
+    if (kTopology.pairing == kUnpaired) {
+      ready = decimators[kIndex].Push(latencyTest.Sample(
+          kWiring[kIndex].pin, adc->analogRead(kWiring[kIndex].pin)));
+    } else if (kTopology.pairing == kPairFirst) {
+      constexpr size_t kNext = kIndex + 1 < kNumSensors ? kIndex + 1 : kIndex;
+      int32_t first, second;
+      if (pairSynchronized[kIndex]) {
+        ADC::Sync_result result = adc->analogSynchronizedRead(
+            kWiring[kIndex].pin, kWiring[kNext].pin);
+        first = result.result_adc0;
+        second = result.result_adc1;
+      } else {
+        first = adc->analogRead(kWiring[kIndex].pin);
+        second = adc->analogRead(kWiring[kNext].pin);
+      }
+      decimators[kIndex].Push(latencyTest.Sample(kWiring[kIndex].pin, first));
+      ready = decimators[kNext].Push(
+          latencyTest.Sample(kWiring[kNext].pin, second));
+    }
+  });
+  // All decimators are fed in lockstep, so they complete together.
+  if (ready) {
+    for (size_t i = 0; i < kNumSensors; ++i) {
+      decimatedValues[i] = decimators[i].Output();
+    }
+    decimatedBatch++;
+  }
+}
+
+void StartSampling() {
+  adcTuner.Apply(adc, kCicAdcConfig);
+  cicTimer.begin(CicSampleIsr, 1000000.0f / kCicSampleRate);
+}
+
+void StopSampling() {
+  cicTimer.end();
+}
+
+// Thresholds the latest decimated values, if there are new ones.
+void EvaluateDecimated() {
+  static uint32_t lastBatch = 0;
+  int32_t values[kNumSensors];
+  noInterrupts();
+  bool fresh = decimatedBatch != lastBatch;
+  lastBatch = decimatedBatch;
+  for (size_t i = 0; i < kNumSensors; ++i) {
+    values[i] = decimatedValues[i];
+  }
+  interrupts();
+  if (!fresh) return;
+
+  for (size_t i = 0; i < kNumSensors; ++i) {
+    kSensors[i].EvaluateFiltered(
+        adcTuner.Normalize(values[i], SensorDecimator::kGainBits));
+  }
+}
+#else
+// Sensors are sampled from loop() in this mode.
+void StartSampling() {}
+void StopSampling() {}
+#endif
+
+// "y <sensor> <runs>", see LatencyTest.h.
+void StartLatencyTest(size_t sensor, uint16_t runs) {
+  latencyTest.Start(kWiring[sensor].pin, ButtonForState(kWiring[sensor].state),
+                    runs);
+}
+
+// "c <noise budget>", see AdcTuner.h. Every sensor is measured on the ADC
+// SampleSensors() converts it on: adc1 for the second sensor of a
+// synchronized pair, otherwise the one analogRead() picks, which is adc0
+// unless only adc1 can read the pin.
+void SweepAdc(float noise_budget) {
+  uint8_t pins[kNumSensors];
+  ADC_Module* modules[kNumSensors];
+  for (size_t i = 0; i < kNumSensors; ++i) {
+    pins[i] = kWiring[i].pin;
+    bool synchronized = TopologyOf(kWiring, i).pairing == kPairSecond &&
+                        pairSynchronized[i - 1];
+    modules[i] = synchronized || !adc->adc0->checkPin(pins[i]) ? adc->adc1
+                                                               : adc->adc0;
+  }
+  // The sampling interrupt must not touch the ADCs during the sweep. With
+  // CIC decimation it puts its own configuration back afterwards.
+  StopSampling();
+  adcTuner.Sweep(adc, pins, modules, kNumSensors, noise_budget);
+  StartSampling();
+}
+
+// Runs |passes| sampling passes over every sensor, the way loop() does
+// without CIC decimation, and prints "s <sensors> <passes per second> <worst
+// pass us>". The worst pass bounds how long a press waits to be sampled.
+void BenchmarkSampling(size_t passes) {
+  StopSampling();
+  uint32_t cycles_per_us = F_CPU_ACTUAL / 1000000;
+  uint64_t total = 0;
+  uint32_t worst = 0;
+  for (size_t i = 0; i < passes; i++) {
+    uint32_t start = ARM_DWT_CYCCNT;
+    SampleSensors(false);
+    uint32_t cycles = ARM_DWT_CYCCNT - start;
+    total += cycles;
+    worst = max(worst, cycles);
+  }
+  StartSampling();
+  Serial.print("s ");
+  Serial.print(kNumSensors);
+  Serial.print(" ");
+  Serial.print((uint32_t)((uint64_t)F_CPU_ACTUAL * passes / max(total, (uint64_t)1)));
+  Serial.print(" ");
+  Serial.print((float)worst / cycles_per_us, 1);
+  Serial.print("\n");
+}
+
+// Everything the sensor path touches, see MemoryPlacement.h.
+const HotObject kHotObjects[] = {
+  { "adc", &adcDevice, sizeof(adcDevice) },
+  { "adcTuner", &adcTuner, sizeof(adcTuner) },
+  { "kStates", kStates, sizeof(kStates) },
+  { "kSensors", kSensors, sizeof(kSensors) },
+  { "pairSynchronized", pairSynchronized, sizeof(pairSynchronized) },
+  { "latencyTest", &latencyTest, sizeof(latencyTest) },
+#if defined(ENABLE_CIC_DECIMATION)
+  { "decimators", decimators, sizeof(decimators) },
+  { "decimatedValues", (const void*)decimatedValues, sizeof(decimatedValues) },
+#endif
+};
+const size_t kNumHotObjects = sizeof(kHotObjects) / sizeof(HotObject);
 
 #include "LedPanel.h"
 LedPanel panel(kStates);
@@ -80,11 +326,15 @@ void setup() {
     // Button numbers should start with 1.
     kSensors[i].Init(i + 1);
   }
+  for (size_t i = 0; i + 1 < kNumSensors; ++i) {
+    pairSynchronized[i] = adc->adc0->checkPin(kSensors[i].GetPin()) &&
+                          adc->adc1->checkPin(kSensors[i + 1].GetPin());
+  }
 
   panel.Init();
 
-  adc->adc0->setAveraging(16);
-  adc->adc1->setAveraging(16);
+  adcTuner.Apply(adc, kDefaultAdcConfig);
+  StartSampling();
   
   #if defined(CLEAR_BIT) && defined(SET_BIT)
 	  // Set the ADC prescaler to 16 for boards that support it,
@@ -98,6 +348,7 @@ void setup() {
 
 void loop() {
   unsigned long startMicros = micros();
+  refreshMeter.Loop(startMicros);
   // We only want to send over USB every millisecond, but we still want to
   // read the analog values as fast as we can to have the most up to date
   // values for the average.
@@ -110,9 +361,11 @@ void loop() {
 
   serialProcessor.CheckAndMaybeProcessData();
 
-  for (size_t i = 0; i < kNumSensors; ++i) {
-    kSensors[i].EvaluateSensor(willSend);
-  }
+  #if defined(ENABLE_CIC_DECIMATION)
+    EvaluateDecimated();
+  #else
+    SampleSensors(willSend);
+  #endif
   count++;
 
 
@@ -124,9 +377,12 @@ void loop() {
     #ifdef CORE_TEENSY
         Joystick.send_now();
     #endif
+    latencyTest.OnReport();
   }
+  latencyTest.Loop();
   
   panel.Update();
+  panel.Prefetch();
 
   if (loopTime == -1) {
     loopTime = micros() - startMicros;
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Generates the synthetic FSR traces in host/traces/.
+
+These stand in for recordings until real ones replace them; they use the same
+.trace format, which host/bench_traces.cpp documents. Every trace is
+deterministic so the benchmark baseline stays stable.
+
+Usage: tools/gentraces.py [output_dir]
+"""
+
+import math
+import os
+import random
+import sys
+
+RATE = 2000          # Raw samples per second and sensor.
+BITS = 10            # Width of the values below.
+SEND_EVERY = 2       # Samples per HID report, i.e. reports at 1kHz.
+THRESHOLD = 400
+IDLE = 30            # Resting value of an unloaded FSR.
+NOISE = 3            # Standard deviation of the idle noise.
+RISE_MS = 4.0        # Time constant of the FSR when loaded and unloaded.
+
+
+class Trace:
+    def __init__(self, name, description, panels, seconds, seed):
+        self.name = name
+        self.description = description
+        self.panels = panels
+        self.length = int(seconds * RATE)
+        self.rng = random.Random(seed)
+        # Target force per sensor and sample, shaped by the FSR response later.
+        self.force = [[0.0] * self.length for _ in panels]
+        self.extra = [[0.0] * self.length for _ in panels]
+        self.events = []
+
+    def ms(self, t):
+        return int(t * RATE / 1000)
+
+    def step(self, sensors, start_ms, end_ms, force, panel):
+        """A foot on |sensors| from start_ms to end_ms, annotated on |panel|."""
+        start, end = self.ms(start_ms), self.ms(end_ms)
+        for s in sensors:
+            for i in range(start, min(end, self.length)):
+                self.force[s][i] = max(self.force[s][i], force)
+        self.events.append(('press', start, panel))
+        self.events.append(('release', end, panel))
+
+    def load(self, sensor, start_ms, end_ms, force):
+        """Load on a sensor that is not a step, e.g. crosstalk or a heel."""
+        for i in range(self.ms(start_ms), min(self.ms(end_ms), self.length)):
+            self.force[sensor][i] = max(self.force[sensor][i], force)
+
+    def write(self, path):
+        alpha = 1 - math.exp(-1000.0 / (RATE * RISE_MS))
+        values = []
+        for s in range(len(self.panels)):
+            level = IDLE
+            column = []
+            for i in range(self.length):
+                level += (IDLE + self.force[s][i] - level) * alpha
+                v = level + self.extra[s][i] + self.rng.gauss(0, NOISE)
+                column.append(max(0, min(1023, int(round(v)))))
+            values.append(column)
+        with open(path, 'w') as f:
+            f.write('# %s\n' % self.description)
+            f.write('# Synthetic, generated by tools/gentraces.py.\n')
+            f.write('rate %d\n' % RATE)
+            f.write('bits %d\n' % BITS)
+            f.write('send_every %d\n' % SEND_EVERY)
+            f.write('threshold %d\n' % THRESHOLD)
+            f.write('panels %s\n' % ' '.join(str(p) for p in self.panels))
+            for kind, sample, panel in sorted(self.events,
+                                              key=lambda e: (e[1], e[0])):
+                f.write('%s %d %d\n' % (kind, sample, panel))
+            for i in range(self.length):
+                f.write(' '.join(str(c[i]) for c in values) + '\n')
+
+
+def fast_jacks():
+    t = Trace('fast_jacks', 'Jacks at 8 steps per second, 45ms contacts.',
+              [0, 0], 2.5, 1)
+    for n in range(16):
+        start = 100 + n * 125
+        t.step([0, 1], start, start + 45, 750 + t.rng.uniform(-100, 100), 0)
+    return t
+
+
+def holds():
+    t = Trace('holds', 'One second holds whose pressure sags towards the '
+              'threshold.', [0, 0], 4.0, 2)
+    for n in range(3):
+        start = 200 + n * 1250
+        t.step([0, 1], start, start + 1000, 600, 0)
+        # Weight shifts that dip close to, but stay above, the threshold.
+        for i in range(t.ms(start + 100), t.ms(start + 900)):
+            sag = 150 * (0.5 + 0.5 * math.sin(i * 2 * math.pi / RATE * 3))
+            for s in (0, 1):
+                t.force[s][i] -= sag
+    return t
+
+
+def heel_toe():
+    t = Trace('heel_toe', 'Heel on one sensor rolling onto the toe on the '
+              'other, one continuous press per step.', [0, 0], 3.0, 3)
+    for n in range(4):
+        start = 150 + n * 700
+        t.load(0, start, start + 300, 700)
+        t.load(1, start + 200, start + 500, 700)
+        t.events.append(('press', t.ms(start), 0))
+        t.events.append(('release', t.ms(start + 500), 0))
+    return t
+
+
+def idle_vibration():
+    t = Trace('idle_vibration', 'Nobody on the panel while the cabinet '
+              'vibrates.', [0, 0], 3.0, 4)
+    for burst in range(5):
+        start = t.ms(200 + burst * 550)
+        freq = 30 + burst * 20
+        for i in range(start, min(start + t.ms(300), t.length)):
+            a = 180 * math.sin((i - start) * 2 * math.pi * freq / RATE)
+            for s in (0, 1):
+                t.extra[s][i] = abs(a)
+    return t
+
+
+def crosstalk():
+    t = Trace('crosstalk', 'Hard steps on panel 0 leaking into panel 1 '
+              'through the frame.', [0, 0, 1, 1], 2.5, 5)
+    for n in range(8):
+        start = 150 + n * 280
+        force = 950
+        t.step([0, 1], start, start + 150, force, 0)
+        # A third of the force shows up on the neighbour.
+        t.load(2, start, start + 150, force / 3)
+        t.load(3, start, start + 150, force / 4)
+    # And a real step on panel 1 once panel 0 is quiet.
+    t.step([2, 3], 2350, 2450, 700, 1)
+    return t
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(__file__), '..', 'host', 'traces')
+    os.makedirs(out, exist_ok=True)
+    for make in (fast_jacks, holds, heel_toe, idle_vibration, crosstalk):
+        trace = make()
+        trace.write(os.path.join(out, trace.name + '.trace'))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Reports how a firmware build uses the Teensy 4.x memory regions.
+
+Prints the bytes every region holds once linked (ITCM code, DTCM data and
+stack, OCRAM DMAMEM buffers, EXTMEM, flash), the same numbers the "m" serial
+command prints at runtime, see MemoryPlacement.h.
+
+Given the build directory as well, it also finds every object marked
+HOT_DATA (placed in the .data.hot section of the sketch's object files) and
+checks that the linker put it in DTCM. Fails if one isn't.
+
+Usage:
+  tools/memreport.py build/led-panel-fsr.ino.elf [--objects build/]
+
+The Arduino IDE keeps the build directory under a temporary path that
+"Export compiled binary" or arduino-cli's --build-path makes predictable.
+Needs no toolchain: the ELF files are read directly.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+# name, start, end. DTCM and ITCM share 512KB of FlexRAM; the end given here is
+# the most either can get, the linker script decides the actual split.
+REGIONS = [
+    ("itcm", 0x00000000, 0x00080000),
+    ("dtcm", 0x20000000, 0x20080000),
+    ("ocram", 0x20200000, 0x20280000),
+    ("flash", 0x60000000, 0x60800000),
+    ("extmem", 0x70000000, 0x71000000),
+]
+HOT_SECTION = ".data.hot"
+
+SHT_PROGBITS = 1
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+
+class Elf:
+    """The sections and symbols of a 32-bit little-endian ELF file."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("%s: not a 32-bit little-endian ELF file" % path)
+        (shoff,) = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+        headers = [
+            struct.unpack_from("<IIIIIIIIII", data, shoff + i * shentsize)
+            for i in range(shnum)
+        ]
+        names = headers[shstrndx]
+
+        def string(table, offset):
+            start = table[4] + offset
+            return data[start:data.index(b"\0", start)].decode()
+
+        # name, type, flags, addr, size
+        self.sections = [
+            (string(names, h[0]), h[1], h[2], h[3], h[5]) for h in headers
+        ]
+        # name -> (value, size, section name)
+        self.symbols = {}
+        for h in headers:
+            if h[1] != SHT_SYMTAB:
+                continue
+            strtab = headers[h[6]]
+            for offset in range(h[4], h[4] + h[5], h[9]):
+                name, value, size, _, _, shndx = struct.unpack_from(
+                    "<IIIBBH", data, offset)
+                if name and 0 < shndx < len(self.sections):
+                    self.symbols[string(strtab, name)] = (
+                        value, size, self.sections[shndx][0])
+
+
+def region_of(address):
+    for name, start, end in REGIONS:
+        if start <= address < end:
+            return name
+    return None
+
+
+def region_usage(elf):
+    usage = dict((name, 0) for name, _, _ in REGIONS)
+    for name, kind, flags, addr, size in elf.sections:
+        if not flags & SHF_ALLOC or size == 0:
+            continue
+        region = region_of(addr)
+        if region is None:
+            continue
+        usage[region] += size
+        # Initialized data and ITCM code are copied out of flash at boot.
+        if kind == SHT_PROGBITS and region in ("itcm", "dtcm"):
+            usage["flash"] += size
+    return usage
+
+
+def hot_symbols(objects_dir):
+    hot = set()
+    for root, _, files in os.walk(objects_dir):
+        for file in files:
+            if not file.endswith(".o"):
+                continue
+            try:
+                elf = Elf(os.path.join(root, file))
+            except ValueError:
+                continue
+            hot.update(name for name, (_, _, section) in elf.symbols.items()
+                       if section == HOT_SECTION)
+    return sorted(hot)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("elf")
+    parser.add_argument("--objects",
+                        help="build directory with the sketch's .o files")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    print("%-8s %10s" % ("region", "bytes"))
+    for name, used in region_usage(elf).items():
+        print("%-8s %10d" % (name, used))
+
+    if not args.objects:
+        return 0
+    hot = hot_symbols(args.objects)
+    if not hot:
+        print("No HOT_DATA objects found in %s" % args.objects)
+        return 1
+    misplaced = 0
+    print()
+    print("%-24s %10s %8s  %s" % ("hot object", "address", "bytes", "region"))
+    for name in hot:
+        if name not in elf.symbols:
+            continue
+        value, size, _ = elf.symbols[name]
+        region = region_of(value)
+        print("%-24s 0x%08x %8d  %s" % (name, value, size, region))
+        if region != "dtcm":
+            misplaced += 1
+    if misplaced:
+        print("%d hot object(s) outside DTCM" % misplaced)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+"""Builds LED panel animation assets (.lpa) from GIF files.
+
+An asset holds every frame already mapped to the panel layout used by
+PanelLayout.h, run-length encoded, plus a frame index with delays, so the
+firmware only has to expand runs into frames instead of decoding a GIF.
+
+Usage:
+  tools/mkasset.py input.gif -o output.lpa [--symbol NAME --asm output.S]
+
+--asm additionally writes an assembler source that links the asset into
+flash as an opaque blob exposing NAME and NAME_len, which is how the
+built-in animation ships (see ldur_lpa.S).
+
+The panel tables below must match kPanelPositions, kPanelFlipped and
+kPanelRotation in PanelLayout.h. They are hashed into the asset header and the
+firmware rejects assets built for a different layout.
+"""
+
+import argparse
+import struct
+import sys
+
+PANEL_WIDTH = 64
+MATRIX_WIDTH = 256
+MATRIX_HEIGHT = 64
+# L, D, U, R
+PANEL_POSITIONS = [128, 64, 192, 0]
+PANEL_FLIPPED = [False, True, False, True]
+PANEL_ROTATION = [
+    0, 1, -1, 0,
+    1, 0, 0, 1,
+    1, 0, 0, 1,
+    0, 1, -1, 0,
+]
+
+MAGIC = b'LPA1'
+HEADER = struct.Struct('<4sHHHHI')
+INDEX_ENTRY = struct.Struct('<IIHH')
+MAX_RUN = 128
+
+
+def fnv1a(data, h=2166136261):
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h
+
+
+def layout_hash():
+    """Mirrors FrameCache::LayoutHash() on a little-endian target."""
+    h = fnv1a(struct.pack('<%dH' % len(PANEL_POSITIONS), *PANEL_POSITIONS))
+    h = fnv1a(bytes(int(f) for f in PANEL_FLIPPED), h)
+    h = fnv1a(struct.pack('<%db' % len(PANEL_ROTATION), *PANEL_ROTATION), h)
+    return fnv1a(struct.pack('<HH', MATRIX_WIDTH, MATRIX_HEIGHT), h)
+
+
+def lzw_decode(data, min_code_size, pixel_count):
+    clear = 1 << min_code_size
+    end = clear + 1
+    out = bytearray()
+    code_size = min_code_size + 1
+    table = [bytes([i]) for i in range(clear)] + [b'', b'']
+    prev = None
+    bits = 0
+    nbits = 0
+    pos = 0
+    while len(out) < pixel_count:
+        while nbits < code_size:
+            if pos >= len(data):
+                return out
+            bits |= data[pos] << nbits
+            pos += 1
+            nbits += 8
+        code = bits & ((1 << code_size) - 1)
+        bits >>= code_size
+        nbits -= code_size
+        if code == clear:
+            code_size = min_code_size + 1
+            table = table[:clear + 2]
+            prev = None
+            continue
+        if code == end:
+            break
+        if prev is None:
+            entry = table[code]
+        elif code < len(table):
+            entry = table[code]
+            table.append(prev + entry[:1])
+        else:
+            entry = prev + prev[:1]
+            table.append(entry)
+        out += entry
+        prev = entry
+        if len(table) == (1 << code_size) and code_size < 12:
+            code_size += 1
+    return out
+
+
+def read_sub_blocks(buf, pos):
+    chunks = []
+    while True:
+        size = buf[pos]
+        pos += 1
+        if size == 0:
+            return b''.join(chunks), pos
+        chunks.append(buf[pos:pos + size])
+        pos += size
+
+
+def read_palette(buf, pos, flags):
+    size = 3 << ((flags & 7) + 1)
+    raw = buf[pos:pos + size]
+    return [tuple(raw[i:i + 3]) for i in range(0, size, 3)], pos + size
+
+
+def decode_gif(buf):
+    """Returns (width, height, [(canvas, delay_ms)]) with canvas as rgb rows."""
+    if buf[:3] != b'GIF':
+        raise ValueError('not a GIF file')
+    width, height, flags = struct.unpack_from('<HHB', buf, 6)
+    pos = 13
+    global_palette = []
+    if flags & 0x80:
+        global_palette, pos = read_palette(buf, pos, flags)
+
+    black = (0, 0, 0)
+    canvas = [black] * (width * height)
+    frames = []
+    delay_ms = 0
+    disposal = 0
+    transparent = None
+    while pos < len(buf):
+        block = buf[pos]
+        pos += 1
+        if block == 0x3b:
+            break
+        if block == 0x21:
+            label = buf[pos]
+            data, pos = read_sub_blocks(buf, pos + 1)
+            if label == 0xf9 and len(data) >= 4:
+                packed, delay, index = struct.unpack_from('<BHB', data)
+                disposal = (packed >> 2) & 7
+                delay_ms = delay * 10
+                transparent = index if packed & 1 else None
+            continue
+        if block != 0x2c:
+            raise ValueError('unexpected block 0x%02x' % block)
+
+        left, top, w, h, iflags = struct.unpack_from('<HHHHB', buf, pos)
+        pos += 9
+        palette = global_palette
+        if iflags & 0x80:
+            palette, pos = read_palette(buf, pos, iflags)
+        min_code_size = buf[pos]
+        data, pos = read_sub_blocks(buf, pos + 1)
+        indices = lzw_decode(data, min_code_size, w * h)
+
+        rows = list(range(h))
+        if iflags & 0x40:
+            rows = (list(range(0, h, 8)) + list(range(4, h, 8)) +
+                    list(range(2, h, 4)) + list(range(1, h, 2)))
+        previous = list(canvas)
+        for i, y in enumerate(rows):
+            for x in range(w):
+                n = i * w + x
+                if n >= len(indices):
+                    break
+                index = indices[n]
+                if index == transparent:
+                    continue
+                cx, cy = left + x, top + y
+                if cx < width and cy < height:
+                    canvas[cy * width + cx] = palette[index]
+        frames.append((list(canvas), delay_ms))
+
+        if disposal == 2:
+            for y in range(top, min(top + h, height)):
+                for x in range(left, min(left + w, width)):
+                    canvas[y * width + x] = black
+        elif disposal == 3:
+            canvas = previous
+        delay_ms = 0
+        disposal = 0
+        transparent = None
+    return width, height, frames
+
+
+def map_to_panels(canvas, width):
+    """Same placement as PanelGif::PanelSink in PanelGif.h."""
+    tile = MATRIX_WIDTH // width
+    out = [(0, 0, 0)] * (MATRIX_WIDTH * MATRIX_HEIGHT)
+
+    def put(x, y, color):
+        out[MATRIX_WIDTH * y + x] = color
+
+    for y in range(MATRIX_HEIGHT):
+        for x in range(width):
+            color = canvas[y * width + x]
+            if tile <= 2:
+                index = x // PANEL_WIDTH
+                flipped = PANEL_FLIPPED[index]
+                px = x % PANEL_WIDTH
+                put(PANEL_POSITIONS[index] +
+                    (PANEL_WIDTH - 1 - px if flipped else px),
+                    MATRIX_HEIGHT - 1 - y if flipped else y, color)
+                if tile == 2:
+                    index += 2
+                    flipped = PANEL_FLIPPED[index]
+                    put(PANEL_POSITIONS[index] +
+                        (px if flipped else PANEL_WIDTH - 1 - px),
+                        y if flipped else MATRIX_HEIGHT - 1 - y, color)
+            else:
+                for i in range(4):
+                    r = PANEL_ROTATION[4 * i:4 * i + 4]
+                    xpos = (x * r[0] + y * r[1] + PANEL_WIDTH) % PANEL_WIDTH
+                    ypos = ((x * r[2] + y * r[3] + MATRIX_HEIGHT) %
+                            MATRIX_HEIGHT)
+                    put(PANEL_POSITIONS[i] + xpos, ypos, color)
+    return out
+
+
+def rle_encode(pixels):
+    """Control byte c < 0x80: c + 1 literal pixels follow.
+    Control byte c >= 0x80: the next pixel repeats c - 0x7f times."""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p)
+
+    i = 0
+    n = len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_RUN and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(0x7f + run)
+            out.extend(pixels[i])
+        else:
+            literal.append(pixels[i])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def build_asset(gif):
+    width, height, frames = decode_gif(gif)
+    if MATRIX_WIDTH % width or MATRIX_WIDTH // width not in (1, 2, 4) or \
+            height != MATRIX_HEIGHT:
+        raise ValueError('GIF must be 256, 128 or 64 wide and 64 tall')
+    if not frames:
+        raise ValueError('GIF has no frames')
+
+    encoded = [rle_encode(map_to_panels(canvas, width))
+               for canvas, _ in frames]
+    index = bytearray()
+    offset = 0
+    for data, (_, delay) in zip(encoded, frames):
+        index += INDEX_ENTRY.pack(offset, len(data), delay, 0)
+        offset += len(data)
+    header = HEADER.pack(MAGIC, MATRIX_WIDTH, MATRIX_HEIGHT, len(frames), 0,
+                         layout_hash())
+    return header + bytes(index) + b''.join(encoded)
+
+
+def write_asm(path, symbol, blob):
+    with open(path, 'w') as f:
+        f.write('// Generated by tools/mkasset.py, do not edit.\n')
+        f.write('  .section .progmem.%s, "a"\n' % symbol)
+        f.write('  .balign 4\n')
+        f.write('  .global %s\n' % symbol)
+        f.write('%s:\n' % symbol)
+        for i in range(0, len(blob), 32):
+            f.write('  .byte ' +
+                    ','.join(str(b) for b in blob[i:i + 32]) + '\n')
+        f.write('  .balign 4\n')
+        f.write('  .global %s_len\n' % symbol)
+        f.write('%s_len:\n' % symbol)
+        f.write('  .4byte %d\n' % len(blob))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('gif')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--symbol')
+    parser.add_argument('--asm')
+    args = parser.parse_args()
+
+    with open(args.gif, 'rb') as f:
+        blob = build_asset(f.read())
+    with open(args.output, 'wb') as f:
+        f.write(blob)
+    if args.asm:
+        write_asm(args.asm, args.symbol or 'asset_lpa', blob)
+    print('%s: %d bytes' % (args.output, len(blob)), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()